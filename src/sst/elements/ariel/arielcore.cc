@@ -38,7 +38,7 @@ ArielCore::ArielCore(ComponentId_t id, ArielTunnel *tunnel,
             Output* out, uint32_t maxIssuePerCyc,
             uint32_t maxQLen, uint64_t cacheLineSz,
             ArielMemoryManager* memMgr, const uint32_t perform_address_checks, Params& params) :
-            ComponentExtension(id), output(out), tunnel(tunnel),
+            ComponentExtension(id), output(out), tunnel(tunnel), cmdSource(nullptr), recorder(nullptr),
 #ifdef HAVE_CUDA
             tunnelR(tunnelR), tunnelD(tunnelD),
 #endif
@@ -138,12 +138,21 @@ ArielCore::~ArielCore() {
     }
 
     delete stdMemHandlers;
+    delete recorder;
 }
 
 void ArielCore::setCacheLink(StandardMem* newLink) {
     cacheLink = newLink;
 }
 
+void ArielCore::setCommandSource(ArielCommandSource* source) {
+    cmdSource = source;
+}
+
+void ArielCore::setRecorder(ArielCommandRecorder* rec) {
+    recorder = rec;
+}
+
 #ifdef HAVE_CUDA
 void ArielCore::setGpuLink(Link* gpulink) {
 
@@ -552,6 +561,11 @@ void ArielCore::finishCore() {
         delete traceGen;
         traceGen = NULL;
     }
+
+    // Flush the recorded command stream
+    if(recorder) {
+        recorder->close();
+    }
 }
 
 void ArielCore::halt(){
@@ -579,7 +593,7 @@ void ArielCore::setPhysicalAddresses(SST::Event *ev){
     uint64_t addr_offset;
     uint64_t current_transfer;
     current_transfer = (getRemainingTransfer() > 64) ? 64 : getRemainingTransfer();
-    phy_addr = memmgr->translateAddress(getCurrentAddress());
+    phy_addr = memmgr->translateCoreAddress(coreID, getCurrentAddress());
     addr_offset = phy_addr % ((uint64_t) cacheLineSize);
     if((addr_offset + current_transfer <= cacheLineSize)){
         physicalAddresses.push_back(phy_addr);
@@ -589,7 +603,7 @@ void ArielCore::setPhysicalAddresses(SST::Event *ev){
         uint64_t rightAddr = (getCurrentAddress() + ((uint64_t) cacheLineSize)) - addr_offset;
         uint64_t rightSize = current_transfer - leftSize;
         uint64_t physLeftAddr = phy_addr;
-        uint64_t physRightAddr = memmgr->translateAddress(rightAddr);
+        uint64_t physRightAddr = memmgr->translateCoreAddress(coreID, rightAddr);
         physicalAddresses.push_back(physLeftAddr);
     }
 }
@@ -834,6 +848,35 @@ bool ArielCore::hasDrainCompleted() const {
         return false;
 }
 
+bool ArielCore::readCommandNB(ArielCommand* ac) {
+    const bool avail = cmdSource ? cmdSource->readCommandNB(coreID, ac) : tunnel->readMessageNB(coreID, ac);
+
+    if(avail && recorder) {
+        recorder->record(*ac);
+    }
+
+    return avail;
+}
+
+ArielCommand ArielCore::readCommand() {
+    ArielCommand ac;
+
+    if(cmdSource) {
+        // Recorded streams always contain whole instructions
+        if(!cmdSource->readCommandNB(coreID, &ac)) {
+            output->fatal(CALL_INFO, -1, "Error: Ariel command stream for core %" PRIu32 " ended inside an instruction.\n", coreID);
+        }
+    } else {
+        ac = tunnel->readMessage(coreID);
+    }
+
+    if(recorder) {
+        recorder->record(ac);
+    }
+
+    return ac;
+}
+
 bool ArielCore::refillQueue() {
     ARIEL_CORE_VERBOSE(16, output->verbose(CALL_INFO, 16, 0, "Refilling event queue for core %" PRIu32 "...\n", coreID));
 
@@ -842,7 +885,7 @@ bool ArielCore::refillQueue() {
                             coreID, (uint32_t) coreQ->size(), (uint32_t) maxQLength));
 
         ArielCommand ac;
-        const bool avail = tunnel->readMessageNB(coreID, &ac);
+        const bool avail = readCommandNB(&ac);
 
         if ( !avail ) {
                 ARIEL_CORE_VERBOSE(32, output->verbose(CALL_INFO, 32, 0, "Tunnel claims no data on core: %" PRIu32 "\n", coreID));
@@ -884,7 +927,7 @@ bool ArielCore::refillQueue() {
                 }
 
                 while(ac.command != ARIEL_END_INSTRUCTION) {
-                        ac = tunnel->readMessage(coreID);
+                        ac = readCommand();
 
                         switch(ac.command) {
                             case ARIEL_PERFORM_READ:
@@ -985,7 +1028,7 @@ void ArielCore::handleReadRequest(ArielReadEvent* rEv) {
     // There is a chance that the non-alignment causes an undetected bug if an access spans multiple malloc regions that are contiguous in VA space but non-contiguous in PA space.
     // However, a single access spanning multiple malloc'd regions shouldn't happen...
     // Addresses mapped via first touch are always line/page aligned
-    const uint64_t physAddr = memmgr->translateAddress(readAddress);
+    const uint64_t physAddr = memmgr->translateCoreAddress(coreID, readAddress);
     const uint64_t addr_offset  = physAddr % ((uint64_t) cacheLineSize);
 
     if((addr_offset + readLength) <= cacheLineSize) {
@@ -1010,7 +1053,7 @@ void ArielCore::handleReadRequest(ArielReadEvent* rEv) {
         const uint64_t rightSize = readLength - leftSize;
 
         const uint64_t physLeftAddr = physAddr;
-        const uint64_t physRightAddr = memmgr->translateAddress(rightAddr);
+        const uint64_t physRightAddr = memmgr->translateCoreAddress(coreID, rightAddr);
 
         ARIEL_CORE_VERBOSE(4, output->verbose(CALL_INFO, 4, 0, "Core %" PRIu32 " issuing split-address read, LeftVAddr=%" PRIu64 ", RightVAddr=%" PRIu64 ", LeftSize=%" PRIu64 ", RightSize=%" PRIu64 ", LeftPhysAddr=%" PRIu64 ", RightPhysAddr=%" PRIu64 "\n",
                             coreID, leftAddr, rightAddr, leftSize, rightSize, physLeftAddr, physRightAddr));
@@ -1056,7 +1099,7 @@ void ArielCore::handleWriteRequest(ArielWriteEvent* wEv) {
     }*/
 
     // See note in handleReadRequest() on alignment issues
-    const uint64_t physAddr = memmgr->translateAddress(writeAddress);
+    const uint64_t physAddr = memmgr->translateCoreAddress(coreID, writeAddress);
     const uint64_t addr_offset  = physAddr % ((uint64_t) cacheLineSize);
 
     // We do not need to perform a split operation
@@ -1093,7 +1136,7 @@ void ArielCore::handleWriteRequest(ArielWriteEvent* wEv) {
         const uint64_t rightSize = writeLength - leftSize;
 
         const uint64_t physLeftAddr = physAddr;
-        const uint64_t physRightAddr = memmgr->translateAddress(rightAddr);
+        const uint64_t physRightAddr = memmgr->translateCoreAddress(coreID, rightAddr);
 
         ARIEL_CORE_VERBOSE(4, output->verbose(CALL_INFO, 4, 0, "Core %" PRIu32 " issuing split-address write, LeftVAddr=%" PRIu64 ", RightVAddr=%" PRIu64 ", LeftSize=%" PRIu64 ", RightSize=%" PRIu64 ", LeftPhysAddr=%" PRIu64 ", RightPhysAddr=%" PRIu64 "\n",
                             coreID, leftAddr, rightAddr, leftSize, rightSize, physLeftAddr, physRightAddr));
@@ -1148,7 +1191,7 @@ void ArielCore::handleFlushEvent(ArielFlushEvent *flEv) {
     const uint64_t virtualAddress = (uint64_t) flEv->getVirtualAddress();
     const uint64_t readLength = (uint64_t) flEv->getLength();
 
-    const uint64_t physAddr = memmgr->translateAddress(virtualAddress);
+    const uint64_t physAddr = memmgr->translateCoreAddress(coreID, virtualAddress);
     commitFlushEvent(physAddr, virtualAddress, (uint32_t) readLength);
 }
 
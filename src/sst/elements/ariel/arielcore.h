@@ -51,6 +51,8 @@
 
 #include "ariel_shmem.h"
 #include "arieltracegen.h"
+#include "arielrecord.h"
+#include "arielfrontend.h"
 
 #ifdef HAVE_CUDA
 #include "arielgpuev.h"
@@ -137,6 +139,8 @@ class ArielCore : public ComponentExtension {
       }
 
         void setCacheLink(StandardMem* newCacheLink);
+        void setCommandSource(ArielCommandSource* source);
+        void setRecorder(ArielCommandRecorder* rec);
         void createRtlEvent(void*, void*, void*, size_t, size_t, size_t);
         void setRtlLink(Link* rtllink);
 
@@ -194,6 +198,8 @@ class ArielCore : public ComponentExtension {
     private:
         bool processNextEvent();
         bool refillQueue();
+        bool readCommandNB(ArielCommand* ac);
+        ArielCommand readCommand();
         bool writePayloads;
         uint32_t coreID;
         uint32_t maxPendingTransactions;
@@ -224,6 +230,8 @@ class ArielCore : public ComponentExtension {
 
         StandardMem* cacheLink;
         ArielTunnel *tunnel;
+        ArielCommandSource* cmdSource;
+        ArielCommandRecorder* recorder;
         StdMemHandler* stdMemHandlers;
         Link* RtlLink;
 
@@ -159,6 +159,14 @@ ArielCPU::ArielCPU(ComponentId_t id, Params& params) :
         output->fatal(CALL_INFO, -1, "%s, Error: Loading frontend subcomponent failed. If Ariel was not built with Pin, user must supply a custom frontend in the input file.\n", getName().c_str());
 
     tunnel = frontend->getTunnel();
+    cmdSource = frontend->getCommandSource();
+    if (!tunnel && !cmdSource)
+        output->fatal(CALL_INFO, -1, "%s, Error: frontend %s provides neither a tunnel nor a command source.\n", getName().c_str(), frontend->getName().c_str());
+
+    bool writePayloads = params.find<int>("writepayloadtrace", 0) != 0;
+    if (cmdSource && writePayloads && !cmdSource->hasWritePayloads())
+        output->fatal(CALL_INFO, -1, "%s, Error: writepayloadtrace is set but frontend %s does not supply write payloads. Record with writepayloadtrace set to replay payloads.\n",
+                getName().c_str(), frontend->getName().c_str());
 #ifdef HAVE_CUDA
     tunnelR = frontend->getReturnTunnel();
     tunnelD = frontend->getDataTunnel();
@@ -188,6 +196,22 @@ ArielCPU::ArielCPU(ComponentId_t id, Params& params) :
 
         // Set max number of instructions
         cpu_cores[i]->setMaxInsts(max_insts);
+
+        if (cmdSource)
+            cpu_cores[i]->setCommandSource(cmdSource);
+    }
+
+    // Record the command stream so later runs can replay it without PIN
+    std::string recordPrefix = params.find<std::string>("recordprefix", "");
+    if ("" != recordPrefix) {
+        size_t recordChunkSize = params.find<size_t>("recordchunksize", 1048576);
+        bool recordCompress = params.find<bool>("recordcompress", true);
+
+        for(uint32_t i = 0; i < core_count; ++i) {
+            std::string recordFile = ArielCommandRecorder::fileName(recordPrefix, i);
+            output->verbose(CALL_INFO, 1, 0, "Recording core %" PRIu32 " command stream to %s\n", i, recordFile.c_str());
+            cpu_cores[i]->setRecorder(new ArielCommandRecorder(output, recordFile, i, core_count, recordChunkSize, recordCompress, writePayloads));
+        }
     }
 
     // Find all the components loaded into the "memory" slot
@@ -277,8 +301,10 @@ bool ArielCPU::tick( SST::Cycle_t cycle) {
     stopTicking = false;
     output->verbose(CALL_INFO, 16, 0, "Main processor tick, will issue to individual cores...\n");
 
-    tunnel->updateTime(getCurrentSimTimeNano());
-    tunnel->incrementCycles();
+    if (tunnel) {
+        tunnel->updateTime(getCurrentSimTimeNano());
+        tunnel->incrementCycles();
+    }
 
     // Keep ticking unless one of the cores says it is time to stop.
     for(uint32_t i = 0; i < core_count; ++i) {
@@ -82,6 +82,9 @@ class ArielCPU : public SST::Component {
         {"memmgr", "Memory manager to use for address translation", "ariel.MemoryManagerSimple"},
         {"writepayloadtrace", "Trace write payloads and put real memory contents into the memory system", "0"},
         {"instrument_instructions", "turn on or off instruction instrumentation in fesimple", "1"},
+        {"recordprefix", "If set, record the command stream each core reads from the frontend to <recordprefix>-<core>.arc for replay with ariel.frontend.replay", ""},
+        {"recordchunksize", "Size in bytes of the chunks a recorded command stream is compressed in", "1048576"},
+        {"recordcompress", "Set to 0 to store recorded command streams uncompressed (streams are always uncompressed if Ariel is built without libz)", "1"},
         {"gpu_enabled", "If enabled, gpu links will be set up", "0"})
 
     SST_ELI_DOCUMENT_PORTS( {"cache_link_%(corecount)d", "Each core's link to its cache", {}},
@@ -139,6 +142,7 @@ class ArielCPU : public SST::Component {
 
         ArielFrontend* frontend;
         ArielTunnel* tunnel;
+        ArielCommandSource* cmdSource;
         bool stopTicking;
 
 #ifdef HAVE_CUDA
@@ -32,6 +32,20 @@ namespace ArielComponent {
 
 #define STRINGIZE(input) #input
 
+/** Source of per-core commands for frontends which do not
+ * communicate with ArielCore through an ArielTunnel.
+ */
+class ArielCommandSource {
+public:
+    virtual ~ArielCommandSource() { }
+
+    /** Returns false if no command is available for the core */
+    virtual bool readCommandNB(uint32_t core, ArielCommand* ac) = 0;
+
+    /** Whether write commands carry the data written (see writepayloadtrace) */
+    virtual bool hasWritePayloads() const { return true; }
+};
+
 /** ArielFrontend is a generic interface for
  * sending a dynamic trace into Ariel.
  */
@@ -48,6 +62,9 @@ public:
 
     virtual ArielTunnel* getTunnel() = 0;
 
+    /** Frontends which return NULL from getTunnel() supply commands here */
+    virtual ArielCommandSource* getCommandSource() { return nullptr; }
+
 #ifdef HAVE_CUDA
     virtual GpuDataTunnel* getDataTunnel() { return nullptr; }
     virtual GpuReturnTunnel* getReturnTunnel() { return nullptr; }
@@ -57,6 +57,12 @@ class ArielMemoryManager : public SubComponent {
         /** Return the physical address for the request virtual address */
         virtual uint64_t translateAddress(uint64_t virtAddr) = 0;
 
+        /** Translate an address on behalf of a core.  Managers that keep
+         * per-core translation caches override this */
+        virtual uint64_t translateCoreAddress(uint32_t core, uint64_t virtAddr) {
+            return translateAddress(virtAddr);
+        }
+
         //Virtual Function to get Page info for RTL handle
         virtual void get_page_info(std::unordered_map<uint64_t, uint64_t>*, std::deque<uint64_t>*, uint64_t&) { }
 
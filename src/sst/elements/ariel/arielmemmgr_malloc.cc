@@ -16,6 +16,9 @@
 #include <sst_config.h>
 #include <stdio.h>
 
+#include <algorithm>
+#include <iterator>
+
 #include "arielmemmgr_malloc.h"
 
 using namespace SST::ArielComponent;
@@ -82,9 +85,40 @@ ArielMemoryManagerMalloc::ArielMemoryManagerMalloc(ComponentId_t id, Params& par
     }
 
     free(level_buffer);
+
+    // The radix table is indexed at the largest power of two that divides
+    // every page size so that a page of any level covers whole entries
+    uint64_t sizeBits = 0;
+    for (uint32_t i = 0; i < memoryLevels; ++i) {
+        sizeBits |= pageSizes[i];
+    }
+    radixGranule = sizeBits & (~sizeBits + 1);
+    lastRadixIndex = (uint64_t) -1;
+    lastRadixLeaf = NULL;
+
+    // Lower levels take precedence where pre-populated pages overlap
+    for (uint32_t i = 0; i < memoryLevels; ++i) {
+        for (auto it = pageTables[i]->begin(); it != pageTables[i]->end(); it++) {
+            radixInsert(it->first, it->second, pageSizes[i]);
+        }
+    }
+
+    // Per-core translation caches are direct mapped, round down to a power of two
+    uint64_t tlbEntries = 1;
+    while ((tlbEntries << 1) <= translationCacheEntries) {
+        tlbEntries <<= 1;
+    }
+    tlbMask = tlbEntries - 1;
+    tlbShift = 0;
+    while ((((uint64_t) 1) << tlbShift) < radixGranule) {
+        tlbShift++;
+    }
 }
 
 ArielMemoryManagerMalloc::~ArielMemoryManagerMalloc() {
+    for (auto it = radixDirectory.begin(); it != radixDirectory.end(); it++) {
+        delete it->second;
+    }
 }
 
 
@@ -149,6 +183,7 @@ void ArielMemoryManagerMalloc::allocate(const uint64_t size, const uint32_t leve
         freePages[level]->pop_front();
 
         pageTables[level]->insert( std::pair<uint64_t, uint64_t>(nextVirtPage, nextPhysPage) );
+        radixInsert(nextVirtPage, nextPhysPage, pageSize);
 
         output->verbose(CALL_INFO, 4, 0, "Allocating memory page, physical page=%" PRIu64 ", virtual page=%" PRIu64 "\n",
                 nextPhysPage, nextVirtPage);
@@ -176,17 +211,17 @@ void ArielMemoryManagerMalloc::allocate(const uint64_t size, const uint32_t leve
 bool ArielMemoryManagerMalloc::allocateMalloc(const uint64_t size, const uint32_t level, const uint64_t virtualAddress, const uint64_t instructionPointer, const uint32_t thread) {
     output->verbose(CALL_INFO, 4, 0, "Allocate malloc received. VA: %" PRIu64 ". Size: %" PRIu64 ". Level: %" PRIu32 ".\n", virtualAddress, size, level);
 
-    // Check whether a malloc mapping already exists (i.e., we missed a free)
-    std::map<uint64_t, uint64_t>::iterator it = mallocTranslations.upper_bound(virtualAddress);
-    if (it == mallocTranslations.begin()) it = mallocTranslations.end();
-    else if (!mallocTranslations.empty()) it--;
-
-    if (it != mallocTranslations.end() && it->first <= virtualAddress) {
-        uint64_t primaryAddr = mallocPrimaryVAMap.find(it->first)->second;
-        if (virtualAddress < primaryAddr + (mallocInformation.find(primaryAddr)->second).size) {
-            output->verbose(CALL_INFO, 4, 0, "Found conflicting malloc, freeing address %" PRIu64 "\n", primaryAddr);
-            freeMalloc(primaryAddr);
-        }
+    // Check whether malloc mappings already exist in the range (i.e., we missed a free)
+    // Regions are kept disjoint so a translation only has to look at the nearest one
+    std::map<uint64_t, MallocRegion>::iterator it = mallocRegions.upper_bound(virtualAddress);
+    if (it != mallocRegions.begin() && virtualAddress < std::prev(it)->first + std::prev(it)->second.size) {
+        it--;
+    }
+    while (it != mallocRegions.end() && it->first < virtualAddress + size) {
+        const uint64_t conflict = it->first;
+        it++;
+        output->verbose(CALL_INFO, 4, 0, "Found conflicting malloc, freeing address %" PRIu64 "\n", conflict);
+        freeMalloc(conflict);
     }
 
     // Allocate new page(s). Round malloc to nearest whole page TODO fix so we can map partial pages -> needs a local VA->Ariel_VA mapping
@@ -200,24 +235,21 @@ bool ArielMemoryManagerMalloc::allocateMalloc(const uint64_t size, const uint32_
     }
 
     // Allocate the pages
-    std::unordered_set<uint64_t>* virtualPages = new std::unordered_set<uint64_t>;
-    uint64_t nextVirtPage = virtualAddress;
-    uint64_t firstPhysAddr, lastPhysAddr;
-    firstPhysAddr = freePages[level]->front();
+    MallocRegion& region = mallocRegions[virtualAddress];
+    region.size = size;
+    region.level = level;
+    region.physPages.reserve(pageCount);
     for (uint64_t i = 0; i != pageCount; i++) {
-        uint64_t nextPhysPage = freePages[level]->front();
-        mallocTranslations.insert(std::make_pair(nextVirtPage, nextPhysPage));
-        mallocPrimaryVAMap.insert(std::make_pair(nextVirtPage, virtualAddress));
+        region.physPages.push_back(freePages[level]->front());
         freePages[level]->pop_front();
-        virtualPages->insert(nextVirtPage);
-        nextVirtPage += pageSizes[level];
-        lastPhysAddr = nextPhysPage;
     }
 
-    output->verbose(CALL_INFO, 4, 0, "Malloc mapped %" PRIu64 " to [%" PRIu64 ", %" PRIu64 "] (%" PRIu64 " pages).\n", virtualAddress, firstPhysAddr, lastPhysAddr, pageCount);
+    if (pageCount > 0) {
+        output->verbose(CALL_INFO, 4, 0, "Malloc mapped %" PRIu64 " to [%" PRIu64 ", %" PRIu64 "] (%" PRIu64 " pages).\n", virtualAddress, region.physPages.front(), region.physPages.back(), pageCount);
+    }
 
-    // Record malloc
-    mallocInformation.insert(std::make_pair(virtualAddress, mallocInfo(size, level, virtualPages)));
+    // The region hides any demand pages it overlaps
+    invalidateTranslations(virtualAddress, virtualAddress + size);
 
     statBytesAlloc[level]->addData(size);
     return true;
@@ -227,90 +259,183 @@ bool ArielMemoryManagerMalloc::allocateMalloc(const uint64_t size, const uint32_
 void ArielMemoryManagerMalloc::freeMalloc(const uint64_t virtualAddress) {
     output->verbose(CALL_INFO, 4, 0, "Freeing %" PRIu64 "\n", virtualAddress);
 
-    // Lookup VA in mallocInformation
-    std::map<uint64_t, mallocInfo>::iterator it = mallocInformation.find(virtualAddress);
-    if (it == mallocInformation.end()) return;
+    std::map<uint64_t, MallocRegion>::iterator it = mallocRegions.find(virtualAddress);
+    if (it == mallocRegions.end()) return;
 
-    statBytesFree[it->second.level]->addData(it->second.size);
+    const MallocRegion& region = it->second;
+    statBytesFree[region.level]->addData(region.size);
 
-    // Free each VA in mallocInformation from mallocTranslations & mallocPrimaryVAMap TODO fix so that mapping stays but address is available for future mallocs
-    std::unordered_set<uint64_t>* myKeys = (it->second.VAKeys);
-    for (std::unordered_set<uint64_t>::iterator vaIt = myKeys->begin(); vaIt != myKeys->end(); vaIt++) {
-        mallocPrimaryVAMap.erase(*vaIt);
-        freePages[(it->second).level]->push_front(mallocTranslations.find(*vaIt)->second);
-        mallocTranslations.erase(*vaIt);
+    // Return the pages in the order they were handed out TODO fix so that mapping stays but address is available for future mallocs
+    for (auto page = region.physPages.rbegin(); page != region.physPages.rend(); page++) {
+        freePages[region.level]->push_front(*page);
     }
 
-    // Remove mallocInformation entry
-    delete myKeys;
-    mallocInformation.erase(virtualAddress);
+    invalidateTranslations(virtualAddress, virtualAddress + region.size);
+    mallocRegions.erase(it);
+}
+
+
+/*
+ *  Record a demand or pre-populated page in the radix table.  Entries that
+ *  are already set are left alone so the first level to map a granule keeps it.
+ */
+void ArielMemoryManagerMalloc::radixInsert(uint64_t virtPage, uint64_t physPage, uint64_t pageSize) {
+    const uint64_t firstGranule = virtPage / radixGranule;
+    const uint64_t granules = pageSize / radixGranule;
+
+    for (uint64_t k = 0; k < granules; k++) {
+        const uint64_t granule = firstGranule + k;
+        RadixLeaf*& leaf = radixDirectory[granule >> radixLeafBits];
+        if (NULL == leaf) {
+            leaf = new RadixLeaf();
+            std::fill(leaf->phys, leaf->phys + (1 << radixLeafBits), (uint64_t) -1);
+        }
+
+        uint64_t& entry = leaf->phys[granule & ((1 << radixLeafBits) - 1)];
+        if (entry == (uint64_t) -1) {
+            entry = physPage - (virtPage % radixGranule) + k * radixGranule;
+        }
+    }
+}
+
+
+/*
+ *  Find the translation run containing virtAddr.  Malloc regions are checked
+ *  before the page tables.  A demand page run is a single radix granule,
+ *  trimmed so that it does not cover any malloc region.
+ */
+bool ArielMemoryManagerMalloc::lookup(uint64_t virtAddr, TranslationRun& run) {
+    std::map<uint64_t, MallocRegion>::iterator next = mallocRegions.upper_bound(virtAddr);
+    uint64_t prevEnd = 0;
+
+    if (next != mallocRegions.begin()) {
+        std::map<uint64_t, MallocRegion>::iterator it = std::prev(next);
+        const uint64_t offset = virtAddr - it->first;
+
+        if (offset < it->second.size) {
+            const uint64_t pageSize = pageSizes[it->second.level];
+            const uint64_t page = offset / pageSize;
+
+            run.vstart = it->first + page * pageSize;
+            run.vend = std::min(run.vstart + pageSize, it->first + it->second.size);
+            run.pstart = it->second.physPages[page];
+            return true;
+        }
+        prevEnd = it->first + it->second.size;
+    }
+
+    const uint64_t granule = virtAddr / radixGranule;
+    const uint64_t index = granule >> radixLeafBits;
+
+    if (index != lastRadixIndex) {
+        auto leaf = radixDirectory.find(index);
+        if (leaf == radixDirectory.end()) return false;
+        lastRadixIndex = index;
+        lastRadixLeaf = leaf->second;
+    }
+
+    const uint64_t phys = lastRadixLeaf->phys[granule & ((1 << radixLeafBits) - 1)];
+    if (phys == (uint64_t) -1) return false;
+
+    run.vstart = granule * radixGranule;
+    run.vend = run.vstart + radixGranule;
+    run.pstart = phys;
+
+    if (next != mallocRegions.end() && next->first < run.vend) {
+        run.vend = next->first;
+    }
+    if (prevEnd > run.vstart) {
+        run.pstart += prevEnd - run.vstart;
+        run.vstart = prevEnd;
+    }
+    return true;
+}
+
+
+/*
+ *  Drop every cached translation that overlaps [vstart, vend)
+ */
+void ArielMemoryManagerMalloc::invalidateTranslations(uint64_t vstart, uint64_t vend) {
+    if (vstart >= vend) return;
+
+    // Cached translations never cross a granule, so only the slots of the
+    // granules in the range can hold one that overlaps it
+    const uint64_t firstGranule = vstart >> tlbShift;
+    const uint64_t granules = ((vend - 1) >> tlbShift) - firstGranule + 1;
+    const uint64_t slots = std::min(granules, tlbMask + 1);
+
+    bool shootdown = false;
+
+    for (auto tlb = coreTLBs.begin(); tlb != coreTLBs.end(); tlb++) {
+        for (uint64_t i = 0; i < slots; i++) {
+            TranslationRun& entry = (*tlb)[(firstGranule + i) & tlbMask];
+            if (entry.vstart < vend && vstart < entry.vend) {
+                entry = TranslationRun();
+                shootdown = true;
+            }
+        }
+    }
+
+    if (shootdown) {
+        statTranslationShootdown->addData(1);
+    }
 }
 
 
 uint64_t ArielMemoryManagerMalloc::translateAddress(uint64_t virtAddr) {
+    return translateCoreAddress(0, virtAddr);
+}
+
+
+uint64_t ArielMemoryManagerMalloc::translateCoreAddress(uint32_t core, uint64_t virtAddr) {
     // If translation is disabled, then just return address
     if( ! translationEnabled ) {
         return virtAddr;
     }
 
-    // Keep track of how many translations we are performing
-    statTranslationQueries->addData(1);
+    if (core >= coreTLBs.size()) {
+        coreTLBs.resize(core + 1, std::vector<TranslationRun>(tlbMask + 1));
+    }
 
-    uint64_t physAddr = (uint64_t) -1;
-    bool found = false;
+    return translate(coreTLBs[core], virtAddr);
+}
 
-    output->verbose(CALL_INFO, 4, 0, "Page Table: translate virtual address %" PRIu64 "\n", virtAddr);
+
+uint64_t ArielMemoryManagerMalloc::translate(std::vector<TranslationRun>& tlb, uint64_t virtAddr) {
+    // Keep track of how many translations we are performing
+    statTranslationQueries->addData(1);
 
     // Check the translation cache otherwise carry on
-    auto checkCache = translationCache->find(virtAddr);
-    if(checkCache != translationCache->end()) {
+    TranslationRun& cached = tlb[(virtAddr >> tlbShift) & tlbMask];
+    if (cached.vstart <= virtAddr && virtAddr < cached.vend) {
         statTranslationCacheHits->addData(1);
-        return checkCache->second;
-    }
-
-    // Check malloc mappings
-    if (!mallocTranslations.empty()) {
-        std::map<uint64_t, uint64_t>::iterator it = mallocTranslations.upper_bound(virtAddr);
-        if (it == mallocTranslations.begin()) it = mallocTranslations.end();
-        else it--;
-
-        if (it != mallocTranslations.end() && (it->first <= virtAddr)) {
-            uint64_t primaryAddr = mallocPrimaryVAMap.find(it->first)->second;
-            if (virtAddr < (primaryAddr + (mallocInformation.find(primaryAddr)->second).size)) {
-                uint64_t offset = virtAddr - it->first;
-                physAddr = offset + it->second;
-                found = true;
-            }
-        }
+        return cached.pstart + (virtAddr - cached.vstart);
     }
 
-    // We will have to search every memory level to find where the address lies
-    for(uint32_t i = 0; i < memoryLevels; ++i) {
-        if (!found) {
-        std::unordered_map<uint64_t, uint64_t>::iterator page_itr;
-        const uint64_t pageSize = pageSizes[i];
-            const uint64_t page_offset = virtAddr % pageSize;
-        const uint64_t page_start = virtAddr - page_offset;
+    output->verbose(CALL_INFO, 4, 0, "Page Table: translate virtual address %" PRIu64 "\n", virtAddr);
 
-        page_itr = pageTables[i]->find(page_start);
+    TranslationRun run;
+    if (lookup(virtAddr, run)) {
+        const uint64_t physAddr = run.pstart + (virtAddr - run.vstart);
 
-            if (page_itr != pageTables[i]->end()) {
-                // Located
-            physAddr = page_itr->second + page_offset;
+        output->verbose(CALL_INFO, 4, 0, "Page table hit: virtual address=%" PRIu64 ", virtual start=%" PRIu64 ", virtual end=%" PRIu64 ", translates to phys start=%" PRIu64 " translates to: phys address: %" PRIu64 "\n",
+            virtAddr, run.vstart, run.vend, run.pstart, physAddr);
 
-                output->verbose(CALL_INFO, 4, 0, "Page table hit: virtual address=%" PRIu64 " hit in level: %" PRIu32 ", virtual page start=%" PRIu64 ", virtual end=%" PRIu64 ", translates to phys page start=%" PRIu64 " translates to: phys address: %" PRIu64 " (offset added to phys start=%" PRIu64 ")\n",
-                    virtAddr, i, page_itr->first, page_itr->first + pageSize, page_itr->second, physAddr, page_offset);
+        if (cached.vend != 0) {
+            statTranslationCacheEvict->addData(1);
+        }
 
-            found = true;
-            break;
+        // Only cache the part of the run in this slot's granule
+        const uint64_t granuleStart = (virtAddr >> tlbShift) << tlbShift;
+        const uint64_t granuleEnd = granuleStart + (((uint64_t) 1) << tlbShift);
+        if (run.vstart < granuleStart) {
+            run.pstart += granuleStart - run.vstart;
+            run.vstart = granuleStart;
         }
-        } else {
-            break;
+        if (run.vend > granuleEnd) {
+            run.vend = granuleEnd;
         }
-    }
-
-    if(found) {
-        cacheTranslation(virtAddr, physAddr);
+        cached = run;
         return physAddr;
     } else {
         output->verbose(CALL_INFO, 4, 0, "Page table miss for virtual address: %" PRIu64 "\n", virtAddr);
@@ -339,7 +464,7 @@ uint64_t ArielMemoryManagerMalloc::translateAddress(uint64_t virtAddr) {
             }
 
         // Now attempt to refind it
-        const uint64_t newPhysAddr = translateAddress(virtAddr);
+        const uint64_t newPhysAddr = translate(tlb, virtAddr);
 
         output->verbose(CALL_INFO, 4, 0, "Page allocation routine mapped to address: %" PRIu64 "\n", newPhysAddr );
 
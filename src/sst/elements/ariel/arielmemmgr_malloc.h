@@ -24,6 +24,7 @@
 
 #include <stdint.h>
 #include <deque>
+#include <map>
 #include <vector>
 #include <unordered_map>
 
@@ -67,6 +68,7 @@ class ArielMemoryManagerMalloc : public ArielMemoryManagerCache {
         uint32_t getDefaultPool();
 
         uint64_t translateAddress(uint64_t virtAddr);
+        uint64_t translateCoreAddress(uint32_t core, uint64_t virtAddr);
         void printStats();
 
         void freeMalloc(const uint64_t vAddr);
@@ -76,16 +78,47 @@ class ArielMemoryManagerMalloc : public ArielMemoryManagerCache {
         void allocate(const uint64_t size, const uint32_t level, const uint64_t virtualAddress);
         bool canAllocateInLevel(const uint64_t size, const uint32_t level);
 
-        struct mallocInfo {
+        /* A virtually contiguous range that translates linearly:
+         * phys = virt - vstart + pstart for vstart <= virt < vend */
+        struct TranslationRun {
+            uint64_t vstart;
+            uint64_t vend;
+            uint64_t pstart;
+            TranslationRun() : vstart(0), vend(0), pstart(0) {}
+        };
+
+        struct MallocRegion {
             uint64_t size;
             uint32_t level;
-            std::unordered_set<uint64_t>* VAKeys;
-            mallocInfo(uint64_t size, uint32_t level, std::unordered_set<uint64_t>* VAKeys) : size(size), level(level), VAKeys(VAKeys) {};
+            std::vector<uint64_t> physPages;
+        };
+
+        /* Demand-mapped and pre-populated pages, indexed by virtual
+         * granule (the gcd of all page sizes).  Leaves cover 2^radixLeafBits
+         * granules and hold the physical address of each granule. */
+        static const uint32_t radixLeafBits = 9;
+        struct RadixLeaf {
+            uint64_t phys[1 << radixLeafBits];
         };
 
-        std::map<uint64_t, uint64_t> mallocPrimaryVAMap;    // Map VA of each PA to the primary VA of the malloc -> used to find the mallocInfo
-        std::map<uint64_t, uint64_t> mallocTranslations;    // Map VA to PA for mallocs -> primary lookup
-        std::map<uint64_t, mallocInfo> mallocInformation;   // Map mallocID to information about the malloc -> use for frees/allocs
+        uint64_t translate(std::vector<TranslationRun>& tlb, uint64_t virtAddr);
+        bool lookup(uint64_t virtAddr, TranslationRun& run);
+        void radixInsert(uint64_t virtPage, uint64_t physPage, uint64_t pageSize);
+        void invalidateTranslations(uint64_t vstart, uint64_t vend);
+
+        std::map<uint64_t, MallocRegion> mallocRegions;     // Mallocs by starting VA -> checked before the page tables
+
+        std::unordered_map<uint64_t, RadixLeaf*> radixDirectory;
+        uint64_t radixGranule;
+        uint64_t lastRadixIndex;
+        RadixLeaf* lastRadixLeaf;
+
+        /* Direct-mapped per-core translation caches, indexed by granule.  Each
+         * slot only holds translations within one granule, so an unmap only
+         * has to visit the slots of the granules it covers. */
+        std::vector< std::vector<TranslationRun> > coreTLBs;
+        uint64_t tlbMask;
+        uint32_t tlbShift;
 
         uint32_t defaultLevel;
         uint32_t memoryLevels;
@@ -0,0 +1,347 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+
+#include "arielrecord.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+#ifdef HAVE_LIBZ
+#include "zlib.h"
+#endif
+
+using namespace SST::ArielComponent;
+
+static const char ARIEL_RECORD_MAGIC[8] = { 'A', 'R', 'I', 'E', 'L', 'C', 'M', 'D' };
+static const uint32_t ARIEL_RECORD_VERSION = 2;
+
+// Header flags
+static const uint32_t ARIEL_RECORD_PAYLOADS = 0x1;
+
+std::string ArielCommandRecorder::fileName(const std::string& prefix, uint32_t core) {
+    return prefix + "-" + std::to_string(core) + ".arc";
+}
+
+ArielCommandRecorder::ArielCommandRecorder(SST::Output* out, const std::string& fileName,
+        uint32_t core, uint32_t coreCount, size_t chunkSz, bool comp, bool pay) :
+    output(out), name(fileName), chunkSize(chunkSz), compress(comp), payloads(pay), lastAddr(0) {
+
+#ifndef HAVE_LIBZ
+    compress = false;
+#endif
+
+    file = fopen(name.c_str(), "wb");
+    if(NULL == file) {
+        output->fatal(CALL_INFO, -1, "Error: unable to open command recording file %s\n", name.c_str());
+    }
+
+    uint32_t header[4] = { ARIEL_RECORD_VERSION, core, coreCount, payloads ? ARIEL_RECORD_PAYLOADS : 0 };
+    fwrite(ARIEL_RECORD_MAGIC, sizeof(ARIEL_RECORD_MAGIC), 1, file);
+    fwrite(header, sizeof(header), 1, file);
+
+    chunk.reserve(chunkSize + 128);
+}
+
+ArielCommandRecorder::~ArielCommandRecorder() {
+    close();
+}
+
+void ArielCommandRecorder::close() {
+    if(NULL == file) return;
+
+    flushChunk();
+    fclose(file);
+    file = NULL;
+}
+
+void ArielCommandRecorder::putVarint(uint64_t value) {
+    while(value >= 0x80) {
+        chunk.push_back((uint8_t) (value | 0x80));
+        value >>= 7;
+    }
+    chunk.push_back((uint8_t) value);
+}
+
+void ArielCommandRecorder::putBytes(const uint8_t* data, size_t length) {
+    chunk.insert(chunk.end(), data, data + length);
+}
+
+void ArielCommandRecorder::record(const ArielCommand& ac) {
+    if(NULL == file) return;
+
+    chunk.push_back((uint8_t) ac.command);
+
+    switch(ac.command) {
+    case ARIEL_START_INSTRUCTION:
+        putVarint(ac.inst.instClass);
+        putVarint(ac.inst.simdElemCount);
+        break;
+
+    case ARIEL_PERFORM_READ:
+    case ARIEL_PERFORM_WRITE:
+    {
+        // Zig-zag encode the distance from the last address, most
+        // accesses are close to the previous one
+        const int64_t delta = (int64_t) (ac.inst.addr - lastAddr);
+        putVarint(((uint64_t) delta << 1) ^ (uint64_t) (delta >> 63));
+        putVarint(ac.inst.size);
+        lastAddr = ac.inst.addr;
+
+        if(payloads && ARIEL_PERFORM_WRITE == ac.command) {
+            putBytes(&ac.inst.payload[0], std::min((uint32_t) ARIEL_MAX_PAYLOAD_SIZE, ac.inst.size));
+        }
+        break;
+    }
+
+    case ARIEL_FLUSHLINE_INSTRUCTION:
+        putVarint(ac.flushline.vaddr);
+        break;
+
+    case ARIEL_ISSUE_TLM_MMAP:
+        putVarint(ac.mlm_mmap.fileID);
+        putVarint(ac.mlm_mmap.vaddr);
+        putVarint(ac.mlm_mmap.alloc_len);
+        putVarint(ac.mlm_mmap.alloc_level);
+        putVarint(ac.instPtr);
+        break;
+
+    case ARIEL_ISSUE_TLM_MAP:
+        putVarint(ac.mlm_map.vaddr);
+        putVarint(ac.mlm_map.alloc_len);
+        putVarint(ac.mlm_map.alloc_level);
+        putVarint(ac.instPtr);
+        break;
+
+    case ARIEL_ISSUE_TLM_FREE:
+        putVarint(ac.mlm_free.vaddr);
+        break;
+
+    case ARIEL_SWITCH_POOL:
+        putVarint(ac.switchPool.pool);
+        break;
+
+    case ARIEL_END_INSTRUCTION:
+    case ARIEL_NOOP:
+    case ARIEL_FENCE_INSTRUCTION:
+    case ARIEL_OUTPUT_STATS:
+    case ARIEL_PERFORM_EXIT:
+        break;
+
+    default:
+        // CUDA and RTL commands carry pointers into the traced process
+        output->fatal(CALL_INFO, -1, "Error: Ariel cannot record command (%d) to %s, it refers to memory in the traced application.\n",
+            (int) ac.command, name.c_str());
+        break;
+    }
+
+    if(chunk.size() >= chunkSize) {
+        flushChunk();
+    }
+}
+
+void ArielCommandRecorder::flushChunk() {
+    if(chunk.empty()) return;
+
+    const uint8_t* data = chunk.data();
+    uint32_t lengths[2] = { (uint32_t) chunk.size(), (uint32_t) chunk.size() };
+
+#ifdef HAVE_LIBZ
+    if(compress) {
+        uLongf packedLen = compressBound(chunk.size());
+        packed.resize(packedLen);
+
+        if(Z_OK == compress2(packed.data(), &packedLen, chunk.data(), chunk.size(), Z_BEST_SPEED) &&
+                packedLen < chunk.size()) {
+            data = packed.data();
+            lengths[1] = (uint32_t) packedLen;
+        }
+    }
+#endif
+
+    if(fwrite(lengths, sizeof(lengths), 1, file) != 1 ||
+            fwrite(data, lengths[1], 1, file) != 1) {
+        output->fatal(CALL_INFO, -1, "Error: failed writing command recording file %s\n", name.c_str());
+    }
+
+    chunk.clear();
+}
+
+ArielCommandReplayer::ArielCommandReplayer(SST::Output* out, const std::string& fileName,
+        uint32_t core, uint32_t coreCount) :
+    output(out), name(fileName), pos(0), payloads(false), lastAddr(0) {
+
+    file = fopen(name.c_str(), "rb");
+    if(NULL == file) {
+        output->fatal(CALL_INFO, -1, "Error: unable to open command recording file %s\n", name.c_str());
+    }
+
+    char magic[sizeof(ARIEL_RECORD_MAGIC)];
+    uint32_t header[4];
+    if(fread(magic, sizeof(magic), 1, file) != 1 || fread(header, sizeof(header), 1, file) != 1 ||
+            memcmp(magic, ARIEL_RECORD_MAGIC, sizeof(magic)) != 0) {
+        output->fatal(CALL_INFO, -1, "Error: %s is not an Ariel command recording\n", name.c_str());
+    }
+
+    if(header[0] != ARIEL_RECORD_VERSION) {
+        output->fatal(CALL_INFO, -1, "Error: %s has recording version %" PRIu32 ", expected %" PRIu32 "\n",
+            name.c_str(), header[0], ARIEL_RECORD_VERSION);
+    }
+
+    if(header[1] != core || header[2] != coreCount) {
+        output->fatal(CALL_INFO, -1, "Error: %s was recorded for core %" PRIu32 " of %" PRIu32 " but is being replayed on core %" PRIu32 " of %" PRIu32 "\n",
+            name.c_str(), header[1], header[2], core, coreCount);
+    }
+
+    payloads = (header[3] & ARIEL_RECORD_PAYLOADS) != 0;
+}
+
+ArielCommandReplayer::~ArielCommandReplayer() {
+    if(NULL != file) {
+        fclose(file);
+    }
+}
+
+bool ArielCommandReplayer::loadChunk() {
+    uint32_t lengths[2];
+
+    if(NULL == file) return false;
+
+    if(fread(lengths, sizeof(lengths), 1, file) != 1) {
+        fclose(file);
+        file = NULL;
+        return false;
+    }
+
+    chunk.resize(lengths[0]);
+    pos = 0;
+
+    if(lengths[1] == lengths[0]) {
+        if(lengths[0] > 0 && fread(chunk.data(), lengths[0], 1, file) != 1) {
+            output->fatal(CALL_INFO, -1, "Error: command recording %s is truncated\n", name.c_str());
+        }
+        return true;
+    }
+
+#ifdef HAVE_LIBZ
+    packed.resize(lengths[1]);
+    if(fread(packed.data(), lengths[1], 1, file) != 1) {
+        output->fatal(CALL_INFO, -1, "Error: command recording %s is truncated\n", name.c_str());
+    }
+
+    uLongf rawLen = lengths[0];
+    if(Z_OK != uncompress(chunk.data(), &rawLen, packed.data(), lengths[1]) || rawLen != lengths[0]) {
+        output->fatal(CALL_INFO, -1, "Error: command recording %s has a corrupt chunk\n", name.c_str());
+    }
+#else
+    output->fatal(CALL_INFO, -1, "Error: command recording %s is compressed but Ariel was built without libz\n", name.c_str());
+#endif
+
+    return true;
+}
+
+uint64_t ArielCommandReplayer::getVarint() {
+    uint64_t value = 0;
+    int shift = 0;
+
+    while(pos < chunk.size()) {
+        const uint8_t b = chunk[pos++];
+        value |= ((uint64_t) (b & 0x7F)) << shift;
+        if(0 == (b & 0x80)) return value;
+        shift += 7;
+    }
+
+    output->fatal(CALL_INFO, -1, "Error: command recording %s has a command split across chunks\n", name.c_str());
+    return 0;
+}
+
+bool ArielCommandReplayer::read(ArielCommand* ac) {
+    while(pos >= chunk.size()) {
+        if(!loadChunk()) return false;
+    }
+
+    ac->command = (ArielShmemCmd_t) chunk[pos++];
+    ac->instPtr = 0;
+
+    switch(ac->command) {
+    case ARIEL_START_INSTRUCTION:
+        ac->inst.instClass = (uint32_t) getVarint();
+        ac->inst.simdElemCount = (uint32_t) getVarint();
+        break;
+
+    case ARIEL_PERFORM_READ:
+    case ARIEL_PERFORM_WRITE:
+    {
+        const uint64_t zz = getVarint();
+        const int64_t delta = (int64_t) (zz >> 1) ^ -((int64_t) (zz & 1));
+        ac->inst.addr = lastAddr + (uint64_t) delta;
+        ac->inst.size = (uint32_t) getVarint();
+        lastAddr = ac->inst.addr;
+
+        if(payloads && ARIEL_PERFORM_WRITE == ac->command) {
+            const size_t len = std::min((uint32_t) ARIEL_MAX_PAYLOAD_SIZE, ac->inst.size);
+            if(pos + len > chunk.size()) {
+                output->fatal(CALL_INFO, -1, "Error: command recording %s has a command split across chunks\n", name.c_str());
+            }
+            memcpy(&ac->inst.payload[0], &chunk[pos], len);
+            pos += len;
+        }
+        break;
+    }
+
+    case ARIEL_FLUSHLINE_INSTRUCTION:
+        ac->flushline.vaddr = getVarint();
+        break;
+
+    case ARIEL_ISSUE_TLM_MMAP:
+        ac->mlm_mmap.fileID = (uint32_t) getVarint();
+        ac->mlm_mmap.vaddr = getVarint();
+        ac->mlm_mmap.alloc_len = getVarint();
+        ac->mlm_mmap.alloc_level = (uint32_t) getVarint();
+        ac->instPtr = getVarint();
+        break;
+
+    case ARIEL_ISSUE_TLM_MAP:
+        ac->mlm_map.vaddr = getVarint();
+        ac->mlm_map.alloc_len = getVarint();
+        ac->mlm_map.alloc_level = (uint32_t) getVarint();
+        ac->instPtr = getVarint();
+        break;
+
+    case ARIEL_ISSUE_TLM_FREE:
+        ac->mlm_free.vaddr = getVarint();
+        break;
+
+    case ARIEL_SWITCH_POOL:
+        ac->switchPool.pool = (uint32_t) getVarint();
+        break;
+
+    case ARIEL_END_INSTRUCTION:
+    case ARIEL_NOOP:
+    case ARIEL_FENCE_INSTRUCTION:
+    case ARIEL_OUTPUT_STATS:
+    case ARIEL_PERFORM_EXIT:
+        break;
+
+    default:
+        output->fatal(CALL_INFO, -1, "Error: command recording %s contains unknown command (%d)\n",
+            name.c_str(), (int) ac->command);
+        break;
+    }
+
+    return true;
+}
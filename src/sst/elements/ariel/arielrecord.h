@@ -0,0 +1,103 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_ARIEL_RECORD
+#define _H_ARIEL_RECORD
+
+#include <sst/core/output.h>
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+#include "ariel_shmem.h"
+
+namespace SST {
+namespace ArielComponent {
+
+/*
+ * Recorded command streams.
+ *
+ * Each core's stream is written to its own file.  The file starts with
+ * a header (magic, version, core id, core count, flags) and is followed
+ * by chunks.  Each chunk is a 32-bit raw length, a 32-bit stored length and
+ * the stored bytes; the chunk is zlib compressed when the stored length
+ * is smaller than the raw length.  Inside a chunk each command is a
+ * one byte command code followed by the fields ArielCore uses for that
+ * command, as LEB128 varints.  Read and write addresses are stored as a
+ * signed delta from the previous memory address.  Write payloads are
+ * only stored when the recording run traced them (writepayloadtrace),
+ * which is marked in the header flags.
+ *
+ * Integers in the header and chunk lengths are in host byte order.
+ */
+class ArielCommandRecorder {
+public:
+    ArielCommandRecorder(SST::Output* out, const std::string& fileName, uint32_t core,
+        uint32_t coreCount, size_t chunkSize, bool compress, bool payloads);
+    ~ArielCommandRecorder();
+
+    void record(const ArielCommand& ac);
+    void close();
+
+    static std::string fileName(const std::string& prefix, uint32_t core);
+
+private:
+    void putVarint(uint64_t value);
+    void putBytes(const uint8_t* data, size_t length);
+    void flushChunk();
+
+    SST::Output* output;
+    FILE* file;
+    std::string name;
+    std::vector<uint8_t> chunk;
+    std::vector<uint8_t> packed;
+    size_t chunkSize;
+    bool compress;
+    bool payloads;
+    uint64_t lastAddr;
+};
+
+class ArielCommandReplayer {
+public:
+    ArielCommandReplayer(SST::Output* out, const std::string& fileName, uint32_t core, uint32_t coreCount);
+    ~ArielCommandReplayer();
+
+    /** Read the next command.  Returns false at the end of the stream */
+    bool read(ArielCommand* ac);
+
+    /** Whether write commands carry the written data */
+    bool hasPayloads() const { return payloads; }
+
+private:
+    uint64_t getVarint();
+    bool loadChunk();
+
+    SST::Output* output;
+    FILE* file;
+    std::string name;
+    std::vector<uint8_t> chunk;
+    std::vector<uint8_t> packed;
+    size_t pos;
+    bool payloads;
+    uint64_t lastAddr;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,78 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include <sst_config.h>
+
+#include "replayfrontend.h"
+
+using namespace SST::ArielComponent;
+
+ReplayFrontend::ReplayFrontend(ComponentId_t id, Params& params, uint32_t cores, uint32_t maxCoreQueueLen, uint32_t defMemPool) :
+            ArielFrontend(id, params, cores, maxCoreQueueLen, defMemPool),
+            exhausted(cores, false), exhaustedCount(0), exitSeen(false) {
+
+    int verbosity = params.find<int>("verbose", 0);
+    output = new SST::Output("ReplayFrontend[@f:@l:@p] ", verbosity, 0, SST::Output::STDOUT);
+
+    std::string prefix = params.find<std::string>("replayprefix", "");
+    if("" == prefix) {
+        output->fatal(CALL_INFO, -1, "The replayprefix parameter specifying which recording to replay was not specified\n");
+    }
+
+    for(uint32_t i = 0; i < cores; ++i) {
+        std::string fileName = ArielCommandRecorder::fileName(prefix, i);
+        output->verbose(CALL_INFO, 1, 0, "Core %" PRIu32 " replays %s\n", i, fileName.c_str());
+        streams.push_back(new ArielCommandReplayer(output, fileName, i, cores));
+    }
+}
+
+ReplayFrontend::~ReplayFrontend() {
+    for(auto stream : streams) {
+        delete stream;
+    }
+    delete output;
+}
+
+bool ReplayFrontend::hasWritePayloads() const {
+    for(auto stream : streams) {
+        if(!stream->hasPayloads()) return false;
+    }
+    return true;
+}
+
+bool ReplayFrontend::readCommandNB(uint32_t core, ArielCommand* ac) {
+    if(!exhausted[core]) {
+        if(streams[core]->read(ac)) {
+            if(ARIEL_PERFORM_EXIT == ac->command) exitSeen = true;
+            return true;
+        }
+
+        output->verbose(CALL_INFO, 1, 0, "Core %" PRIu32 " reached the end of its recording\n", core);
+        exhausted[core] = true;
+        exhaustedCount++;
+    }
+
+    // A recording from a run that was stopped early has no exit, so end
+    // the replay once every core has run out of commands
+    if(!exitSeen && exhaustedCount == exhausted.size()) {
+        exitSeen = true;
+        ac->command = ARIEL_PERFORM_EXIT;
+        ac->instPtr = 0;
+        return true;
+    }
+
+    return false;
+}
@@ -0,0 +1,72 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_REPLAY_FRONTEND
+#define _H_REPLAY_FRONTEND
+
+#include <sst/core/sst_config.h>
+#include <sst/core/component.h>
+#include <sst/core/params.h>
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "arielfrontend.h"
+#include "arielrecord.h"
+#include "ariel_shmem.h"
+
+namespace SST {
+namespace ArielComponent {
+
+/** Replays command streams recorded by ArielCPU (see the recordprefix
+ * parameter) instead of running an application under PIN.  Commands are
+ * handed to each core as it refills its queue, so issue is paced by
+ * maxissuepercycle and maxcorequeue exactly as it is for a live run.
+ */
+class ReplayFrontend : public ArielFrontend, public ArielCommandSource {
+    public:
+
+    /* SST ELI */
+    SST_ELI_REGISTER_SUBCOMPONENT(ReplayFrontend, "ariel", "frontend.replay", SST_ELI_ELEMENT_VERSION(1,0,0), "Ariel frontend which replays recorded command streams", SST::ArielComponent::ArielFrontend)
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"verbose", "Verbosity for debugging. Increased numbers for increased verbosity.", "0"},
+        {"replayprefix", "Prefix of the recorded streams, core N is read from <replayprefix>-N.arc", ""})
+
+        /* Ariel class */
+        ReplayFrontend(ComponentId_t id, Params& params, uint32_t cores, uint32_t qSize, uint32_t memPool);
+        ~ReplayFrontend();
+        virtual void init(unsigned int phase) {}
+        virtual ArielTunnel* getTunnel() { return nullptr; }
+        virtual ArielCommandSource* getCommandSource() { return this; }
+
+        virtual bool readCommandNB(uint32_t core, ArielCommand* ac);
+        virtual bool hasWritePayloads() const;
+
+    private:
+        SST::Output* output;
+
+        std::vector<ArielCommandReplayer*> streams;
+        std::vector<bool> exhausted;
+        uint32_t exhaustedCount;
+        bool exitSeen;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,89 @@
+import sst
+import os
+import sys
+
+# Records the stream command stream, or replays a recording of it:
+#   sst recordreplay.py --model-options="record <prefix> [payloads]"
+#   sst recordreplay.py --model-options="replay <prefix> [payloads]"
+
+sst.setProgramOption("timebase", "1ps")
+
+if len(sys.argv) < 3 or sys.argv[1] not in ["record", "replay"]:
+    print("Usage: recordreplay.py record|replay <prefix> [payloads]")
+    sys.exit(1)
+
+mode = sys.argv[1]
+prefix = sys.argv[2]
+payloads = "1" if len(sys.argv) > 3 and sys.argv[3] == "payloads" else "0"
+
+stream_app = os.getenv("ARIEL_TEST_STREAM_APP")
+if stream_app == None:
+    sst_root = os.getenv( "SST_ROOT" )
+    app = sst_root + "/sst-elements/src/sst/elements/ariel/frontend/simple/examples/stream/stream"
+else:
+    app = stream_app
+
+ariel = sst.Component("a0", "ariel.ariel")
+ariel.addParams({
+        "verbose" : "0",
+        "maxcorequeue" : "256",
+        "maxissuepercycle" : "2",
+        "pipetimeout" : "0",
+        "writepayloadtrace" : payloads,
+        })
+
+if mode == "record":
+    ariel.addParams({
+        "executable" : app,
+        "arielmode" : "1",
+        "launchparamcount" : 1,
+        "launchparam0" : "-ifeellucky",
+        "recordprefix" : prefix,
+        })
+else:
+    replay = ariel.setSubComponent("frontend", "ariel.frontend.replay")
+    replay.addParams({
+        "replayprefix" : prefix,
+        })
+
+memmgr = ariel.setSubComponent("memmgr", "ariel.MemoryManagerSimple")
+
+l1cache = sst.Component("l1cache", "memHierarchy.Cache")
+l1cache.addParams({
+        "cache_frequency" : "2 Ghz",
+        "cache_size" : "64 KB",
+        "coherence_protocol" : "MSI",
+        "replacement_policy" : "lru",
+        "associativity" : "8",
+        "access_latency_cycles" : "1",
+        "cache_line_size" : "64",
+        "L1" : "1",
+        "debug" : "0",
+})
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+        "clock" : "1GHz",
+        "backing" : "malloc" if payloads == "1" else "none",
+})
+
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+        "access_time" : "10ns",
+        "mem_size" : "2048MiB",
+})
+
+cpu_cache_link = sst.Link("cpu_cache_link")
+cpu_cache_link.connect( (ariel, "cache_link_0", "50ps"), (l1cache, "high_network_0", "50ps") )
+
+memory_link = sst.Link("mem_bus_link")
+memory_link.connect( (l1cache, "low_network_0", "50ps"), (memctrl, "direct_link", "50ps") )
+
+sst.setStatisticLoadLevel(5)
+sst.setStatisticOutput("sst.statOutputConsole")
+
+ariel.enableStatistics([
+      "instruction_count",
+      "read_requests",
+      "write_requests"
+])
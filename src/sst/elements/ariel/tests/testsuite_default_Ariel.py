@@ -50,6 +50,14 @@ class testcase_Ariel(SSTTestCase):
     @unittest.skipIf(testing_check_get_num_ranks() > 1, "Ariel: test_Ariel_test_snb_mlm skipped if ranks > 1 - Sandy Bridge test is incompatible with Multi-Rank.")
     def test_Ariel_test_snb_mlm(self):
         self.ariel_Template("ariel_snb_mlm", app="stream_mlm")
+
+    @unittest.skipIf(not pin_loaded, "Ariel: Requires PIN, but Env Var 'INTEL_PIN_DIRECTORY' is not found or path does not exist.")
+    def test_Ariel_record_replay(self):
+        self.ariel_record_replay_Template("record_replay")
+
+    @unittest.skipIf(not pin_loaded, "Ariel: Requires PIN, but Env Var 'INTEL_PIN_DIRECTORY' is not found or path does not exist.")
+    def test_Ariel_record_replay_payloads(self):
+        self.ariel_record_replay_Template("record_replay_payloads", payloads=True)
 #####
 
     def ariel_Template(self, testcase, app="", testtimeout=480):
@@ -136,6 +144,53 @@ class testcase_Ariel(SSTTestCase):
 
 #######################
 
+    # Record the stream app, replay the recording and check that the
+    # replay issues exactly the same commands
+    def ariel_record_replay_Template(self, testcase, payloads=False, testtimeout=480):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+        tmpdir = self.get_test_output_tmp_dir()
+
+        ArielElementStreamDir = "{0}/frontend/simple/examples/stream".format(os.path.abspath("{0}/../".format(test_path)))
+        os.environ["ARIEL_TEST_STREAM_APP"] = "{0}/stream".format(ArielElementStreamDir)
+
+        sdlfile = "{0}/recordreplay.py".format(ArielElementStreamDir)
+        prefix = "{0}/test_Ariel_{1}".format(tmpdir, testcase)
+        options = " payloads" if payloads else ""
+
+        stats = {}
+        for mode in ["record", "replay"]:
+            testDataFileName = "test_Ariel_{0}_{1}".format(testcase, mode)
+            outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+            errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+            mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+
+            self.run_sst(sdlfile, outfile, errfile, set_cwd=ArielElementStreamDir,
+                         other_args='--model-options="{0} {1}{2}"'.format(mode, prefix, options),
+                         mpi_out_files=mpioutfiles, timeout_sec=testtimeout)
+
+            cmd = 'grep "FATAL" {0} '.format(outfile)
+            self.assertTrue(os.system(cmd) != 0, "Output file {0} contains the word 'FATAL'...".format(outfile))
+
+            stats[mode] = self._ariel_command_stats(outfile)
+            self.assertTrue(stats[mode].get("instruction_count", 0) > 0, "{0} run in {1} did not execute any instructions".format(mode, outfile))
+
+        self.assertEqual(stats["record"], stats["replay"], "Replayed command counts {0} do not match the recording run {1}".format(stats["replay"], stats["record"]))
+
+    def _ariel_command_stats(self, outfile):
+        stats = {}
+        with open(outfile, 'r') as f:
+            for line in f:
+                fields = [x.strip() for x in line.split(":")]
+                if len(fields) < 3 or not fields[0].startswith("a0."):
+                    continue
+                name = fields[0].split(".")[1]
+                if name in ["instruction_count", "read_requests", "write_requests"]:
+                    for item in fields[2].split(";"):
+                        if item.strip().startswith("Sum."):
+                            stats[name] = stats.get(name, 0) + int(item.split("=")[1])
+        return stats
+
     def _setup_ariel_test_files(self):
         # NOTE: This routine is called a single time at module startup, so it
         #       may have some redunant
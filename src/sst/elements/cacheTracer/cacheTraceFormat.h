@@ -0,0 +1,68 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _CACHETRACEFORMAT_H
+#define _CACHETRACEFORMAT_H
+
+#include <inttypes.h>
+#include <stdio.h>
+
+/*
+ * Binary trace format shared by cacheTracer and sst-cachetracer-decode.
+ * Kept free of SST headers so the decoder can be built standalone.
+ *
+ * File layout: one CacheTraceHeader followed by fixed-size CacheTraceRecords.
+ * When compression is enabled the entire file is a gzip stream.
+ */
+
+namespace SST {
+namespace CACHETRACER {
+
+#define CACHETRACE_MAGIC   "SSTCTRC"
+#define CACHETRACE_VERSION 1
+
+enum CacheTraceDirection { CACHETRACE_NB = 0, CACHETRACE_SB = 1 };
+
+struct CacheTraceHeader {
+    char     magic[8];      // CACHETRACE_MAGIC, null terminated
+    uint32_t version;       // CACHETRACE_VERSION
+    uint32_t recordSize;    // sizeof(CacheTraceRecord), guards against layout changes
+};
+
+struct CacheTraceRecord {
+    uint64_t timestamp;     // tracer clock cycle
+    uint64_t nanoseconds;   // simulated time in ns
+    uint64_t addr;
+    uint64_t id;            // event ID (first)
+    uint64_t responseID;    // response-to ID (first)
+    int32_t  idRank;        // event ID (second)
+    int32_t  responseIDRank; // response-to ID (second)
+    uint32_t latency;       // ns since matching request, southbound responses only
+    uint8_t  direction;     // CacheTraceDirection
+    uint8_t  cmd;           // MemHierarchy::Command
+    uint16_t reserved;
+};
+
+/* Print a record exactly as cacheTracer's text trace does */
+inline void printCacheTraceRecord(FILE* fp, const CacheTraceRecord& rec) {
+    fprintf(fp, "%s: Addr: 0x%" PRIu64 " timestamp: %" PRIu64 " Cmd: %u ID: %" PRIu64 "-%d ResponseID: %" PRIu64 "-%d @%" PRIu64 " ns\n",
+            rec.direction == CACHETRACE_NB ? "NB" : "SB", rec.addr, rec.timestamp, (unsigned int) rec.cmd,
+            rec.id, rec.idRank, rec.responseID, rec.responseIDRank, rec.nanoseconds);
+}
+
+} // namespace CACHETRACER
+} // namespace SST
+
+#endif //_CACHETRACEFORMAT_H
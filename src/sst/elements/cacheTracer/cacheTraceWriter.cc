@@ -0,0 +1,121 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include <cstring>
+
+#include "cacheTraceWriter.h"
+
+using namespace SST;
+using namespace SST::CACHETRACER;
+
+CacheTraceWriter::CacheTraceWriter(Output* out, const std::string& path, size_t bufferBytes, bool compress) :
+    out_(out), path_(path), fill_(0), active_(0), pending_(nullptr), pendingCount_(0), done_(false), closed_(false), file_(nullptr) {
+#ifdef HAVE_LIBZ
+    gzFile_ = nullptr;
+#endif
+
+    capacity_ = bufferBytes / sizeof(CacheTraceRecord);
+    if (capacity_ == 0) capacity_ = 1;
+    buffers_[0].resize(capacity_);
+    buffers_[1].resize(capacity_);
+
+    if (compress) {
+#ifdef HAVE_LIBZ
+        gzFile_ = gzopen(path.c_str(), "wb1");
+        if (gzFile_ == nullptr)
+            out_->fatal(CALL_INFO, -1, "cacheTracer: unable to open compressed trace file %s\n", path.c_str());
+#else
+        out_->fatal(CALL_INFO, -1, "cacheTracer: traceCompress requires SST-Elements to be configured with libz\n");
+#endif
+    } else {
+        file_ = fopen(path.c_str(), "wb");
+        if (file_ == nullptr)
+            out_->fatal(CALL_INFO, -1, "cacheTracer: unable to open trace file %s\n", path.c_str());
+    }
+
+    CacheTraceHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CACHETRACE_MAGIC, sizeof(CACHETRACE_MAGIC)); // 7 characters + null
+    header.version = CACHETRACE_VERSION;
+    header.recordSize = sizeof(CacheTraceRecord);
+    writeOut(&header, sizeof(header));
+
+    thread_ = std::thread(&CacheTraceWriter::run, this);
+}
+
+CacheTraceWriter::~CacheTraceWriter() {
+    close();
+}
+
+/* Wait until the writer thread has taken the previous buffer, then give it this one */
+void CacheTraceWriter::swapBuffers() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cond_.wait(lock, [this]{ return pending_ == nullptr; });
+    pending_ = buffers_[active_].data();
+    pendingCount_ = fill_;
+    lock.unlock();
+    cond_.notify_all();
+
+    active_ ^= 1;
+    fill_ = 0;
+}
+
+void CacheTraceWriter::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        cond_.wait(lock, [this]{ return pending_ != nullptr || done_; });
+        if (pending_ == nullptr) break; // done_ and nothing left to write
+
+        const CacheTraceRecord* data = pending_;
+        size_t count = pendingCount_;
+        lock.unlock();
+        writeOut(data, count * sizeof(CacheTraceRecord));
+        lock.lock();
+
+        pending_ = nullptr;
+        cond_.notify_all();
+    }
+}
+
+void CacheTraceWriter::writeOut(const void* data, size_t bytes) {
+    if (bytes == 0) return;
+#ifdef HAVE_LIBZ
+    if (gzFile_) {
+        gzwrite(gzFile_, data, bytes);
+        return;
+    }
+#endif
+    fwrite(data, 1, bytes, file_);
+}
+
+void CacheTraceWriter::close() {
+    if (closed_) return;
+    closed_ = true;
+
+    if (fill_ != 0) swapBuffers();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        done_ = true;
+    }
+    cond_.notify_all();
+    thread_.join();
+
+#ifdef HAVE_LIBZ
+    if (gzFile_) gzclose(gzFile_);
+#endif
+    if (file_) fclose(file_);
+}
@@ -0,0 +1,85 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _CACHETRACEWRITER_H
+#define _CACHETRACEWRITER_H
+
+#include <sst/core/output.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+
+#include "cacheTraceFormat.h"
+
+namespace SST {
+namespace CACHETRACER {
+
+/*
+ * Buffered writer for binary trace records.
+ * Records are appended to one of two buffers; when the active buffer fills it
+ * is handed to a background thread which writes (and optionally compresses) it
+ * while the simulation keeps filling the other one.
+ */
+class CacheTraceWriter {
+public:
+    CacheTraceWriter(Output* out, const std::string& path, size_t bufferBytes, bool compress);
+    ~CacheTraceWriter();
+
+    void write(const CacheTraceRecord& rec) {
+        if (fill_ == capacity_) swapBuffers();
+        buffers_[active_][fill_++] = rec;
+    }
+
+    void close();   // Flush remaining records and stop the writer thread
+
+private:
+    void swapBuffers();
+    void run();
+    void writeOut(const void* data, size_t bytes);
+
+    Output* out_;
+    std::string path_;
+
+    std::vector<CacheTraceRecord> buffers_[2];
+    size_t capacity_;   // Records per buffer
+    size_t fill_;       // Records in the active buffer
+    int active_;        // Buffer currently being filled
+
+    // Hand-off to the writer thread
+    std::thread thread_;
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    const CacheTraceRecord* pending_;
+    size_t pendingCount_;
+    bool done_;
+    bool closed_;
+
+    FILE* file_;
+#ifdef HAVE_LIBZ
+    gzFile gzFile_;
+#endif
+};
+
+} // namespace CACHETRACER
+} // namespace SST
+
+#endif //_CACHETRACEWRITER_H
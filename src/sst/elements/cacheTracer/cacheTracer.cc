@@ -16,6 +16,8 @@
 #include "sst_config.h"
 #include <cmath>
 
+#include <sst/core/unitAlgebra.h>
+
 #include "cacheTracer.h"
 
 using namespace std;
@@ -50,10 +52,27 @@ cacheTracer::cacheTracer( ComponentId_t id, Params& params ): Component( id ) {
     registerClock( frequency, new Clock::Handler<cacheTracer>(this, &cacheTracer::clock) );
     out->debug(CALL_INFO, 1, 0, "Clock registered\n");
 
+    string traceFormat = params.find<std::string>("traceFormat", "text");
+    if (traceFormat != "text" && traceFormat != "binary") {
+        out->fatal(CALL_INFO, -1, "Invalid param: traceFormat - must be 'text' or 'binary'. You specified '%s'\n", traceFormat.c_str());
+    }
+    writeBinary = (traceFormat == "binary");
+    traceWriter = NULL;
+    traceFile = NULL;
+
     string tracePrefix = params.find<std::string>("tracePrefix", "");
     if("" == tracePrefix){
         out->debug(CALL_INFO, 1, 0, "Tracing Not Enabled.\n");
         writeTrace = false;
+    } else if (writeBinary) {
+        UnitAlgebra bufferSize(params.find<std::string>("traceBufferSize", "4MiB"));
+        if (!bufferSize.hasUnits("B")) {
+            out->fatal(CALL_INFO, -1, "Invalid param: traceBufferSize - must have units of bytes (B). You specified '%s'\n", bufferSize.toString().c_str());
+        }
+        bool compress = params.find<bool>("traceCompress", false);
+        out->output("Writing %sbinary trace to file: %s\n", compress ? "compressed " : "", tracePrefix.c_str());
+        traceWriter = new CacheTraceWriter(out, tracePrefix, bufferSize.getRoundedValue(), compress);
+        writeTrace = true;
     } else {
         out->debug(CALL_INFO, 1, 0, "Tracing is Enabled, prefix is set to %s\n", tracePrefix.c_str());
         char* traceFilePath = (char*) malloc( sizeof(char) * (tracePrefix.size()+ 20) );
@@ -97,7 +116,9 @@ cacheTracer::cacheTracer( ComponentId_t id, Params& params ): Component( id ) {
 } // constructor
 
 // destructor
-cacheTracer::~cacheTracer() {}
+cacheTracer::~cacheTracer() {
+    if (traceWriter) delete traceWriter;
+}
 
 void cacheTracer::init(unsigned int phase) {
     // Since cacheTracer can sit between memH components, it needs to forward init events
@@ -138,15 +159,8 @@ bool cacheTracer::clock(Cycle_t current){
         //InFlightReqQueue[me->getID()] = timestamp;
         InFlightReqQueue[me->getID()] = nanoseconds;
 
-        if(writeDebug_8 & writeTrace){
-             fprintf(traceFile,"NB: Addr: 0x%" PRIu64, addr);
-             fprintf(traceFile, " timestamp: %" PRIu64, timestamp);
-             fprintf(traceFile, " Cmd: %u", me->getCmd());
-             fprintf(traceFile, " ID: %" PRIu64 "-%d", me->getID().first, me->getID().second);
-             fprintf(traceFile, " ResponseID: %" PRIu64 "-%d", me->getResponseToID().first, me->getResponseToID().second);
-             //fprintf(traceFile, " @%" PRIu64, picoseconds);
-             fprintf(traceFile, " @%" PRIu64 " ns", nanoseconds);
-             fprintf(traceFile, "\n");
+        if(writeTrace){
+             TraceEvent(CACHETRACE_NB, me, nanoseconds, 0);
         }
 
         // Send the request to south-bus
@@ -171,6 +185,7 @@ bool cacheTracer::clock(Cycle_t current){
         AddrHist[pageNum]+= 1;
         */
 
+        accessLatency = 0;
         if(InFlightReqQueue.find(me->getResponseToID()) != InFlightReqQueue.end()){
            //accessLatency = timestamp - InFlightReqQueue[me->getResponseToID()];
            accessLatency = nanoseconds - (InFlightReqQueue[me->getResponseToID()]);
@@ -181,15 +196,8 @@ bool cacheTracer::clock(Cycle_t current){
            InFlightReqQueue.erase(me->getResponseToID());
         }
 
-        if(writeDebug_8 & writeTrace){
-             fprintf(traceFile,"SB: Addr: 0x%" PRIu64, me->getAddr());
-             fprintf(traceFile, " timestamp: %" PRIu64, timestamp);
-             fprintf(traceFile, " Cmd: %u", me->getCmd());
-             fprintf(traceFile, " ID: %" PRIu64 "-%d", me->getID().first, me->getID().second);
-             fprintf(traceFile, " ResponseID: %" PRIu64 "-%d", me->getResponseToID().first, me->getResponseToID().second);
-             //fprintf(traceFile, " @%" PRIu64, picoseconds);
-             fprintf(traceFile, " @%" PRIu64 " ns", nanoseconds);
-             fprintf(traceFile, "\n");
+        if(writeTrace){
+             TraceEvent(CACHETRACE_SB, me, nanoseconds, accessLatency);
         }
 
        // Send the request to north-bus
@@ -199,6 +207,27 @@ bool cacheTracer::clock(Cycle_t current){
     return false;
 } //clock
 
+void cacheTracer::TraceEvent(CacheTraceDirection dir, MemEvent* me, uint64_t nanoseconds, unsigned int latency){
+    CacheTraceRecord rec;
+    rec.timestamp = timestamp;
+    rec.nanoseconds = nanoseconds;
+    rec.addr = me->getAddr();
+    rec.id = me->getID().first;
+    rec.idRank = me->getID().second;
+    rec.responseID = me->getResponseToID().first;
+    rec.responseIDRank = me->getResponseToID().second;
+    rec.latency = latency;
+    rec.direction = dir;
+    rec.cmd = (uint8_t) me->getCmd();
+    rec.reserved = 0;
+
+    if (writeBinary) {
+        traceWriter->write(rec);
+    } else if (writeDebug_8) {
+        printCacheTraceRecord(traceFile, rec);
+    }
+}
+
 void cacheTracer::finish(){
     if(stats){
         if(writeStats){
@@ -209,7 +238,11 @@ void cacheTracer::finish(){
         }
     } // if stats()
     if(writeTrace){
-       fclose(traceFile);
+       if (writeBinary) {
+          traceWriter->close();
+       } else {
+          fclose(traceFile);
+       }
     }
 } // finish()
 
@@ -33,6 +33,8 @@
 #include <fstream>
 #include <map>
 
+#include "cacheTraceWriter.h"
+
 using namespace std;
 using namespace SST;
 using namespace SST::MemHierarchy;
@@ -63,7 +65,10 @@ public:
     	{ "debug", "Print debug statements with increasing verbosity [0-10]", "0" },
     	{ "statistics", "0-No-stats, 1-print-stats", "0" },
     	{ "pageSize", "Page Size (bytes), used for selecting number of bins for address histogram ", "4096" },
-    	{"accessLatencyBins", "Number of bins for access latency histogram" "10" }
+    	{"accessLatencyBins", "Number of bins for access latency histogram" "10" },
+    	{ "traceFormat", "Format of the trace file. 'text' - human readable, written when debug >= 8. 'binary' - fixed-size records, always written when tracePrefix is set; convert with sst-cachetracer-decode", "text" },
+    	{ "traceBufferSize", "For binary traces, size of each of the two write buffers. Buffers are written by a background thread", "4MiB" },
+    	{ "traceCompress", "For binary traces, gzip-compress the trace (requires libz)", "0" }
     )
 
     SST_ELI_DOCUMENT_PORTS(
@@ -77,10 +82,12 @@ private:
     void FinalStats(FILE*, unsigned int);
     void PrintAddrHistogram(FILE*, vector<SST::MemHierarchy::Addr>);
     void PrintAccessLatencyDistribution(FILE*, unsigned int);
+    void TraceEvent(CacheTraceDirection, MemEvent*, uint64_t, unsigned int);
 
     Output* out;
     FILE* traceFile;
     FILE* statsFile;
+    CacheTraceWriter* traceWriter;
 
     // Links
     SST::Link *northBus;
@@ -93,6 +100,7 @@ private:
 
     // Flags
     bool writeTrace;
+    bool writeBinary;
     bool writeStats;
     bool writeDebug_8;
 
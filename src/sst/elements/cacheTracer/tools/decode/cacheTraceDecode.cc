@@ -0,0 +1,112 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+/*
+ * sst-cachetracer-decode: convert a binary cacheTracer trace
+ * (traceFormat=binary) into the text trace format.
+ *
+ * Usage: sst-cachetracer-decode <binary trace> [text output]
+ */
+
+#include "sst_config.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+
+#include "sst/elements/cacheTracer/cacheTraceFormat.h"
+
+using namespace SST::CACHETRACER;
+
+#ifdef HAVE_LIBZ
+/* gzread handles both compressed and uncompressed files */
+typedef gzFile trace_file_t;
+static trace_file_t open_trace(const char* path) { return gzopen(path, "rb"); }
+static size_t read_trace(trace_file_t f, void* buffer, size_t bytes) {
+    int result = gzread(f, buffer, bytes);
+    return result < 0 ? 0 : (size_t) result;
+}
+static void close_trace(trace_file_t f) { gzclose(f); }
+#else
+typedef FILE* trace_file_t;
+static trace_file_t open_trace(const char* path) { return fopen(path, "rb"); }
+static size_t read_trace(trace_file_t f, void* buffer, size_t bytes) { return fread(buffer, 1, bytes, f); }
+static void close_trace(trace_file_t f) { fclose(f); }
+#endif
+
+int
+main(int argc, char* argv[]) {
+    if (argc < 2 || argc > 3) {
+        fprintf(stderr, "Usage: %s <binary trace> [text output]\n", argv[0]);
+        return -1;
+    }
+
+    trace_file_t input = open_trace(argv[1]);
+    if (!input) {
+        fprintf(stderr, "Error: unable to open %s\n", argv[1]);
+        return -1;
+    }
+
+    FILE* output = stdout;
+    if (argc == 3) {
+        output = fopen(argv[2], "wt");
+        if (!output) {
+            fprintf(stderr, "Error: unable to open %s for writing\n", argv[2]);
+            close_trace(input);
+            return -1;
+        }
+    }
+
+    CacheTraceHeader header;
+    if (read_trace(input, &header, sizeof(header)) != sizeof(header) ||
+            strncmp(header.magic, CACHETRACE_MAGIC, sizeof(header.magic)) != 0) {
+        fprintf(stderr, "Error: %s is not a cacheTracer binary trace\n", argv[1]);
+        close_trace(input);
+        return -1;
+    }
+    if (header.version != CACHETRACE_VERSION || header.recordSize != sizeof(CacheTraceRecord)) {
+        fprintf(stderr, "Error: %s has trace version %u (record size %u), this decoder reads version %u (record size %u)\n",
+                argv[1], header.version, header.recordSize, CACHETRACE_VERSION, (unsigned int) sizeof(CacheTraceRecord));
+        close_trace(input);
+        return -1;
+    }
+
+    const size_t batch = 4096;
+    CacheTraceRecord* records = (CacheTraceRecord*) malloc(sizeof(CacheTraceRecord) * batch);
+    uint64_t count = 0;
+    size_t bytes;
+    while ((bytes = read_trace(input, records, sizeof(CacheTraceRecord) * batch)) > 0) {
+        size_t n = bytes / sizeof(CacheTraceRecord);
+        for (size_t i = 0; i < n; i++) {
+            printCacheTraceRecord(output, records[i]);
+        }
+        count += n;
+        if (bytes % sizeof(CacheTraceRecord) != 0) {
+            fprintf(stderr, "Warning: trace ends with a partial record\n");
+            break;
+        }
+    }
+
+    free(records);
+    close_trace(input);
+    if (output != stdout) fclose(output);
+
+    fprintf(stderr, "Decoded %" PRIu64 " records\n", count);
+    return 0;
+}
@@ -31,13 +31,16 @@ EmberEngine::EmberEngine(SST::ComponentId_t id, SST::Params& params) :
     Component( id ),
 	currentMotif(0),
 	m_motifDone(false),
-	m_detailedCompute(NULL)
+	m_detailedCompute(NULL),
+	m_eventCount(0)
 {
 	// Get the level of verbosity the user is asking to print out, default is 1
 	// which means don't print much.
 	uint32_t verbosity = (uint32_t) params.find("verbose", 1);
 	uint32_t mask = (uint32_t) params.find("verboseMask", 0);
 	m_jobId = params.find("jobId", -1);
+	m_maxInlineEvents = params.find<uint32_t>("max_inline_events", 0);
+	m_reportEventRate = params.find<bool>("report_event_rate", false);
 
 
 	std::ostringstream prefix;
@@ -220,6 +223,12 @@ void EmberEngine::finish() {
     }
 
 	m_os->finish();
+
+    if ( m_reportEventRate ) {
+        double secs = std::chrono::duration<double>( std::chrono::steady_clock::now() - m_startTime ).count();
+        output.output("EmberEngine job %d rank %d: %" PRIu64 " events in %.3f s, %.0f events/sec\n",
+                m_jobId, m_os->getRank(), m_eventCount, secs, secs > 0 ? m_eventCount / secs : 0.0 );
+    }
 }
 
 void EmberEngine::setup() {
@@ -243,13 +252,13 @@ void EmberEngine::setup() {
         m_motifLogger->setRank(m_os->getRank());
     }
 
+    m_startTime = std::chrono::steady_clock::now();
+
 	// Prime the event queue
 	issueNextEvent(0);
 }
 
-void EmberEngine::issueNextEvent(uint64_t nanoDelay) {
-
-    output.debug(CALL_INFO, 8, ENGINE_MASK, "Engine issuing next event with delay %" PRIu64 "\n", nanoDelay);
+EmberEvent* EmberEngine::nextEvent() {
 
     while ( evQueue.empty() ) {
 
@@ -270,7 +279,7 @@ void EmberEngine::issueNextEvent(uint64_t nanoDelay) {
             delete m_generator;
 
             if ( ++currentMotif == motifParams.size() ) {
-                return;
+                return NULL;
             } else {
                 m_generator = initMotif( motifParams[currentMotif],
 								m_apiMap, m_jobId, currentMotif, m_nodePerf );
@@ -287,11 +296,42 @@ void EmberEngine::issueNextEvent(uint64_t nanoDelay) {
 
 	EmberEvent* nextEv = evQueue.front();
 	evQueue.pop();
+    return nextEv;
+}
+
+void EmberEngine::issueNextEvent(uint64_t nanoDelay) {
+
+    output.debug(CALL_INFO, 8, ENGINE_MASK, "Engine issuing next event with delay %" PRIu64 "\n", nanoDelay);
+
+	EmberEvent* nextEv = nextEvent();
+    if ( NULL == nextEv ) {
+        return;
+    }
 
 	// issue the next event to the engine for deliver later
 	selfEventLink->send(nanoDelay, nanoTimeConverter, nextEv);
 }
 
+EmberEvent* EmberEngine::issueNextEventInline( bool allowInline ) {
+
+    output.debug(CALL_INFO, 8, ENGINE_MASK, "Engine issuing next event, inline=%d\n", allowInline);
+
+	EmberEvent* nextEv = nextEvent();
+    if ( NULL == nextEv ) {
+        return NULL;
+    }
+
+    // Only events that are handled entirely by the engine run inline.
+    // Anything that calls into an API goes through the link so the
+    // API is never re-entered from its own completion path.
+    if ( allowInline && nextEv->state() == EmberEvent::Issue ) {
+        return nextEv;
+    }
+
+	selfEventLink->send(0, nanoTimeConverter, nextEv);
+    return NULL;
+}
+
 bool EmberEngine::completeFunctor( int retval, EmberEvent* ev )
 {
     output.debug(CALL_INFO, 2, ENGINE_MASK, "%s %s Event\n",
@@ -312,30 +352,55 @@ void EmberEngine::handleEvent(Event* ev) {
 	// handlers we have created
 	EmberEvent* eEv = static_cast<EmberEvent*>(ev);
 
+    // Zero-delay events that follow are executed here rather than
+    // being scheduled, up to a limit so other components still get
+    // to run at this time
+    uint32_t numInline = 0;
+    while ( eEv ) {
+        eEv = dispatchEvent( eEv, numInline < m_maxInlineEvents );
+        ++numInline;
+    }
+}
+
+EmberEvent* EmberEngine::dispatchEvent( EmberEvent* eEv, bool allowInline ) {
+
     output.debug(CALL_INFO, 2, ENGINE_MASK, "%s %s Event\n",
               eEv->stateName( eEv->state() ).c_str(), eEv->getName().c_str());
 
     switch ( eEv->state() ) {
       case EmberEvent::Issue:
-
+        {
+        ++m_eventCount;
         eEv->issue( getCurrentSimTimeNano() );
 
-	    selfEventLink->send( eEv->completeDelayNS() * 1000, ev );
+        uint64_t delay = eEv->completeDelayNS();
+        if ( 0 == delay && allowInline ) {
+            if ( eEv->complete( getCurrentSimTimeNano() ) ) {
+                delete eEv;
+            }
+            return issueNextEventInline( allowInline );
+        }
+
+	    selfEventLink->send( delay * 1000, eEv );
+        }
         break;
 
       case EmberEvent::IssueFunctor:
+        ++m_eventCount;
         eEv->issue( getCurrentSimTimeNano(),
                 new ArgStatic_Functor< EmberEngine, int, EmberEvent*, bool >(
                             this, &EmberEngine::completeFunctor, eEv ) );
         break;
 
       case EmberEvent::IssueCallback:
+        ++m_eventCount;
         eEv->issue( getCurrentSimTimeNano(),
                     std::bind( &EmberEngine::completeCallback, this, eEv, std::placeholders::_1 ) );
         break;
 
       case EmberEvent::IssueCallbackPtr:
 		{
+		    ++m_eventCount;
 		    Callback* callback = new Callback;
 		    *callback = std::bind( &EmberEngine::completeCallback, this, eEv, std::placeholders::_1 );
             eEv->issue( getCurrentSimTimeNano(), callback );
@@ -344,11 +409,11 @@ void EmberEngine::handleEvent(Event* ev) {
 
       case EmberEvent::Complete:
         if ( eEv->complete( getCurrentSimTimeNano() ) ) {
-            delete ev;
+            delete eEv;
         }
-	    issueNextEvent(0);
-        break;
+	    return issueNextEventInline( allowInline );
     }
+    return NULL;
 }
 
 EmberEngine::EmberEngine() :
@@ -17,6 +17,7 @@
 #ifndef _H_EMBER_ENGINE
 #define _H_EMBER_ENGINE
 
+#include <chrono>
 #include <queue>
 
 #include <sst/core/sst_types.h>
@@ -54,6 +55,8 @@ public:
         { "motif_count", "Sets the number of motifs which will be run in this simulation, default is 1", "1"},
         { "rankmapper", "Sets the rank mapping SST module to load to rank translations, default is linear mapping", "ember.LinearMap" },
         { "mapFile", "Sets the name of the input file for custom map", "mapFile.txt" },
+        { "max_inline_events", "Sets the number of zero-delay events that are executed back to back in one handler call instead of being scheduled, 0 = always schedule", "0" },
+        { "report_event_rate", "Print the number of events issued and the wall clock event rate at the end of simulation", "false" },
 
         { "motif%(motif_count)d", "Sets the event generator or motif for the engine", "ember.EmberPingPongGenerator" },
     )
@@ -114,7 +117,10 @@ private:
     }
 
 	void handleEvent(SST::Event* ev);
+	EmberEvent* dispatchEvent(EmberEvent* ev, bool allowInline);
+	EmberEvent* nextEvent();
 	void issueNextEvent(uint64_t nanoSecDelay);
+	EmberEvent* issueNextEventInline(bool allowInline);
 
     void completeCallback( EmberEvent* ev, int retval ) {
         completeFunctor(retval, ev);
@@ -152,6 +158,11 @@ private:
 	Thornhill::DetailedCompute* m_detailedCompute;
 	Thornhill::MemoryHeapLink*  m_memHeapLink;
 
+	uint32_t    m_maxInlineEvents;
+	bool        m_reportEventRate;
+	uint64_t    m_eventCount;
+	std::chrono::steady_clock::time_point m_startTime;
+
 	EmberEngine();			    		// For serialization
 	EmberEngine(const EmberEngine&);    // Do not implement
 	void operator=(const EmberEngine&); // Do not implement
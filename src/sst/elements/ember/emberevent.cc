@@ -16,6 +16,9 @@
 #include <sst_config.h>
 #include "emberevent.h"
 
+#include <new>
+#include <vector>
+
 using namespace SST;
 using namespace Ember;
 
@@ -23,3 +26,59 @@ const char* EmberEvent::m_enumName[] = {
     FOREACH_ENUM(GENERATE_STRING)
 };
 
+namespace {
+
+// Event sizes are rounded up to the granularity; anything larger than
+// maxPooledSize goes straight to the heap
+const std::size_t poolGranularity = 16;
+const std::size_t maxPooledSize = 1024;
+
+struct EventFreeLists {
+    std::vector<void*> lists[ maxPooledSize / poolGranularity + 1 ];
+};
+
+// An engine and its events stay on one thread, so the lists need no
+// locking.  The lists are never destroyed so events deleted late in
+// shutdown still have somewhere to go.
+thread_local EventFreeLists* freeLists = NULL;
+
+}
+
+void* EmberEvent::operator new( std::size_t size )
+{
+    if ( size > maxPooledSize ) {
+        return ::operator new( size );
+    }
+
+    if ( NULL == freeLists ) {
+        freeLists = new EventFreeLists;
+    }
+
+    std::size_t index = ( size + poolGranularity - 1 ) / poolGranularity;
+    std::vector<void*>& list = freeLists->lists[index];
+    if ( list.empty() ) {
+        return ::operator new( index * poolGranularity );
+    }
+
+    void* ptr = list.back();
+    list.pop_back();
+    return ptr;
+}
+
+void EmberEvent::operator delete( void* ptr, std::size_t size )
+{
+    if ( NULL == ptr ) {
+        return;
+    }
+
+    if ( size > maxPooledSize ) {
+        ::operator delete( ptr );
+        return;
+    }
+
+    if ( NULL == freeLists ) {
+        freeLists = new EventFreeLists;
+    }
+
+    freeLists->lists[ ( size + poolGranularity - 1 ) / poolGranularity ].push_back( ptr );
+}
@@ -17,6 +17,8 @@
 #ifndef _H_EMBER_EVENT
 #define _H_EMBER_EVENT
 
+#include <cstddef>
+
 #include <sst/core/event.h>
 #include <sst/core/statapi/statbase.h>
 #include <sst/elements/hermes/msgapi.h>
@@ -61,6 +63,12 @@ public:
         m_state(Issue), m_output(NULL), m_evStat(NULL), m_completeDelayNS(0), m_retvalPtr(NULL) {}
 	~EmberEvent() {}
 
+    // Motifs create and destroy an event for every operation, so freed
+    // events are kept on per-size free lists and reused.  Each event
+    // type has its own size, so in practice every list holds one type.
+    static void* operator new( std::size_t size );
+    static void operator delete( void* ptr, std::size_t size );
+
 	virtual std::string getName() { return "?????"; };
 
     State state() { return m_state; }
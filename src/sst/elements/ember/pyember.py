@@ -32,7 +32,7 @@ class EmberJob(Job):
 
         # Not sure what to do with this yet
         #x = self._createPrefixedParams("ember")
-        self._declareParamsWithUserPrefix("ember","ember",["verbose"])
+        self._declareParamsWithUserPrefix("ember","ember",["verbose","max_inline_events","report_event_rate"])
         #x._subscribeToPlatformParamSet("ember")
 
         # Not clear what to do with this yet. Don't think we need it
@@ -0,0 +1,84 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2024 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2024, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+# Measures how fast the EmberEngine can issue events.  Runs a message
+# rate motif with many small messages between two nodes on a single
+# router and has every engine report events/sec of wall clock time at
+# the end of simulation.
+#
+#   sst motifThroughput.py
+#   sst motifThroughput.py -- --inline=0 --msgs=1000 --iterations=100
+
+import sys
+import getopt
+
+import sst
+from sst.merlin.base import *
+from sst.merlin.endpoint import *
+from sst.merlin.interface import *
+from sst.merlin.topology import *
+
+from sst.ember import *
+
+if __name__ == "__main__":
+
+    maxInline = 64
+    numMsgs = 1000
+    iterations = 100
+
+    opts, args = getopt.getopt(sys.argv[1:], "", ["inline=","msgs=","iterations="])
+    for o, a in opts:
+        if o == "--inline":
+            maxInline = int(a)
+        elif o == "--msgs":
+            numMsgs = int(a)
+        elif o == "--iterations":
+            iterations = int(a)
+
+    PlatformDefinition.setCurrentPlatform("firefly-defaults")
+
+    topo = topoSingle()
+    topo.num_ports = 2
+    topo.link_latency = "20ns"
+
+    router = hr_router()
+    router.link_bw = "4GB/s"
+    router.flit_size = "8B"
+    router.xbar_bw = "6GB/s"
+    router.input_latency = "20ns"
+    router.output_latency = "20ns"
+    router.input_buf_size = "4kB"
+    router.output_buf_size = "4kB"
+    router.num_vns = 2
+    router.xbar_arb = "merlin.xbar_arb_lru"
+    topo.router = router
+
+    networkif = ReorderLinkControl()
+    networkif.link_bw = "4GB/s"
+    networkif.input_buf_size = "1kB"
+    networkif.output_buf_size = "1kB"
+
+    ep = EmberMPIJob(0,topo.getNumNodes())
+    ep.network_interface = networkif
+    ep.ember.max_inline_events = maxInline
+    ep.ember.report_event_rate = True
+    ep.addMotif("Init")
+    ep.addMotif("MsgRate msgSize=0 numMsgs=%d iterations=%d"%(numMsgs,iterations))
+    ep.addMotif("Fini")
+    ep.nic.nic2host_lat= "100ns"
+
+    system = System()
+    system.setTopology(topo)
+    system.allocateNodes(ep,"linear")
+
+    system.build()
@@ -138,7 +138,7 @@ gensa::init (unsigned int phase)
             float leak = 1 - atof(piece);  // The parameter in the file is the portion of voltage to get rid of each cycle. It's simpler for us to compute with (1-decay).
             piece = strtok(0, ",");  // Actually, there should only be one piece left, with no more commas.
             float p = atof(piece);
-            n = neurons[id] = new NeuronLIF(Vinit, Vthreshold, Vreset, leak, p);
+            n = neurons[id] = new NeuronLIF(&population, Vinit, Vthreshold, Vreset, leak, p);
         } else {
             n = neurons[id] = new NeuronInput();
         }
@@ -224,6 +224,8 @@ gensa::init (unsigned int phase)
     ifs.open (modelPath.c_str());
     assert(sizeof(Synapse) == 8);
     uint64_t startAddr = 0x10000;
+    uint32_t minDelay  = UINT32_MAX;
+    uint32_t maxDelay  = 0;
     while (ifs.good()) {
         getline(ifs, line);
         if (line.empty()) break;
@@ -249,7 +251,11 @@ gensa::init (unsigned int phase)
             piece = strtok(0, ",");
             float weight = atof(piece);
             piece = strtok(0, ",");
-            int delay = atoi(piece);
+            long delay = strtol(piece, 0, 10);
+            // Synapse stores delay in 16 bits
+            if (delay < 0  ||  delay > UINT16_MAX) out.fatal (CALL_INFO, -1, "Invalid synapse delay %ld for neuron %d. Must be in [0,%d]\n", delay, id, UINT16_MAX);
+            if ((uint32_t) delay < minDelay) minDelay = delay;
+            if ((uint32_t) delay > maxDelay) maxDelay = delay;
 
             if (n->synapseBase == 0)
             {
@@ -269,6 +275,9 @@ gensa::init (unsigned int phase)
         }
     }
 
+    population.finalize (minDelay, maxDelay);
+    if (! population.bulk) out.verbose (CALL_INFO, 2, 0, "Model has zero-delay synapses; updating neurons individually\n");
+
     int numNeurons = neurons.size ();
     printf("Constructed %d neurons with %d links\n", numNeurons, countLinks);
 }
@@ -336,6 +345,8 @@ gensa::clockTic (Cycle_t t)
         syncSent = false;  // Although this is a wasted operation most of the time, it's the simplest way to reset sync state.
 
         neuronIndex++;
+        // Compute the whole step at once. Each neuron is still visited below, one per cycle, so timing is unchanged.
+        if (neuronIndex == 0  &&  population.bulk) population.update (now);
         if (neuronIndex < count)
         {
             Neuron * n = neurons[neuronIndex];
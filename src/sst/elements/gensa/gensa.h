@@ -75,6 +75,7 @@ public:
     uint32_t    maxRequestDepth; ///< Shared by memory and network. Should be a pretty small number like 2 or 3.
 
     std::vector<Neuron*> neurons;
+    NeuronPopulation     population;  ///< Storage and bulk update for all LIF neurons in "neurons"
 
     TimeConverter *             clockTC;
     Interfaces::StandardMem *   memory;
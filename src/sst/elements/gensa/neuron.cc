@@ -17,6 +17,8 @@
 #include <sst_config.h>
 #include "neuron.h"
 
+#include <algorithm>
+
 using namespace SST::gensaComponent;
 using namespace std;
 
@@ -61,56 +63,142 @@ void Neuron::deliverSpike(float str, uint when)
     // Do nothing
 }
 
+void Neuron::trace(const uint now, bool spiked, float V)
+{
+    Trace * t = traces;
+    while (t) {
+        if (t->probe == 0) {
+            if (spiked) t->holder->trace (now*dt, t->column, 1, t->mode);
+        } else if (t->probe == 1) {
+            t->holder->trace(now*dt, t->column, V, t->mode);
+        }
+        t = t->next;
+    }
+}
 
-// NeuronLIF -----------------------------------------------------------------
 
-SST::RNG::MarsagliaRNG NeuronLIF::rng(1,13);
+// NeuronPopulation ----------------------------------------------------------
 
-NeuronLIF::NeuronLIF(float Vinit, float Vthreshold, float Vreset, float leak, float p)
-:   V          (Vinit),
-    Vthreshold (Vthreshold),
-    Vreset     (Vreset),
-    leak       (leak),
-    p          (p)
+NeuronPopulation::NeuronPopulation()
+:   rng(1,13)
 {
+    depthMask = 0;
+    count     = 0;
+    bulk      = false;
 }
 
-void NeuronLIF::deliverSpike(float str, uint when)
+uint32_t NeuronPopulation::add(float Vinit, float Vthreshold, float Vreset, float leak, float p)
 {
-    temporalBuffer[when] += str;
+    V               .push_back(Vinit);
+    this->Vthreshold.push_back(Vthreshold);
+    this->Vreset    .push_back(Vreset);
+    this->leak      .push_back(leak);
+    this->p         .push_back(p);
+    certain         .push_back(p >= 1);
+    fired           .push_back(0);
+    nextStep        .push_back(0);
+    if (p > 0  &&  p < 1) stochastic.push_back(count);
+    return count++;
 }
 
-bool NeuronLIF::update(const uint now)
+void NeuronPopulation::finalize(uint32_t minDelay, uint32_t maxDelay)
 {
-    // Add inputs
-    temporalBuffer_t::iterator i = temporalBuffer.find(now);
-    if (i != temporalBuffer.end()) {
-        V += i->second;
-        temporalBuffer.erase(i);
+    // One slot per possible delay, plus the current step. Power of 2 so slot selection is a mask.
+    uint32_t depth = 1;
+    while (depth <= maxDelay) depth <<= 1;
+    depthMask = depth - 1;
+    temporalBuffer.assign((size_t) depth * count, 0);
+
+    // A zero-delay spike can arrive in the middle of a step, after some neurons have already
+    // been updated. Only when that is impossible can the whole step be computed up front.
+    bulk = minDelay >= 1;
+}
+
+void NeuronPopulation::deliverSpike(uint32_t i, float str, uint32_t when)
+{
+    if (when < nextStep[i]) return;  // That step was already consumed, so this input can never be seen.
+    temporalBuffer[(size_t) (when & depthMask) * count + i] += str;
+}
+
+void NeuronPopulation::update(const uint32_t now)
+{
+    float *   __restrict in    = &temporalBuffer[(size_t) (now & depthMask) * count];
+    float *   __restrict v     = V.data();
+    const float *   __restrict th    = Vthreshold.data();
+    const float *   __restrict reset = Vreset.data();
+    const float *   __restrict l     = leak.data();
+    const uint8_t * __restrict c     = certain.data();
+    uint8_t * __restrict f     = fired.data();
+
+    // Add inputs and check for spike. Over-threshold neurons that need a random draw are marked with 2.
+    for (uint32_t i = 0; i < count; i++) {
+        float   x    = v[i] + in[i];
+        uint8_t over = x > th[i];
+        in[i] = 0;
+        v[i]  = over ? (c[i] ? reset[i] : x) : x * l[i];
+        f[i]  = over ? (c[i] ? 1 : 2) : 0;
+    }
+
+    // Random draws, in neuron order so the sequence matches a serial update.
+    for (uint32_t i : stochastic) {
+        if (f[i] != 2) continue;
+        f[i] = 0;
+        if (rng.nextUniform() <= p[i]) {
+            v[i] = reset[i];
+            f[i] = 1;
+        }
     }
 
+    // Anything still marked 2 has p <= 0 and can never fire.
+    for (uint32_t i = 0; i < count; i++) f[i] &= 1;
+
+    std::fill(nextStep.begin(), nextStep.end(), now + 1);
+}
+
+bool NeuronPopulation::updateOne(uint32_t i, const uint32_t now)
+{
+    // Add inputs
+    float & in = temporalBuffer[(size_t) (now & depthMask) * count + i];
+    V[i] += in;
+    in = 0;
+    nextStep[i] = now + 1;
+
     // Check for spike
     bool spiked = false;
-    if (V > Vthreshold) {
-        if (p >= 1  ||  p > 0  &&  rng.nextUniform() <= p) {
-            V = Vreset;
+    if (V[i] > Vthreshold[i]) {
+        if (p[i] >= 1  ||  p[i] > 0  &&  rng.nextUniform() <= p[i]) {
+            V[i] = Vreset[i];
             spiked = true;
         }
     } else {
-        V *= leak;
+        V[i] *= leak[i];
     }
+    fired[i] = spiked;
+    return spiked;
+}
 
-    // Outputs
-    Trace * t = traces;
-    while (t) {
-        if (t->probe == 0) {
-            if (spiked) t->holder->trace (now*dt, t->column, 1, t->mode);
-        } else if (t->probe == 1) {
-            t->holder->trace(now*dt, t->column, V, t->mode);
-        }
-        t = t->next;
-    }
 
+// NeuronLIF -----------------------------------------------------------------
+
+NeuronLIF::NeuronLIF(NeuronPopulation * population, float Vinit, float Vthreshold, float Vreset, float leak, float p)
+:   population (population)
+{
+    slot = population->add(Vinit, Vthreshold, Vreset, leak, p);
+}
+
+void NeuronLIF::deliverSpike(float str, uint when)
+{
+    population->deliverSpike(slot, str, when);
+}
+
+bool NeuronLIF::update(const uint now)
+{
+    // In bulk mode the population has already computed this step; we only report it.
+    bool spiked;
+    if (population->bulk) spiked = population->fired[slot];
+    else                  spiked = population->updateOne(slot, now);
+
+    trace(now, spiked, population->V[slot]);
     return spiked;
 }
 
@@ -17,6 +17,7 @@
 #define _NEURON_H
 
 #include <map>
+#include <vector>
 #include <cstdint>
 
 #include <sst/core/interfaces/stdMem.h>  // supplies type uint
@@ -59,23 +60,53 @@ public:
 
     virtual void deliverSpike(float str, uint32_t when);
     virtual bool update      (const uint32_t now) = 0;  ///< performs Leaky Integrate and Fire. Returns true if fired.
+
+    void trace(const uint32_t now, bool spiked, float V);  ///< Emit configured outputs for this step.
 };
 
-class NeuronLIF : public Neuron {
+/**
+    Structure-of-arrays storage for all LIF neurons in a core.
+    State lives in contiguous float arrays and future input is held in a ring of
+    per-delay slots, so one time step can be computed over the whole population
+    with simple branch-free loops. The RNG is consumed in neuron order, exactly as
+    when neurons are updated one at a time.
+**/
+class NeuronPopulation {
 public:
-    float V;          // "voltage"; generally in the normal range [0,1]
-    float Vthreshold; // value of V which triggers a spike
-    float Vreset;     // value of V immediately after a spike
-    float leak;       // fraction of V to retain after present cycle, in [0,1]
-    float p;          // probability of firing when over threshold, in [0,1]
-
-    static SST::RNG::MarsagliaRNG rng;
+    std::vector<float>    V;          // "voltage"; generally in the normal range [0,1]
+    std::vector<float>    Vthreshold; // value of V which triggers a spike
+    std::vector<float>    Vreset;     // value of V immediately after a spike
+    std::vector<float>    leak;       // fraction of V to retain after present cycle, in [0,1]
+    std::vector<float>    p;          // probability of firing when over threshold, in [0,1]
+    std::vector<uint8_t>  certain;    // 1 if p >= 1, so firing needs no random draw
+    std::vector<uint8_t>  fired;      // result of the most recent update of each neuron
+    std::vector<uint32_t> stochastic; // indices with 0 < p < 1, in ascending order
+    std::vector<uint32_t> nextStep;   // first step whose input has not yet been consumed, per neuron
+
+    // temporal buffer: depth slots of count floats, slot chosen by (when & depthMask)
+    std::vector<float> temporalBuffer;
+    uint32_t depthMask;
+    uint32_t count;
+    bool     bulk;  // whole-population update is safe (every synapse delay >= 1)
+
+    SST::RNG::MarsagliaRNG rng;  // one stream per component, so results do not depend on how many cores share a process
+
+    NeuronPopulation();
+
+    uint32_t add     (float Vinit, float Vthreshold, float Vreset, float leak, float p);  ///< Returns slot index of new neuron
+    void     finalize(uint32_t minDelay, uint32_t maxDelay);  ///< Size temporal buffer once all synapses are known
+
+    void deliverSpike(uint32_t i, float str, uint32_t when);
+    void update      (const uint32_t now);                ///< Updates every neuron for step "now"
+    bool updateOne   (uint32_t i, const uint32_t now);    ///< Updates a single neuron. Used when bulk update is not safe.
+};
 
-    // temporal buffer
-    typedef std::map<const uint, float> temporalBuffer_t;
-    temporalBuffer_t temporalBuffer;
+class NeuronLIF : public Neuron {
+public:
+    NeuronPopulation * population;
+    uint32_t           slot;  // index into population arrays
 
-    NeuronLIF (float Vinit = 0, float Vthreshold = 1, float Vreset = 0, float leak = 1, float p = 1);
+    NeuronLIF (NeuronPopulation * population, float Vinit = 0, float Vthreshold = 1, float Vreset = 0, float leak = 1, float p = 1);
 
     virtual void deliverSpike(float str, uint32_t when);
     virtual bool update      (const uint32_t now);
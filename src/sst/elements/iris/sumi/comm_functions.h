@@ -45,6 +45,7 @@ Questions? Contact sst-macro-help@sandia.gov
 #pragma once
 
 #include <functional>
+#include <type_traits>
 
 namespace SST::Iris::sumi {
 
@@ -136,7 +137,8 @@ struct Or
   typedef data_t type;
   static void
   op(data_t& dst, const data_t& src){
-    dst = dst || src;
+    // Branch-free form of dst || src so the reduction loop vectorizes
+    dst = bool(dst) | bool(src);
   }
 };
 
@@ -163,10 +165,88 @@ struct And
   typedef data_t type;
   static void
   op(data_t& dst, const data_t& src){
-    dst = dst && src;
+    // Branch-free form of dst && src so the reduction loop vectorizes
+    dst = bool(dst) & bool(src);
   }
 };
 
+/**
+ * Element-wise reduction kernels. The element loop is compiled with loop
+ * vectorization enabled (GCC only turns on its cheapest cost model at -O2,
+ * which rejects loops that need a runtime overlap check between dst and
+ * src). On x86-64 with GCC/Clang the loop is also compiled for AVX2 and
+ * AVX-512, and the widest one the host supports is picked once at startup.
+ * Each element is still combined by the same Fxn<data_t>::op, so results
+ * do not depend on the kernel chosen.
+ */
+namespace reduce_kernels {
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define SUMI_REDUCE_MULTI_ISA 1
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__)
+#define SUMI_REDUCE_VECTORIZE __attribute__((optimize("tree-vectorize","vect-cost-model=dynamic")))
+#else
+#define SUMI_REDUCE_VECTORIZE
+#endif
+
+enum isa_t { scalar = 0, avx2 = 1, avx512 = 2 };
+
+inline isa_t detect(){
+#ifdef SUMI_REDUCE_MULTI_ISA
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) return avx512;
+  if (__builtin_cpu_supports("avx2")) return avx2;
+#endif
+  return scalar;
+}
+
+inline const isa_t host_isa = detect();
+
+template <template <typename> class Fxn, typename data_t>
+inline __attribute__((always_inline)) void
+loop(data_t* dst, const data_t* src, int nelems){
+  for (int i=0; i < nelems; ++i){
+    Fxn<data_t>::op(dst[i], src[i]);
+  }
+}
+
+template <template <typename> class Fxn, typename data_t>
+SUMI_REDUCE_VECTORIZE void
+run_scalar(data_t* dst, const data_t* src, int nelems){
+  loop<Fxn,data_t>(dst, src, nelems);
+}
+
+#ifdef SUMI_REDUCE_MULTI_ISA
+template <template <typename> class Fxn, typename data_t>
+SUMI_REDUCE_VECTORIZE __attribute__((target("avx2"))) void
+run_avx2(data_t* dst, const data_t* src, int nelems){
+  loop<Fxn,data_t>(dst, src, nelems);
+}
+
+template <template <typename> class Fxn, typename data_t>
+SUMI_REDUCE_VECTORIZE __attribute__((target("avx512f,avx512bw"))) void
+run_avx512(data_t* dst, const data_t* src, int nelems){
+  loop<Fxn,data_t>(dst, src, nelems);
+}
+#endif
+
+template <template <typename> class Fxn, typename data_t>
+inline void
+run(isa_t isa, data_t* dst, const data_t* src, int nelems){
+#ifdef SUMI_REDUCE_MULTI_ISA
+  switch (isa){
+    case avx512: run_avx512<Fxn,data_t>(dst, src, nelems); return;
+    case avx2: run_avx2<Fxn,data_t>(dst, src, nelems); return;
+    default: break;
+  }
+#endif
+  run_scalar<Fxn,data_t>(dst, src, nelems);
+}
+
+}
+
 template <template <typename> class Fxn, typename data_t>
 struct ReduceOp
 {
@@ -174,8 +254,12 @@ struct ReduceOp
   op(void* dst_buffer, const void* src_buffer, int nelems){
     data_t* dst = reinterpret_cast<data_t*>(dst_buffer);
     const data_t* src = reinterpret_cast<const data_t*>(src_buffer);
-    for (int i=0; i < nelems; ++i, ++src, ++dst){
+    if constexpr (std::is_arithmetic<data_t>::value){
+      reduce_kernels::run<Fxn,data_t>(reduce_kernels::host_isa, dst, src, nelems);
+    } else {
+      for (int i=0; i < nelems; ++i, ++src, ++dst){
         Fxn<data_t>::op(*dst, *src);
+      }
     }
   }
 };
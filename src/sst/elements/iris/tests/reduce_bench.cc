@@ -0,0 +1,174 @@
+/**
+Copyright 2009-2024 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2024, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+// Stand-alone benchmark for the sumi reduction kernels. It needs no SST
+// core and can be built with
+//   c++ -O2 -std=c++17 -I<sst-elements>/src/sst/elements reduce_bench.cc
+//
+// Each op/type pair reduces a buffer of random values with the plain
+// element loop the reduction used to run, then with every kernel the host
+// supports. Throughput is bytes of the destination buffer per second, and
+// every kernel's result is checked against the element loop.
+
+#include <iris/sumi/comm_functions.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace SST::Iris::sumi;
+namespace rk = SST::Iris::sumi::reduce_kernels;
+
+static const int nelems_bytes = 1 << 20;
+static const int reps = 200;
+
+template <template <typename> class Fxn, typename data_t>
+__attribute__((noinline)) void
+element_loop(data_t* dst, const data_t* src, int nelems){
+  for (int i=0; i < nelems; ++i){
+    Fxn<data_t>::op(dst[i], src[i]);
+  }
+}
+
+template <typename data_t>
+static void
+fill(std::vector<data_t>& v, std::mt19937& gen){
+  std::uniform_int_distribution<int> dist(1, 3);
+  for (auto& x : v) x = data_t(dist(gen));
+}
+
+template <typename Kernel>
+static double
+time_gbs(Kernel k, size_t bytes){
+  auto start = std::chrono::steady_clock::now();
+  for (int r=0; r < reps; ++r) k();
+  std::chrono::duration<double> t = std::chrono::steady_clock::now() - start;
+  return bytes * double(reps) / t.count() / 1e9;
+}
+
+static int failures = 0;
+
+template <template <typename> class Fxn, typename data_t>
+static void
+bench(const char* op, const char* type){
+  const int nelems = nelems_bytes / sizeof(data_t);
+  std::mt19937 gen(42);
+  std::vector<data_t> src(nelems), dst(nelems), init(nelems);
+  fill(src, gen);
+  fill(init, gen);
+
+  std::vector<data_t> ref = init;
+  element_loop<Fxn,data_t>(ref.data(), src.data(), nelems);
+
+  dst = init;
+  double base = time_gbs([&]{ element_loop<Fxn,data_t>(dst.data(), src.data(), nelems); }, nelems_bytes);
+  std::printf("%-5s %-9s %8.2f", op, type, base);
+
+  const rk::isa_t isas[] = { rk::scalar, rk::avx2, rk::avx512 };
+  for (rk::isa_t isa : isas){
+    if (isa > rk::host_isa){
+      std::printf(" %8s %6s", "-", "");
+      continue;
+    }
+    dst = init;
+    rk::run<Fxn,data_t>(isa, dst.data(), src.data(), nelems);
+    if (dst != ref){
+      std::printf("\nMISMATCH: %s %s isa=%d\n", op, type, int(isa));
+      ++failures;
+    }
+    double gbs = time_gbs([&]{ rk::run<Fxn,data_t>(isa, dst.data(), src.data(), nelems); }, nelems_bytes);
+    std::printf(" %8.2f %5.1fx", gbs, gbs / base);
+  }
+  std::printf("\n");
+}
+
+template <typename data_t>
+static void
+bench_arith(const char* type){
+  bench<Add,data_t>("sum", type);
+  bench<Prod,data_t>("prod", type);
+  bench<Min,data_t>("min", type);
+  bench<Max,data_t>("max", type);
+  bench<And,data_t>("land", type);
+  bench<Or,data_t>("lor", type);
+  bench<LXOr,data_t>("lxor", type);
+}
+
+template <typename data_t>
+static void
+bench_int(const char* type){
+  bench_arith<data_t>(type);
+  bench<BAnd,data_t>("band", type);
+  bench<BOr,data_t>("bor", type);
+  bench<BXOr,data_t>("bxor", type);
+}
+
+int main(int /*argc*/, char** /*argv*/){
+  std::printf("%-5s %-9s %8s %8s %6s %8s %6s %8s %6s\n", "op", "type", "loop",
+              "scalar", "", "avx2", "", "avx512", "");
+  std::printf("(GB/s of reduced data, %d byte buffers)\n", nelems_bytes);
+
+  bench_int<char>("char");
+  bench_int<unsigned char>("uchar");
+  bench_int<short>("short");
+  bench_int<unsigned short>("ushort");
+  bench_int<int>("int");
+  bench_int<unsigned>("unsigned");
+  bench_int<long>("long");
+  bench_int<unsigned long>("ulong");
+  bench_int<long long>("longlong");
+  bench_int<unsigned long long>("ulonglong");
+  bench_arith<float>("float");
+  bench_arith<double>("double");
+  bench_arith<long double>("ldouble");
+
+  if (failures){
+    std::printf("%d kernels disagreed with the element loop\n", failures);
+    return 1;
+  }
+  return 0;
+}
@@ -27,19 +27,15 @@
 
 #include <sst/core/statapi/stataccumulator.h>
 
-#include <queue>
-
 #include "sst/elements/kingsley/nocEvents.h"
-#include "sst/elements/kingsley/lru_unit.h"
+#include "sst/elements/kingsley/noc_mesh_router.h"
 
 using namespace SST;
 
 namespace SST {
 namespace Kingsley {
 
-class noc_mesh_event;
-
-class noc_mesh : public Component {
+class noc_mesh : public Component, public noc_mesh_router::Owner {
 
 public:
 
@@ -79,77 +75,42 @@ public:
         // { "idle_time",          "Amount of time spent idle for a given port", "units of core timebase", 1},
     )
 
-    static const int north_port = 0;
-    static const int south_port = 1;
-    static const int east_port = 2;
-    static const int west_port = 3;
-    static const int local_port_start = 4;
-
-    static const int north_mask = 1 << north_port;
-    static const int south_mask = 1 << south_port;
-    static const int east_mask = 1 << east_port;
-    static const int west_mask = 1 << west_port;
+    static const int north_port = noc_mesh_router::north_port;
+    static const int south_port = noc_mesh_router::south_port;
+    static const int east_port = noc_mesh_router::east_port;
+    static const int west_port = noc_mesh_router::west_port;
+    static const int local_port_start = noc_mesh_router::local_port_start;
+
+    static const int north_mask = noc_mesh_router::north_mask;
+    static const int south_mask = noc_mesh_router::south_mask;
+    static const int east_mask = noc_mesh_router::east_mask;
+    static const int west_mask = noc_mesh_router::west_mask;
+
+    // noc_mesh_router::Owner
+    bool connected(int rtr, int port) override;
+    void send(int rtr, int port, Event* ev) override;
+    void sendUntimed(int rtr, int port, Event* ev) override;
+    Event* recvUntimed(int rtr, int port) override;
+    void initDenseMap(int size) override;
+    void publishDenseMap() override;
+    SimTime_t currentTimeNano() override;
 
 private:
 
-    int init_state;
-    int init_count;
-    int endpoint_start;
-    int total_endpoints;
-    unsigned int edge_status;
-    unsigned int endpoint_locations;
-
-    int flit_size;
-    int input_buf_size;
-
-    int x_size;
-    int y_size;
-
-    int my_x;
-    int my_y;
-
-    bool route_y_first;
-
-
-    typedef std::queue<noc_mesh_event*> port_queue_t;
-
     Clock::Handler<noc_mesh>* my_clock_handler;
     TimeConverter* clock_tc;
-    void clock_wakeup();
-    bool clock_is_off;
-    Cycle_t last_time = 0;
 
     Link** ports;
-    port_queue_t* port_queues;
-    int* port_busy;
-    int* port_credits;
     int local_ports;
-    bool use_dense_map;
-    bool port_priority_equal;
     Shared::SharedArray<int> dense_map;
 
-    std::vector< lru_unit<int> > lru_units;
-    // lru_unit<int> local_lru;
-    // lru_unit<int> mesh_lru;
+    noc_mesh_router* router;
 
     bool clock_handler(Cycle_t cycle);
-    // Statistic<uint64_t>** xbar_stalls;
 
     Output& output;
 
-    noc_mesh_event* wrap_incoming_packet(NocPacket* packet);
-    void handle_input_r2r(Event* ev, int port);
-    void handle_input_ep2r(Event* ev, int port);
-
-    void route(noc_mesh_event* event);
-
-
-    Statistic<uint64_t>** send_bit_count;
-    Statistic<uint64_t>** output_port_stalls;
-    Statistic<uint64_t>** xbar_stalls;
-    // Statistic<uint64_t>** xbar_stalls_prioirty;
-    // Statistic<uint64_t>** xbar_stalls_normal;
-    // Statistic<uint64_t>** output_idle;
+    void handle_input(Event* ev, int port);
 
 
 public:
@@ -170,53 +131,6 @@ public:
 
 };
 
-class noc_mesh_event : public BaseNocEvent {
-
-public:
-
-    std::pair<int,int> dest_mesh_loc;
-    int egress_port;
-
-    int next_port;
-    NocPacket* encap_ev;
-
-    noc_mesh_event() :
-        BaseNocEvent(BaseNocEvent::INTERNAL)
-    {
-        encap_ev = NULL;
-    }
-
-    noc_mesh_event(NocPacket* ev) :
-        BaseNocEvent(BaseNocEvent::INTERNAL)
-    {encap_ev = ev;}
-
-    virtual ~noc_mesh_event() {
-        if ( encap_ev != NULL ) delete encap_ev;
-    }
-
-    virtual noc_mesh_event* clone(void) override {
-        noc_mesh_event* ret = new noc_mesh_event(*this);
-        ret->dest_mesh_loc = dest_mesh_loc;
-        ret->egress_port = egress_port;
-        ret->next_port = next_port;
-        ret->encap_ev = encap_ev->clone();
-        return ret;
-    }
-
-    void serialize_order(SST::Core::Serialization::serializer &ser)  override {
-        BaseNocEvent::serialize_order(ser);
-        ser & dest_mesh_loc;
-        ser & egress_port;
-        ser & next_port;
-        ser & encap_ev;
-    }
-
-private:
-    ImplementSerializable(SST::Kingsley::noc_mesh_event)
-
-};
-
-
 }
 }
 
@@ -0,0 +1,1110 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+#include <sst_config.h>
+#include "noc_mesh_router.h"
+
+#include <sst/core/params.h>
+#include <sst/core/output.h>
+#include <sst/core/unitAlgebra.h>
+
+#include <algorithm>
+#include <string>
+
+#include "nocEvents.h"
+
+using namespace SST::Kingsley;
+using namespace SST::Interfaces;
+using namespace std;
+
+
+noc_mesh_config::noc_mesh_config(Params& params, Output& output, const std::string& type)
+{
+    // Get the options for the router
+    local_ports = params.find<int>("local_ports",1);
+
+    use_dense_map = params.find<bool>("use_dense_map",false);
+
+    port_priority_equal = params.find<bool>("port_priority_equal",false);
+
+    // Parse all the timing parameters
+
+    bool found = false;
+
+    // Flit size
+    UnitAlgebra flit_size_ua = params.find<UnitAlgebra>("flit_size",found);
+    if ( !found ) {
+        output.fatal(CALL_INFO, -1, "%s requires flit_size to be specified\n", type.c_str());
+    }
+    if ( flit_size_ua.hasUnits("B") ) {
+        // Need to convert to bits per second
+        flit_size_ua *= UnitAlgebra("8b/B");
+    }
+    flit_size = flit_size_ua.getRoundedValue();
+
+    UnitAlgebra input_buf_size_ua = params.find<UnitAlgebra>("input_buf_size",flit_size_ua * 2);
+    if ( input_buf_size_ua.hasUnits("B") ) {
+        // Need to convert to bits per second
+        input_buf_size_ua *= UnitAlgebra("8b/B");
+    }
+    input_buf_size = input_buf_size_ua.getRoundedValue();
+
+
+    UnitAlgebra link_bw_ua = params.find<UnitAlgebra>("link_bw",found);
+    if ( !found ) {
+        output.fatal(CALL_INFO, -1, "%s requires link_bw to be specified\n", type.c_str());
+    }
+    if ( link_bw_ua.hasUnits("B/s") ) {
+        // Need to convert to bits per second
+        link_bw_ua *= UnitAlgebra("8b/B");
+    }
+
+    clock_freq = link_bw_ua / flit_size_ua;
+
+    route_y_first = params.find<bool>("route_y_first",false);
+}
+
+
+noc_mesh_router::~noc_mesh_router()
+{
+}
+
+noc_mesh_router::noc_mesh_router(int id, const std::string& name, const noc_mesh_config& config,
+                                 Owner* owner, Shared::SharedArray<int>& dense_map, Output& output) :
+    ports(local_port_start + config.local_ports),
+    id(id),
+    name(name),
+    owner(owner),
+    dense_map(dense_map),
+    output(output),
+    local_ports(config.local_ports),
+    flit_size(config.flit_size),
+    input_buf_size(config.input_buf_size),
+    route_y_first(config.route_y_first),
+    use_dense_map(config.use_dense_map),
+    port_priority_equal(config.port_priority_equal),
+    init_state(0),
+    init_count(0),
+    endpoint_start(0),
+    total_endpoints(0),
+    edge_status(0),
+    endpoint_locations(0),
+    x_size(0),
+    y_size(0),
+    my_x(0),
+    my_y(0),
+    clock_is_off(false),
+    last_time(0)
+{
+}
+
+void
+noc_mesh_router::route(noc_mesh_event* event)
+{
+    if ( route_y_first ) {
+        // Compute next port
+        if ( event->dest_mesh_loc.second > my_y ) {
+            event->next_port = north_port;
+        }
+        else if ( event->dest_mesh_loc.second < my_y ) {
+            event->next_port = south_port;
+        }
+        else {
+            if ( event->dest_mesh_loc.first > my_x ) {
+                event->next_port = east_port;
+            }
+            else if ( event->dest_mesh_loc.first < my_x) {
+                event->next_port = west_port;
+            }
+            else {
+                event->next_port = event->egress_port;
+            }
+        }
+    }
+
+    else {
+        // Compute next port
+        if ( event->dest_mesh_loc.first > my_x ) {
+            event->next_port = east_port;
+        }
+        else if ( event->dest_mesh_loc.first < my_x) {
+            event->next_port = west_port;
+        }
+        else {
+            if ( event->dest_mesh_loc.second > my_y ) {
+                event->next_port = north_port;
+            }
+            else if ( event->dest_mesh_loc.second < my_y) {
+                event->next_port = south_port;
+            }
+            else {
+                event->next_port = event->egress_port;
+            }
+        }
+    }
+}
+
+noc_mesh_event*
+noc_mesh_router::wrap_incoming_packet(NocPacket* packet) {
+    // Wrap the incoming NocPacket in a noc_mesh_event
+    noc_mesh_event* event = new noc_mesh_event(packet);
+
+    // Compute the destination router
+    int dest = packet->request->dest;
+
+    if ( dest == SimpleNetwork::INIT_BROADCAST_ADDR ) {
+        event->dest_mesh_loc.first = -1;
+        event->dest_mesh_loc.second = -1;
+        event->egress_port = -1;
+        return event;
+    }
+
+    // Check to see if we have dense addressing
+    if ( use_dense_map ) {
+        dest = dense_map[dest];
+    }
+
+    int dest_rtr_id = dest / local_ports;
+    int x = dest_rtr_id % x_size;
+    int y = dest_rtr_id / x_size;
+
+    // Compute the egress port.  If this is in the halo, then it will
+    // be either north, south, east or west.  If it is not in the halo,
+    // it will be one of the local_ports.
+    if ( x == 0 ) {
+        x = 1;
+        event->egress_port = west_port;
+    }
+    else if ( x == x_size - 1) {
+        x = x_size - 2;
+        event->egress_port = east_port;
+    }
+    else if ( y == 0 ) {
+        y = 1;
+        event->egress_port = south_port;
+    }
+    else if ( y == y_size - 1 ) {
+        y = y_size - 2;
+        event->egress_port = north_port;
+    }
+    else {
+        event->egress_port = local_port_start + (dest - (((y * x_size) + x ) * local_ports) );
+    }
+
+    event->dest_mesh_loc.first = x;
+    event->dest_mesh_loc.second = y;
+
+    return event;
+}
+
+bool
+noc_mesh_router::input(int port, Event* ev)
+{
+    // Check type of event.  Routers send INTERNAL events to each
+    // other, endpoints and the halo send PACKETs.
+    BaseNocEvent* base_ev = static_cast<BaseNocEvent*>(ev);
+    switch ( base_ev->getType() ) {
+    case BaseNocEvent::CREDIT:
+    {
+        credit_event* credit_ret = static_cast<credit_event*>(ev);
+        ports[port].credits += credit_ret->credits;
+        delete ev;
+        return false;
+    }
+    case BaseNocEvent::INTERNAL:
+    {
+        noc_mesh_event* event = static_cast<noc_mesh_event*>(ev);
+
+        route(event);
+
+        // Put the event into the proper queue
+        ports[port].queue.push(event);
+        return clock_is_off;
+    }
+    case BaseNocEvent::PACKET:
+    {
+        NocPacket* packet = static_cast<NocPacket*>(ev);
+
+        // Wrap the incoming NocPacket in a noc_mesh_event
+        noc_mesh_event* event = wrap_incoming_packet(packet);
+        route(event);
+
+        // Need to put the event into the proper queue
+        ports[port].queue.push(event);
+        return clock_is_off;
+    }
+    default:
+        return false;
+    }
+}
+
+void
+noc_mesh_router::wakeup(Cycle_t cycle)
+{
+    Cycle_t cyclesOff = cycle - last_time - 1;
+    // Update busy values
+    for ( auto& p : ports ) {
+        p.busy = (p.busy < cyclesOff) ? 0 : p.busy - cyclesOff;
+    }
+    clock_is_off = false;
+}
+
+bool
+noc_mesh_router::tick(Cycle_t cycle)
+{
+    last_time = cycle;
+    // Decrement all the busy values
+    for ( auto& p : ports ) {
+        p.busy--;
+        if (p.busy < 0) p.busy = 0;
+    }
+
+    bool keepClockOn = false;
+    // Progress all the messages
+
+
+    // Prioirty goes in order of the lru_units list.  First entry has
+    // highest priority, second has second highest, etc
+    for ( auto& lru : lru_units ) {
+        for ( unsigned int i = 0; i < lru.size(); i++ ) {
+            int lru_port = lru.top();
+            port_t& in_port = ports[lru_port];
+            if ( !in_port.queue.empty() ) {
+                noc_mesh_event* event = in_port.queue.front();
+
+                // Get the next port
+                int port = event->next_port;
+                port_t& out_port = ports[port];
+
+                // Check to see if the port is busy
+                if ( out_port.busy > 0 ) {
+                    out_port.xbar_stalls->addData(1);
+                    lru.satisfied(false);
+                    keepClockOn = true;
+                    continue;
+                }
+
+                // Check to see if there are enough credits to send on
+                // that port
+                if ( out_port.credits >= event->encap_ev->getSizeInFlits() ) {
+                    int trace_id = event->encap_ev->request->getTraceID();
+                    int vn = event->encap_ev->vn;
+                    SST::Interfaces::SimpleNetwork::nid_t src = event->encap_ev->request->src;
+                    SST::Interfaces::SimpleNetwork::nid_t dest = event->encap_ev->request->dest;
+                    SST::Interfaces::SimpleNetwork::Request::TraceType ttype = event->encap_ev->request->getTraceType();
+                    int flits = event->encap_ev->getSizeInFlits();
+
+                    in_port.queue.pop();
+                    out_port.credits -= event->encap_ev->getSizeInFlits();
+                    out_port.busy = event->encap_ev->getSizeInFlits();
+                    out_port.send_bit_count->addData(event->encap_ev->request->size_in_bits);
+                    if ( edge_status & ( 1 << port) ) {
+                        owner->send(id, port, event->encap_ev);
+                        event->encap_ev = NULL;
+                        delete event;
+                    }
+                    else {
+                        owner->send(id, port, event);
+                    }
+                    if ( ttype == SimpleNetwork::Request::FULL ) {
+                        output.output("TRACE(%d): %" PRIu64 " ns: Sent an event to router from router: (%d,%d)"
+                                      " (%s) on VC %d from src %" PRIu64 " to dest %" PRIu64 ".\n",
+                                      trace_id,
+                                      owner->currentTimeNano(),
+                                      my_x, my_y,
+                                      name.c_str(),
+                                      vn,
+                                      src,
+                                      dest);
+                    }
+                    // Need to send credit event back to last router
+                    credit_event* cr_ev = new credit_event(0, flits);
+                    owner->send(id, lru_port, cr_ev);
+                    lru.satisfied(true);
+                }
+                else {
+                    out_port.output_port_stalls->addData(1);
+                    lru.satisfied(false);
+                }
+                if (!in_port.queue.empty())
+                    keepClockOn = true;
+            }
+            else {
+                lru.satisfied(false);
+            }
+        }
+    }
+
+    clock_is_off = !keepClockOn;
+
+    return keepClockOn;
+}
+
+void
+noc_mesh_router::setup()
+{
+    // Set up the lru units
+
+    // First do the endpoints
+    lru_units.resize(1);
+    for ( int i = local_port_start; i < local_port_start + local_ports; ++i ) {
+        if ( owner->connected(id,i) ) {
+            lru_units[0].insert(i);
+        }
+    }
+
+
+    // If the priorities aren't equal, create another lru_unit for the
+    // lower priority ports
+    if ( !port_priority_equal ) {
+        lru_units[0].finalize();
+        lru_units.resize(2);
+    }
+
+    // Now the mesh ports
+    for ( int i = 0; i < local_port_start; ++i ) {
+        if ( owner->connected(id,i) ) {
+            lru_units.back().insert(i);
+        }
+    }
+    lru_units.back().finalize();
+}
+
+void
+noc_mesh_router::init()
+{
+    // Init states:
+    // 0 - wait for endpoint messages
+    //
+    // 1 - recv messages from endpoints.  Compute locations in mesh
+    // and routers on eastern frontier send west.  Also pass flit_size
+    // to endpoints.
+    //
+    // 2 - Pass messages west, incrementing counter
+    //
+    // 3 - Western edge waits for endpoint count and x_size (southern
+    // row only)
+    //
+    // 4 - Western edge passes endpoint count and y_size from north
+    // port to south port.
+    //
+    // 5 - Southwestern router (router 0) waits for endpoint count and
+    // y_size
+    //
+    // 6 - Western edge waits for broadcated information from router 0
+    //
+    // 7 - Non-western edge wait for information broadcast from the
+    // west
+    //
+    // 8 - Send information to endpoints.
+    //
+    // 9 - Send all credit events
+
+    // Each router needs two variables dealing with endpoint counts:
+    //   -  total_endpoints: total number of endpoints
+    //   -  endpoint_start: number of endpoints in routers prior to
+    //        current router
+    //
+    // There are also two intermediate counts: row_endpoints and
+    // my_endpoints.  These will be stored in the final values as
+    // follows:
+    //   - row_endpoints stored in total_endpoints
+    //   - my_endpoints stored in endpoint_start
+
+    NocInitEvent* nie;
+    Event* ev;
+    switch ( init_state ) {
+    case 0:
+        // Phase 0 is only for endpoints to send a message
+        init_state = 1;
+        break;
+    case 1:
+    {
+        // Look through all the links to see which have endpoints
+        // attached or have no links attached
+        for ( int i = 0; i < local_port_start + local_ports; ++i ) {
+            if ( !owner->connected(id,i) ) {
+                edge_status |=  ( 1 << i );
+            }
+            else {
+                ev = owner->recvUntimed(id,i);
+                if ( ev != NULL ) {
+                    nie = static_cast<NocInitEvent*>(ev);
+                    if ( nie->command == NocInitEvent::REPORT_ENDPOINT ) {
+                        edge_status |=  ( 1 << i );
+                        endpoint_locations |= ( 1 << i );
+                        endpoint_start++;
+                        delete nie;
+                    }
+                    else {
+                        // Unexpected command
+                    }
+                }
+            }
+        }
+
+        // output.output("my endpoint count = %d\n\n",endpoint_start);
+
+        // Now, all the routers on the eastern frontier send the count
+        // of endpoints to the west.  In addition, the southern row
+        // will also send the count of columns to get the x_size.
+        if ( edge_status & east_mask ) { // East port is an edge
+            nie = new NocInitEvent();
+            nie->command = NocInitEvent::SUM_ENDPOINTS;
+            nie->int_value = endpoint_start;
+            owner->sendUntimed(id,west_port,nie);
+            if ( edge_status & south_mask ) { // southeast corner
+                nie = new NocInitEvent();
+                nie->command = NocInitEvent::COMPUTE_X_SIZE;
+                nie->int_value = 1;
+                owner->sendUntimed(id,west_port,nie);
+                init_state = 7;
+            }
+            else {
+                init_state = 7;
+            }
+        }
+
+        else if ( edge_status & 0x8 ) {
+            // Western edge waits for endpoint count and x_size
+            // computation
+            init_state = 3;
+        }
+        else {
+            // All other routers wait to pass endpoint count and
+            // x_size
+            init_state = 2;
+        }
+
+        // Pass flit size to the endpoints
+        for ( int i = 0; i < local_port_start + local_ports; ++i ) {
+            if ( (1 << i) & endpoint_locations ) {
+                nie = new NocInitEvent();
+                nie->command = NocInitEvent::REPORT_FLIT_SIZE;
+                nie->ua_value = UnitAlgebra("1b") * flit_size;
+                owner->sendUntimed(id,i,nie);
+            }
+        }
+        break;
+    }
+    case 2:
+        // Look for events coming in on east link and increment and
+        // pass to west link
+        ev = owner->recvUntimed(id,east_port);
+        if ( NULL == ev ) break;
+        nie = static_cast<NocInitEvent*>(ev);
+        if ( nie->command == NocInitEvent::SUM_ENDPOINTS ) {
+            nie->int_value += endpoint_start;
+            owner->sendUntimed(id,west_port,nie);
+            if ( edge_status & south_mask ) { // southern row also computing x_size
+                ev = owner->recvUntimed(id,east_port);
+                nie = static_cast<NocInitEvent*>(ev);
+                if ( nie->command == NocInitEvent::COMPUTE_X_SIZE ) {
+                    nie->int_value++;
+                    owner->sendUntimed(id,west_port,nie);
+                }
+                else {
+                    // unexpected event type
+                }
+            }
+        }
+        else {
+            // Unexpected event type
+        }
+
+        init_state = 7;
+        break;
+    case 3:
+        // Western edge waiting for endpoint count and x_size
+        // (southern corner only)
+        ev = owner->recvUntimed(id,east_port);
+        if ( NULL == ev ) break;
+
+        nie = static_cast<NocInitEvent*>(ev);
+        if ( nie->command == NocInitEvent::SUM_ENDPOINTS ) {
+            // Compute final row_endpoints value for the row and store
+            // in total_endpoints
+            total_endpoints = endpoint_start + nie->int_value;
+            delete nie;
+        }
+        else {
+            // Unexpected event type
+        }
+        init_state = 4;
+
+        // If south western router (router 0), compute x_size
+        if ( edge_status & south_mask ) {
+            ev = owner->recvUntimed(id,east_port);
+            if ( NULL == ev ) {} // should have had an event
+            nie = static_cast<NocInitEvent*>(ev);
+            if ( nie->command == NocInitEvent::COMPUTE_X_SIZE ) {
+                // Add one for me, plus the halo (+2)
+                x_size = nie->int_value + 3;
+                delete nie;
+            }
+            else {
+                // Unexpected event type
+            }
+            init_state = 5;
+        }
+        else if ( edge_status & north_mask ) { // northwest corner
+            // Send the total endpoint count and y_size count south.
+            nie = new NocInitEvent();
+            nie->command = NocInitEvent::SUM_ENDPOINTS;
+            nie->int_value = total_endpoints;
+            owner->sendUntimed(id,south_port,nie);
+
+            nie = new NocInitEvent();
+            nie->command = NocInitEvent::COMPUTE_Y_SIZE;
+            nie->int_value = 1;
+            owner->sendUntimed(id,south_port,nie);
+            init_state = 6;
+        }
+        break;
+    case 4:
+        // Read from north port, increment and send to south port
+        ev = owner->recvUntimed(id,north_port);
+        if ( NULL == ev ) break;
+        nie = static_cast<NocInitEvent*>(ev);
+        if ( nie->command == NocInitEvent::SUM_ENDPOINTS ) {
+            nie->int_value += total_endpoints;
+            owner->sendUntimed(id,south_port,nie);
+        }
+        else {
+            // Unexpected event type
+        }
+
+        ev = owner->recvUntimed(id,north_port);
+        if ( NULL == ev ) {} // should be an event
+        nie = static_cast<NocInitEvent*>(ev);
+        if ( nie->command == NocInitEvent::COMPUTE_Y_SIZE ) {
+            nie->int_value++;
+            owner->sendUntimed(id,south_port,nie);
+        }
+        else {
+            // Unexpected event type
+        }
+        init_state = 6;
+        break;
+    case 5:
+    {
+        // Wait to get endpoint count and y_size
+
+        // Temporarily need to hold row_endpoints
+        int row_endpoints = total_endpoints;
+        ev = owner->recvUntimed(id,north_port);
+        if ( NULL == ev ) break;
+        nie = static_cast<NocInitEvent*>(ev);
+        if ( nie->command == NocInitEvent::SUM_ENDPOINTS ) {
+            total_endpoints = row_endpoints + nie->int_value;
+            delete nie;
+        }
+        else {
+            // Unexpected event type
+        }
+
+        ev = owner->recvUntimed(id,north_port);
+        if ( NULL == ev ) {} // should have been an event
+        nie = static_cast<NocInitEvent*>(ev);
+        if ( nie->command == NocInitEvent::COMPUTE_Y_SIZE ) {
+            // Add one for me, plus the halo (+2)
+            y_size = nie->int_value + 3;
+            delete nie;
+        }
+        else {
+            // Unexpected event type
+        }
+
+        // Set x and y, remember that there is a virtual halo
+        my_x = 1;
+        my_y = 1;
+
+        // Send the info east and north
+        nie = new NocInitEvent();
+        nie->command = NocInitEvent::COMPUTE_ENDPOINT_START;
+        nie->int_value = row_endpoints;
+        owner->sendUntimed(id,north_port,nie);
+
+        nie = new NocInitEvent();
+        nie->command = NocInitEvent::COMPUTE_ENDPOINT_START;
+        nie->int_value = endpoint_start;
+        endpoint_start = 0;
+        owner->sendUntimed(id,east_port,nie);
+
+        nie = new NocInitEvent();
+        nie->command = NocInitEvent::BROADCAST_TOTAL_ENDPOINTS;
+        nie->int_value = total_endpoints;
+        owner->sendUntimed(id,east_port,nie->clone());
+        owner->sendUntimed(id,north_port,nie);
+
+        nie = new NocInitEvent();
+        nie->command = NocInitEvent::BROADCAST_X_SIZE;
+        nie->int_value = x_size;
+        owner->sendUntimed(id,east_port,nie->clone());
+        owner->sendUntimed(id,north_port,nie);
+
+        nie = new NocInitEvent();
+        nie->command = NocInitEvent::BROADCAST_Y_SIZE;
+        nie->int_value = y_size;
+        owner->sendUntimed(id,east_port,nie->clone());
+        owner->sendUntimed(id,north_port,nie);
+
+        nie = new NocInitEvent();
+        nie->command = NocInitEvent::COMPUTE_X_POS;
+        nie->int_value = my_x;
+        owner->sendUntimed(id,east_port,nie->clone());
+        owner->sendUntimed(id,north_port,nie);
+
+        nie = new NocInitEvent();
+        nie->command = NocInitEvent::COMPUTE_Y_POS;
+        nie->int_value = my_y;
+        owner->sendUntimed(id,east_port,nie->clone());
+        owner->sendUntimed(id,north_port,nie);
+
+        init_state = 8;
+        init_count = (x_size - 2 - my_x) + (y_size - 2 - my_y) - 1;
+        break;
+    }
+    case 6:
+        ev = owner->recvUntimed(id,south_port);
+        if ( NULL == ev ) break;
+
+        nie = static_cast<NocInitEvent*>(ev);
+        if ( nie->command == NocInitEvent::COMPUTE_ENDPOINT_START ) {
+
+            // Make a copy of my_endpoints (stored in endpoint_start)
+            // because we need to put the actual endpoint_start in
+            // that variable.
+            int my_ep = endpoint_start;
+            endpoint_start = nie->int_value;
+
+            if ( !( edge_status & north_mask) ) {
+                NocInitEvent* nie2 = nie->clone();
+                // Add the row endpoints (stored in total_endpoints to
+                // what we got and send north
+                nie2->int_value += total_endpoints;
+                owner->sendUntimed(id,north_port,nie2);
+            }
+            nie->int_value += my_ep;
+            owner->sendUntimed(id,east_port,nie);
+        }
+
+        ev = owner->recvUntimed(id,south_port);
+        nie = static_cast<NocInitEvent*>(ev);
+        // Get all the info and do the appropriate things with it
+        if ( nie->command == NocInitEvent::BROADCAST_TOTAL_ENDPOINTS ) {
+            total_endpoints = nie->int_value;
+            if ( !( edge_status & north_mask) ) owner->sendUntimed(id,north_port,nie->clone());
+            owner->sendUntimed(id,east_port,nie);
+        }
+
+        ev = owner->recvUntimed(id,south_port);
+        nie = static_cast<NocInitEvent*>(ev);
+        if ( nie->command == NocInitEvent::BROADCAST_X_SIZE ) {
+            x_size = nie->int_value;
+            if ( !( edge_status & north_mask) ) owner->sendUntimed(id,north_port,nie->clone());
+            owner->sendUntimed(id,east_port,nie);
+        }
+
+        ev = owner->recvUntimed(id,south_port);
+        nie = static_cast<NocInitEvent*>(ev);
+        if ( nie->command == NocInitEvent::BROADCAST_Y_SIZE ) {
+            y_size = nie->int_value;
+            if ( !( edge_status & north_mask) ) owner->sendUntimed(id,north_port,nie->clone());
+            owner->sendUntimed(id,east_port,nie);
+        }
+
+        ev = owner->recvUntimed(id,south_port);
+        nie = static_cast<NocInitEvent*>(ev);
+        if ( nie->command == NocInitEvent::COMPUTE_X_POS ) {
+            my_x = nie->int_value;
+            if ( !( edge_status & north_mask) ) owner->sendUntimed(id,north_port,nie->clone());
+            owner->sendUntimed(id,east_port,nie);
+        }
+
+        ev = owner->recvUntimed(id,south_port);
+        nie = static_cast<NocInitEvent*>(ev);
+        if ( nie->command == NocInitEvent::COMPUTE_Y_POS ) {
+            my_y = nie->int_value + 1;
+            nie->int_value++;
+            if ( !( edge_status & north_mask) ) owner->sendUntimed(id,north_port,nie->clone());
+            owner->sendUntimed(id,east_port,nie);
+        }
+
+        init_count = (x_size - 2 - my_x) + (y_size - 2 - my_y) - 1;
+        init_state = 8;
+        break;
+
+    case 7:
+        ev = owner->recvUntimed(id,west_port);
+        if ( NULL == ev ) break;
+
+        nie = static_cast<NocInitEvent*>(ev);
+        // Get all the info and do the appropriate things with it
+        if ( nie->command == NocInitEvent::COMPUTE_ENDPOINT_START ) {
+            // Make a copy of my_endpoints (stored in endpoint_start)
+            // because we need to put the actual endpoint_start in
+            // that variable.
+            int my_ep = endpoint_start;
+            endpoint_start = nie->int_value;
+
+            nie->int_value += my_ep;
+            if ( !( edge_status & east_mask) ) owner->sendUntimed(id,east_port,nie);
+            else delete nie;
+        }
+
+        ev = owner->recvUntimed(id,west_port);
+        nie = static_cast<NocInitEvent*>(ev);
+        if ( nie->command == NocInitEvent::BROADCAST_TOTAL_ENDPOINTS ) {
+            total_endpoints = nie->int_value;
+            if ( !( edge_status & east_mask) ) owner->sendUntimed(id,east_port,nie);
+            else delete nie;
+        }
+
+        ev = owner->recvUntimed(id,west_port);
+        nie = static_cast<NocInitEvent*>(ev);
+        if ( nie->command == NocInitEvent::BROADCAST_X_SIZE ) {
+            x_size = nie->int_value;
+            if ( !( edge_status & east_mask) ) owner->sendUntimed(id,east_port,nie);
+            else delete nie;
+        }
+
+        ev = owner->recvUntimed(id,west_port);
+        nie = static_cast<NocInitEvent*>(ev);
+        if ( nie->command == NocInitEvent::BROADCAST_Y_SIZE ) {
+            y_size = nie->int_value;
+            if ( !( edge_status & east_mask) ) owner->sendUntimed(id,east_port,nie);
+            else delete nie;
+        }
+
+        ev = owner->recvUntimed(id,west_port);
+        nie = static_cast<NocInitEvent*>(ev);
+        if ( nie->command == NocInitEvent::COMPUTE_X_POS ) {
+            my_x = nie->int_value + 1;
+            nie->int_value++;
+            if ( !( edge_status & east_mask) ) owner->sendUntimed(id,east_port,nie);
+            else delete nie;
+        }
+
+        ev = owner->recvUntimed(id,west_port);
+        nie = static_cast<NocInitEvent*>(ev);
+        if ( nie->command == NocInitEvent::COMPUTE_Y_POS ) {
+            my_y = nie->int_value;
+            if ( !( edge_status & east_mask) ) owner->sendUntimed(id,east_port,nie);
+            else delete nie;
+        }
+
+        init_state = 8;
+        if ( !((edge_status & north_mask) && (edge_status & east_mask)) ) {
+            // All but the northeast corner (the last router to get
+            // the information broadcast) go to state 8 with a counter
+            // to tell it when the northeast corner hits that state.
+            // Then all routers will populate the dense_map and send
+            // info to the endpoints.
+            init_count = (x_size - 2 - my_x) + (y_size - 2 - my_y) - 1;
+            break;
+        }
+        //break;
+    case 8:
+    {
+        if ( init_count > 0 ) {
+            init_count--;
+            break;
+        }
+        // Used if we are setting up the dense to sparse id map
+        std::vector<std::pair<int,int>> ep_ids;
+        // Need to send the information to the endpoints
+        // See if any of the directional ports have endpoints
+        if ( endpoint_locations & north_mask ) {
+            int x = my_x;
+            int y = my_y + 1;
+            int endpoint_id = ((y * x_size) + x) * local_ports;
+            // This is odd, but a static const int does not allocate
+            // space, so need to put it in a temp variable because
+            // make_pair is pass by reference.
+            int tmp = north_port;
+            ep_ids.push_back(std::make_pair(endpoint_id,tmp));
+        }
+
+        if ( endpoint_locations & south_mask ) {
+            int x = my_x;
+            int y = my_y - 1;
+            int endpoint_id = ((y * x_size) + x) * local_ports;
+            // This is odd, but a static const int does not allocate
+            // space, so need to put it in a temp variable because
+            // make_pair is pass by reference.
+            int tmp = south_port;
+            ep_ids.push_back(std::make_pair(endpoint_id,tmp));
+        }
+
+        if ( endpoint_locations & east_mask ) {
+            int x = my_x + 1;
+            int y = my_y;
+            int endpoint_id = ((y * x_size) + x) * local_ports;
+            // This is odd, but a static const int does not allocate
+            // space, so need to put it in a temp variable because
+            // make_pair is pass by reference.
+            int tmp = east_port;
+            ep_ids.push_back(std::make_pair(endpoint_id,tmp));
+        }
+
+        if ( endpoint_locations & west_mask ) {
+            int x = my_x - 1;
+            int y = my_y;
+            int endpoint_id = ((y * x_size) + x) * local_ports;
+            // This is odd, but a static const int does not allocate
+            // space, so need to put it in a temp variable because
+            // make_pair is pass by reference.
+            int tmp = west_port;
+            ep_ids.push_back(std::make_pair(endpoint_id,tmp));
+        }
+
+        // Now for local ports
+        for ( int i = 0; i < local_ports; ++i ) {
+            if ( endpoint_locations & ( 1 << (i + local_port_start) ) ) {
+                int endpoint_id = (((my_y * x_size) + my_x) * local_ports) + i;
+                ep_ids.push_back(std::make_pair(endpoint_id,local_port_start + i));
+            }
+        }
+
+        init_state = 9;
+        // output.output("Router %s has x = %d and y = %d\n",name.c_str(),my_x,my_y);
+        // output.output("Total endpoints = %d\n",total_endpoints);
+        // output.output("Endpoint_Start = %d\n",endpoint_start);
+        // output.output("x_size = %d, y_size = %d\n",x_size, y_size);
+
+        // Use a SharedArray to create a sparse mapping
+        // for network addresses.  This is only used if the
+        // use_dense_map param is set to true
+        if ( use_dense_map ) {
+            owner->initDenseMap(16 * total_endpoints);
+
+            std::sort(ep_ids.begin(), ep_ids.end());
+
+            for ( int i = 0; i < ep_ids.size(); ++i ) {
+                dense_map.write(endpoint_start + i, ep_ids[i].first);
+                ep_ids[i].first = endpoint_start + i;
+            }
+            owner->publishDenseMap();
+        }
+
+        // Send all the endpoint notifications
+        for ( auto i : ep_ids ) {
+            nie = new NocInitEvent();
+            nie->command = NocInitEvent::REPORT_ENDPOINT_ID;
+            nie->int_value = i.first;
+            owner->sendUntimed(id,i.second,nie);
+        }
+        break;
+    }
+    case 9:
+    {
+
+        for ( int i = 0; i < local_port_start + local_ports; ++i ) {
+            if ( owner->connected(id,i) ) {
+                credit_event* cr_ev = new credit_event(0,input_buf_size/flit_size);
+                owner->sendUntimed(id,i,cr_ev);
+            }
+        }
+
+        init_state = 10;
+        break;
+    }
+    case 10:
+    {
+        // Receive credits
+        for ( int i = 0; i < local_port_start + local_ports; ++i ) {
+            if ( owner->connected(id,i) ) {
+                credit_event* cr_ev = static_cast<credit_event*>(owner->recvUntimed(id,i));
+                ports[i].credits += cr_ev->credits;
+                delete cr_ev;
+            }
+        }
+        init_state = 11;
+        // Falls through on purpose
+    }
+    default:
+        routeUntimed();
+        break;
+    }
+}
+
+void
+noc_mesh_router::routeUntimed()
+{
+    // Simply route messages that are sent by the endpoints
+    for ( int i = 0; i < local_port_start + local_ports; ++i ) {
+        if ( owner->connected(id,i) ) {
+            bool endpoint = (1 << i) & endpoint_locations;
+            while ( true ) { // Go until there are no more events
+                Event* ev = owner->recvUntimed(id,i);
+                if ( NULL == ev ) break;
+
+                noc_mesh_event* nme;
+                if ( endpoint ) {
+                    NocPacket* packet = static_cast<NocPacket*>(ev);
+                    nme = wrap_incoming_packet(packet);
+
+                }
+                else {
+                    nme = static_cast<noc_mesh_event*>(ev);
+                }
+
+                // Route the packet, but look for broadcasts first
+                if ( nme->egress_port == -1 ) {
+                    // This is a broadcast, need to decide which
+                    // phase we are in:
+                    //
+                    // endpoint: just came from endpoint, need to
+                    // send it all 4 directions.
+                    //
+                    // east/west: if it came from east or west,
+                    // send to opposite direction and north and
+                    // south.
+                    //
+                    // north/south: if it came from north or
+                    // south, just send in opposite direction.
+                    //
+                    // All of these case will deliver to all the
+                    // endpoints (except that we don't send it to
+                    // the endpoint we just got it from if we are
+                    // in that phase).
+
+                    // Send east.  We send east if this came from
+                    // an endpoint or from the west.
+                    if ( endpoint || ( (1 << i ) & west_mask ) ) {
+                        // No need to send east if this is the
+                        // eastern edge
+                        if ( !(edge_status & east_mask) ) {
+                            owner->sendUntimed(id,east_port,nme->clone());
+                        }
+                    }
+
+                    // Send west.  We send west if this came from
+                    // an endpoint or from the east.
+                    if ( endpoint || ( (1 << i ) & east_mask ) ) {
+                        // No need to send east if this is the
+                        // eastern edge
+                        if ( !(edge_status & west_mask) ) {
+                            owner->sendUntimed(id,west_port,nme->clone());
+                        }
+                    }
+
+                    // Send north.  We send north if this came
+                    // from an endpoint, or from the east, west or
+                    // south.
+                    if ( endpoint || ( (1 << i ) & west_mask ) ||
+                         ( (1 << i ) & east_mask ) || ( (1 << i ) & south_mask )) {
+                        // No need to send north if this is the
+                        // northern edge
+                        if ( !(edge_status & north_mask) ) {
+                            owner->sendUntimed(id,north_port,nme->clone());
+                        }
+                    }
+
+                    // Send south.  We send south if this came
+                    // from an endpoint, or from the east, west or
+                    // north.
+                    if ( endpoint || ( (1 << i ) & west_mask ) ||
+                         ( (1 << i ) & east_mask ) || ( (1 << i ) & north_mask )) {
+                        // No need to send south if this is the
+                        // southern edge
+                        if ( !(edge_status & south_mask) ) {
+                            owner->sendUntimed(id,south_port,nme->clone());
+                        }
+                    }
+
+                    // Now send to all the endpoints
+                    bool sent = false;
+                    NocPacket* packet = nme->encap_ev;
+                    nme->encap_ev = NULL;
+                    delete nme;
+                    for ( int j = 0; j < local_port_start + local_ports; ++j ) {
+                        if ( endpoint && ( i == j ) ) continue;  // No need to send back to src
+                        if ( (1 << j) & endpoint_locations ) {
+                            if (!sent) {
+                                owner->sendUntimed(id,j,packet);
+                                sent = true;
+                            }
+                            else {
+                                owner->sendUntimed(id,j,packet->clone());
+                            }
+                        }
+                    }
+                    if ( !sent ) delete packet;
+
+                }
+                else { // Not a broadcast
+                    route(nme);
+                    if ( (1 << nme->next_port) & endpoint_locations ) {
+                        owner->sendUntimed(id,nme->next_port,nme->encap_ev);
+                        nme->encap_ev = NULL;
+                        delete nme;
+                    }
+                    else {
+                        owner->sendUntimed(id,nme->next_port,nme);
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+void
+noc_mesh_router::printStatus(Output& out)
+{
+    out.output("Start Router %s:  id = (%d, %d)\n", name.c_str(), my_x, my_y);
+
+    std::vector<std::pair<std::string,int> > vec;
+    int port = north_port;
+    vec.push_back(std::make_pair("North", port));
+    port = south_port;
+    vec.push_back(std::make_pair("South", port));
+    port = east_port;
+    vec.push_back(std::make_pair("East", port));
+    port = west_port;
+    vec.push_back(std::make_pair("West", port));
+
+    for ( int i = 0; i < local_ports; ++i ) {
+        std::string str = "local_port" + std::to_string(i);
+        vec.push_back(std::make_pair(str,i+local_port_start));
+    }
+
+    // Add local ports
+
+    for ( auto& pinfo : vec ) {
+        out.output("  %s port:\n", pinfo.first.c_str());
+        if ( owner->connected(id,pinfo.second) ) {
+            port_t& p = ports[pinfo.second];
+            out.output("    Port busy = %d\n",p.busy);
+            out.output("    Port credits = %d\n",p.credits);
+            out.output("    Input queue total packets = %lu, head packet info:\n",p.queue.size());
+            if ( p.queue.empty() ) {
+                out.output("      <empty>\n");
+            }
+            else {
+                noc_mesh_event* event = p.queue.front();
+                out.output("      src = %" PRI_NID ", dest = %" PRI_NID ", next_port = %d, flits = %d\n",
+                           event->encap_ev->request->src, event->encap_ev->request->dest,
+                           event->next_port, event->encap_ev->getSizeInFlits());
+            }
+        }
+        else {
+            out.output("    UNUSED\n");
+        }
+    }
+
+    out.output("End Router %s: id = (%d, %d)\n\n", name.c_str(), my_x, my_y);
+}
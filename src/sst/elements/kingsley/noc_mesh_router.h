@@ -0,0 +1,224 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_KINGSLEY_NOC_MESH_ROUTER_H
+#define COMPONENTS_KINGSLEY_NOC_MESH_ROUTER_H
+
+#include <sst/core/event.h>
+#include <sst/core/output.h>
+#include <sst/core/params.h>
+#include <sst/core/unitAlgebra.h>
+#include <sst/core/shared/sharedArray.h>
+
+#include <sst/core/statapi/stataccumulator.h>
+
+#include <queue>
+#include <string>
+#include <vector>
+
+#include "sst/elements/kingsley/nocEvents.h"
+#include "sst/elements/kingsley/lru_unit.h"
+
+using namespace SST;
+
+namespace SST {
+namespace Kingsley {
+
+class noc_mesh_event;
+
+// Router parameters shared by noc_mesh and noc_mesh_tile
+struct noc_mesh_config {
+    int local_ports;
+    int flit_size;
+    int input_buf_size;
+    bool route_y_first;
+    bool use_dense_map;
+    bool port_priority_equal;
+    UnitAlgebra clock_freq;
+
+    noc_mesh_config(Params& params, Output& output, const std::string& type);
+};
+
+/*
+ * One 2-D mesh router: init protocol, routing, arbitration and flow
+ * control.  The router does not own any links or a clock; the
+ * component it lives in (noc_mesh for a single router, noc_mesh_tile
+ * for a block of routers) delivers events to input(), calls tick()
+ * on each clock cycle and moves events between ports through the
+ * Owner interface.
+ */
+class noc_mesh_router {
+
+public:
+
+    static const int north_port = 0;
+    static const int south_port = 1;
+    static const int east_port = 2;
+    static const int west_port = 3;
+    static const int local_port_start = 4;
+
+    static const int north_mask = 1 << north_port;
+    static const int south_mask = 1 << south_port;
+    static const int east_mask = 1 << east_port;
+    static const int west_mask = 1 << west_port;
+
+    // Connects a router to the rest of the network.  rtr is the id
+    // the router was created with.
+    class Owner {
+    public:
+        virtual ~Owner() {}
+
+        virtual bool connected(int rtr, int port) = 0;
+        virtual void send(int rtr, int port, Event* ev) = 0;
+        virtual void sendUntimed(int rtr, int port, Event* ev) = 0;
+        virtual Event* recvUntimed(int rtr, int port) = 0;
+
+        // Called by every router that uses the dense map before it
+        // writes its entries, and after it has written them
+        virtual void initDenseMap(int size) = 0;
+        virtual void publishDenseMap() = 0;
+
+        virtual SimTime_t currentTimeNano() = 0;
+    };
+
+    typedef std::queue<noc_mesh_event*> port_queue_t;
+
+    // Input side of a port plus the state of the output side.
+    // Statistics are registered by the owner.
+    struct port_t {
+        port_queue_t queue;
+        int busy;
+        int credits;
+
+        Statistic<uint64_t>* send_bit_count;
+        Statistic<uint64_t>* output_port_stalls;
+        Statistic<uint64_t>* xbar_stalls;
+
+        port_t() : busy(0), credits(0),
+                   send_bit_count(NULL), output_port_stalls(NULL), xbar_stalls(NULL) {}
+    };
+
+    noc_mesh_router(int id, const std::string& name, const noc_mesh_config& config,
+                    Owner* owner, Shared::SharedArray<int>& dense_map, Output& output);
+    ~noc_mesh_router();
+
+    std::vector<port_t> ports;
+
+    // Handle an event that arrived on port.  Returns true if the
+    // router's clock was off and the owner needs to call wakeup().
+    bool input(int port, Event* ev);
+
+    // Catch up on the cycles the clock was off
+    void wakeup(Cycle_t cycle);
+
+    // Returns true if the router has more work to do next cycle
+    bool tick(Cycle_t cycle);
+    bool isClockOff() const { return clock_is_off; }
+
+    void init();
+    void setup();
+    void routeUntimed();
+
+    void printStatus(Output& out);
+
+private:
+
+    int id;
+    std::string name;
+    Owner* owner;
+    Shared::SharedArray<int>& dense_map;
+    Output& output;
+
+    int local_ports;
+    int flit_size;
+    int input_buf_size;
+    bool route_y_first;
+    bool use_dense_map;
+    bool port_priority_equal;
+
+    int init_state;
+    int init_count;
+    int endpoint_start;
+    int total_endpoints;
+    unsigned int edge_status;
+    unsigned int endpoint_locations;
+
+    int x_size;
+    int y_size;
+
+    int my_x;
+    int my_y;
+
+    bool clock_is_off;
+    Cycle_t last_time;
+
+    std::vector< lru_unit<int> > lru_units;
+
+    noc_mesh_event* wrap_incoming_packet(NocPacket* packet);
+    void route(noc_mesh_event* event);
+
+};
+
+class noc_mesh_event : public BaseNocEvent {
+
+public:
+
+    std::pair<int,int> dest_mesh_loc;
+    int egress_port;
+
+    int next_port;
+    NocPacket* encap_ev;
+
+    noc_mesh_event() :
+        BaseNocEvent(BaseNocEvent::INTERNAL)
+    {
+        encap_ev = NULL;
+    }
+
+    noc_mesh_event(NocPacket* ev) :
+        BaseNocEvent(BaseNocEvent::INTERNAL)
+    {encap_ev = ev;}
+
+    virtual ~noc_mesh_event() {
+        if ( encap_ev != NULL ) delete encap_ev;
+    }
+
+    virtual noc_mesh_event* clone(void) override {
+        noc_mesh_event* ret = new noc_mesh_event(*this);
+        ret->dest_mesh_loc = dest_mesh_loc;
+        ret->egress_port = egress_port;
+        ret->next_port = next_port;
+        ret->encap_ev = encap_ev->clone();
+        return ret;
+    }
+
+    void serialize_order(SST::Core::Serialization::serializer &ser)  override {
+        BaseNocEvent::serialize_order(ser);
+        ser & dest_mesh_loc;
+        ser & egress_port;
+        ser & next_port;
+        ser & encap_ev;
+    }
+
+private:
+    ImplementSerializable(SST::Kingsley::noc_mesh_event)
+
+};
+
+}
+}
+
+#endif // COMPONENTS_KINGSLEY_NOC_MESH_ROUTER_H
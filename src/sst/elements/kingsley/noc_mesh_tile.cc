@@ -0,0 +1,327 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+#include <sst_config.h>
+#include "noc_mesh_tile.h"
+
+#include <sst/core/params.h>
+#include <sst/core/output.h>
+#include <sst/core/timeLord.h>
+#include <sst/core/unitAlgebra.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+#include "nocEvents.h"
+
+using namespace SST::Kingsley;
+using namespace SST::Interfaces;
+using namespace std;
+
+
+noc_mesh_tile::~noc_mesh_tile()
+{
+    for ( auto& d : in_flight ) {
+        delete d.ev;
+    }
+    for ( auto r : routers ) {
+        delete r;
+    }
+}
+
+noc_mesh_tile::noc_mesh_tile(ComponentId_t cid, Params& params) :
+    Component(cid),
+    current_cycle(0),
+    dense_map_initialized(false),
+    dense_map_writers(0),
+    output(getSimulationOutput())
+{
+    tile_x = params.find<int>("tile_x",2);
+    tile_y = params.find<int>("tile_y",2);
+    if ( tile_x < 1 || tile_y < 1 ) {
+        output.fatal(CALL_INFO, -1, "noc_mesh_tile requires tile_x and tile_y to be at least 1\n");
+    }
+
+    // Parse the router and timing parameters
+    noc_mesh_config config(params, output, "noc_mesh_tile");
+    int local_ports = config.local_ports;
+    num_ports = local_port_start + local_ports;
+
+    // Register the clock
+    my_clock_handler = new Clock::Handler<noc_mesh_tile>(this,&noc_mesh_tile::clock_handler);
+    clock_tc = registerClock( config.clock_freq, my_clock_handler);
+    clock_is_off = false;
+
+    // An event sent on a link of latency L at cycle c is seen by the
+    // receiving router's clock handler at cycle c + floor(L/period) + 1
+    // (clocks fire before link events with the same timestamp).
+    // Internal links deliver on exactly that cycle.
+    UnitAlgebra internal_latency = params.find<UnitAlgebra>("internal_latency","800ps");
+    if ( !internal_latency.hasUnits("s") ) {
+        output.fatal(CALL_INFO, -1, "noc_mesh_tile: internal_latency must be specified in units of s\n");
+    }
+    internal_delay = getTimeConverter(internal_latency)->getFactor() / clock_tc->getFactor() + 1;
+
+    // Configure all the ports and add all the statistics
+    routers.resize(tile_x * tile_y);
+    links.resize(tile_x * tile_y);
+    for ( int j = 0; j < tile_y; ++j ) {
+        for ( int i = 0; i < tile_x; ++i ) {
+            int rtr = j * tile_x + i;
+            routers[rtr] = new noc_mesh_router(rtr, getName(), config, this, dense_map, output);
+            std::vector<tile_link>& l = links[rtr];
+            l.resize(num_ports);
+
+            // North port
+            if ( j == tile_y - 1 ) {
+                l[north_port].link = configureLink("north" + std::to_string(i),
+                    new Event::Handler<noc_mesh_tile,int>(this,&noc_mesh_tile::handle_input,rtr * num_ports + north_port));
+            }
+            else {
+                l[north_port].peer_rtr = rtr + tile_x;
+                l[north_port].peer_port = south_port;
+            }
+
+            // South port
+            if ( j == 0 ) {
+                l[south_port].link = configureLink("south" + std::to_string(i),
+                    new Event::Handler<noc_mesh_tile,int>(this,&noc_mesh_tile::handle_input,rtr * num_ports + south_port));
+            }
+            else {
+                l[south_port].peer_rtr = rtr - tile_x;
+                l[south_port].peer_port = north_port;
+            }
+
+            // East port
+            if ( i == tile_x - 1 ) {
+                l[east_port].link = configureLink("east" + std::to_string(j),
+                    new Event::Handler<noc_mesh_tile,int>(this,&noc_mesh_tile::handle_input,rtr * num_ports + east_port));
+            }
+            else {
+                l[east_port].peer_rtr = rtr + 1;
+                l[east_port].peer_port = west_port;
+            }
+
+            // West port
+            if ( i == 0 ) {
+                l[west_port].link = configureLink("west" + std::to_string(j),
+                    new Event::Handler<noc_mesh_tile,int>(this,&noc_mesh_tile::handle_input,rtr * num_ports + west_port));
+            }
+            else {
+                l[west_port].peer_rtr = rtr - 1;
+                l[west_port].peer_port = east_port;
+            }
+
+            // Local ports
+            for ( int n = 0; n < local_ports; ++n ) {
+                l[local_port_start + n].link = configureLink("local" + std::to_string(rtr * local_ports + n),
+                    new Event::Handler<noc_mesh_tile,int>(this,&noc_mesh_tile::handle_input,rtr * num_ports + local_port_start + n));
+            }
+
+            // stats
+            std::vector<noc_mesh_router::port_t>& rports = routers[rtr]->ports;
+            std::string prefix = std::to_string(i) + "_" + std::to_string(j) + ".";
+            for ( int p = 0; p < num_ports; ++p ) {
+                std::string port_name;
+                switch ( p ) {
+                case north_port: port_name = "north"; break;
+                case south_port: port_name = "south"; break;
+                case east_port: port_name = "east"; break;
+                case west_port: port_name = "west"; break;
+                default: port_name = "local" + std::to_string(p - local_port_start); break;
+                }
+                rports[p].send_bit_count = registerStatistic<uint64_t>("send_bit_count",prefix + port_name);
+                rports[p].output_port_stalls = registerStatistic<uint64_t>("output_port_stalls",prefix + port_name);
+                rports[p].xbar_stalls = registerStatistic<uint64_t>("xbar_stalls",prefix + port_name);
+            }
+        }
+    }
+}
+
+void
+noc_mesh_tile::handle_input(Event* ev, int id)
+{
+    input(id / num_ports, id % num_ports, ev, next_cycle());
+}
+
+void
+noc_mesh_tile::input(int rtr, int port, Event* ev, Cycle_t cycle)
+{
+    if ( routers[rtr]->input(port, ev) ) {
+        routers[rtr]->wakeup(cycle);
+    }
+}
+
+Cycle_t
+noc_mesh_tile::next_cycle()
+{
+    if ( clock_is_off ) {
+        clock_is_off = false;
+        return reregisterClock(clock_tc, my_clock_handler);
+    }
+    return getNextClockCycle(clock_tc);
+}
+
+bool
+noc_mesh_tile::clock_handler(Cycle_t cycle)
+{
+    current_cycle = cycle;
+
+    // Deliver everything on the internal links that has arrived
+    while ( !in_flight.empty() && in_flight.front().cycle <= cycle ) {
+        internal_delivery d = in_flight.front();
+        in_flight.pop_front();
+        input(d.rtr, d.port, d.ev, cycle);
+    }
+
+    bool keepClockOn = !in_flight.empty();
+    for ( auto r : routers ) {
+        if ( r->isClockOff() ) continue;
+        if ( r->tick(cycle) ) keepClockOn = true;
+    }
+
+    clock_is_off = !keepClockOn;
+
+    // Stay on clock list
+    return !keepClockOn;
+}
+
+void noc_mesh_tile::setup()
+{
+    for ( auto r : routers ) {
+        r->setup();
+    }
+}
+
+void noc_mesh_tile::finish()
+{
+}
+
+void
+noc_mesh_tile::init(unsigned int phase)
+{
+    advanceUntimed();
+
+    // Each router in the block runs the init protocol independently;
+    // see noc_mesh_router::init() for a description of the states
+    for ( auto r : routers ) {
+        r->init();
+    }
+}
+
+void
+noc_mesh_tile::complete(unsigned int phase)
+{
+    advanceUntimed();
+
+    for ( auto r : routers ) {
+        r->routeUntimed();
+    }
+}
+
+bool
+noc_mesh_tile::connected(int rtr, int port)
+{
+    return links[rtr][port].connected();
+}
+
+void
+noc_mesh_tile::send(int rtr, int port, Event* ev)
+{
+    tile_link& l = links[rtr][port];
+    if ( l.link ) {
+        l.link->send(ev);
+    }
+    else if ( l.peer_rtr != -1 ) {
+        internal_delivery d;
+        d.cycle = current_cycle + internal_delay;
+        d.rtr = l.peer_rtr;
+        d.port = l.peer_port;
+        d.ev = ev;
+        in_flight.push_back(d);
+    }
+    else {
+        output.fatal(CALL_INFO, -1, "%s: router %d tried to send on unconnected port %d\n",
+                     getName().c_str(), rtr, port);
+    }
+}
+
+void
+noc_mesh_tile::sendUntimed(int rtr, int port, Event* ev)
+{
+    tile_link& l = links[rtr][port];
+    if ( l.link ) {
+        l.link->sendUntimedData(ev);
+    }
+    else if ( l.peer_rtr != -1 ) {
+        links[l.peer_rtr][l.peer_port].untimed_next.push_back(ev);
+    }
+    else {
+        output.fatal(CALL_INFO, -1, "%s: router %d tried to send untimed data on unconnected port %d\n",
+                     getName().c_str(), rtr, port);
+    }
+}
+
+Event*
+noc_mesh_tile::recvUntimed(int rtr, int port)
+{
+    tile_link& l = links[rtr][port];
+    if ( l.link ) return l.link->recvUntimedData();
+    if ( l.untimed_in.empty() ) return NULL;
+    Event* ev = l.untimed_in.front();
+    l.untimed_in.pop_front();
+    return ev;
+}
+
+void
+noc_mesh_tile::advanceUntimed()
+{
+    // Untimed data sent inside the block during the last phase becomes
+    // visible now, the same as it would on a link
+    for ( auto& rl : links ) {
+        for ( auto& l : rl ) {
+            while ( !l.untimed_next.empty() ) {
+                l.untimed_in.push_back(l.untimed_next.front());
+                l.untimed_next.pop_front();
+            }
+        }
+    }
+}
+
+void
+noc_mesh_tile::initDenseMap(int size)
+{
+    // All the routers in the block share one SharedArray, so only
+    // initialize it once
+    if ( !dense_map_initialized ) {
+        dense_map.initialize("noc_mesh_dense_map", size);
+        dense_map_initialized = true;
+    }
+}
+
+void
+noc_mesh_tile::publishDenseMap()
+{
+    // Publish after the last router has written its entries
+    if ( ++dense_map_writers == (int)routers.size() ) {
+        dense_map.publish();
+    }
+}
+
+SimTime_t
+noc_mesh_tile::currentTimeNano()
+{
+    return getCurrentSimTimeNano();
+}
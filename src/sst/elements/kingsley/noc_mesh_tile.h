@@ -0,0 +1,188 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_KINGSLEY_NOC_MESH_TILE_H
+#define COMPONENTS_KINGSLEY_NOC_MESH_TILE_H
+
+#include <sst/core/clock.h>
+#include <sst/core/component.h>
+#include <sst/core/event.h>
+#include <sst/core/link.h>
+#include <sst/core/output.h>
+#include <sst/core/timeConverter.h>
+#include <sst/core/shared/sharedArray.h>
+
+#include <sst/core/statapi/stataccumulator.h>
+
+#include <deque>
+#include <vector>
+
+#include "sst/elements/kingsley/nocEvents.h"
+#include "sst/elements/kingsley/noc_mesh_router.h"
+
+using namespace SST;
+
+namespace SST {
+namespace Kingsley {
+
+/*
+ * A tile_x by tile_y block of noc_mesh routers simulated in a single
+ * component.  Links between routers in the block are replaced by
+ * queues inside the component; only endpoint ports and ports on the
+ * edge of the block are SST links.  Each router is a noc_mesh_router,
+ * the same router noc_mesh is built on, and internal
+ * links deliver with the same cycle delay a link with latency
+ * internal_latency would have, so a mesh built from tiles (or a mix
+ * of tiles and noc_mesh routers) is cycle-identical to one built
+ * entirely from noc_mesh routers.
+ *
+ * Router (i,j) of the block is column i, row j, with row 0 at the
+ * south edge.
+ */
+class noc_mesh_tile : public Component, public noc_mesh_router::Owner {
+
+public:
+
+    SST_ELI_REGISTER_COMPONENT(
+        noc_mesh_tile,
+        "kingsley",
+        "noc_mesh_tile",
+        SST_ELI_ELEMENT_VERSION(0,1,0),
+        "Block of 2-D mesh NOC routers simulated in one component",
+        COMPONENT_CATEGORY_NETWORK)
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"tile_x",             "Number of router columns in the block.","2"},
+        {"tile_y",             "Number of router rows in the block.","2"},
+        {"internal_latency",   "Latency of the links between routers inside the block.  Should match the latency of the links between blocks.","800ps"},
+        {"local_ports",        "Number of ports on each router that are dedicated to endpoints.","1"},
+        {"link_bw",            "Bandwidth of the links specified in either b/s or B/s (can include SI prefix)."},
+        {"flit_size",          "Flit size specified in either b or B (can include SI prefix)."},
+        {"input_buf_size",     "Size of input buffers in either b or B (can use SI prefix).  Default is 2*flit_size."},
+        {"port_priority_equal","Set to true to have all port have equal priority (usually endpoint ports have higher priority).","false"},
+        {"route_y_first",      "Set to true to rout Y-dimension first.","false"},
+        {"use_dense_map",      "Set to true to have a dense network id map instead of the sparse map normally used.","false"},
+    )
+
+    SST_ELI_DOCUMENT_PORTS(
+        { "north%(tile_x)d", "North ports of the northern row of routers, indexed by column", {} },
+        { "south%(tile_x)d", "South ports of the southern row of routers, indexed by column", {} },
+        { "east%(tile_y)d",  "East ports of the eastern column of routers, indexed by row",  {} },
+        { "west%(tile_y)d",  "West ports of the western column of routers, indexed by row",  {} },
+        { "local%(tile_x*tile_y*local_ports)d",  "Ports which connect to endpoints.  Router (i,j) uses local((j*tile_x+i)*local_ports+n).", { } }
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        { "send_bit_count",     "Count number of bits sent on link", "bits", 1},
+        { "output_port_stalls", "Time output port is stalled (in units of core timebase)", "time in stalls", 1},
+        { "xbar_stalls",        "Count number of cycles the xbar is stalled", "cycles", 1},
+    )
+
+    static const int north_port = noc_mesh_router::north_port;
+    static const int south_port = noc_mesh_router::south_port;
+    static const int east_port = noc_mesh_router::east_port;
+    static const int west_port = noc_mesh_router::west_port;
+    static const int local_port_start = noc_mesh_router::local_port_start;
+
+    static const int north_mask = noc_mesh_router::north_mask;
+    static const int south_mask = noc_mesh_router::south_mask;
+    static const int east_mask = noc_mesh_router::east_mask;
+    static const int west_mask = noc_mesh_router::west_mask;
+
+    // noc_mesh_router::Owner
+    bool connected(int rtr, int port) override;
+    void send(int rtr, int port, Event* ev) override;
+    void sendUntimed(int rtr, int port, Event* ev) override;
+    Event* recvUntimed(int rtr, int port) override;
+    void initDenseMap(int size) override;
+    void publishDenseMap() override;
+    SimTime_t currentTimeNano() override;
+
+private:
+
+    // Connection of one router port.  A port is either an SST link
+    // (edge of block or endpoint), a connection to a neighbouring
+    // router in the block, or unconnected.
+    struct tile_link {
+        Link* link;
+        int peer_rtr;
+        int peer_port;
+
+        // Untimed data from a router in the block.  Data sent in one
+        // phase is moved to untimed_in at the start of the next.
+        std::deque<Event*> untimed_in;
+        std::deque<Event*> untimed_next;
+
+        tile_link() : link(NULL), peer_rtr(-1), peer_port(-1) {}
+
+        bool connected() const { return link != NULL || peer_rtr != -1; }
+    };
+
+    // Event in flight on a link inside the block
+    struct internal_delivery {
+        Cycle_t cycle;
+        int rtr;
+        int port;
+        Event* ev;
+    };
+
+    int tile_x;
+    int tile_y;
+    int num_ports;
+
+    // Router (i,j) of the block has id j * tile_x + i
+    std::vector<noc_mesh_router*> routers;
+    std::vector< std::vector<tile_link> > links;
+
+    // Internal links all have the same latency, so deliveries are
+    // always scheduled in cycle order
+    std::deque<internal_delivery> in_flight;
+    Cycle_t internal_delay;
+
+    Clock::Handler<noc_mesh_tile>* my_clock_handler;
+    TimeConverter* clock_tc;
+    bool clock_is_off;
+    Cycle_t current_cycle;
+
+    Shared::SharedArray<int> dense_map;
+    bool dense_map_initialized;
+    int dense_map_writers;
+
+    Output& output;
+
+    bool clock_handler(Cycle_t cycle);
+    Cycle_t next_cycle();
+
+    void handle_input(Event* ev, int id);
+    void input(int rtr, int port, Event* ev, Cycle_t cycle);
+
+    void advanceUntimed();
+
+public:
+    noc_mesh_tile(ComponentId_t cid, Params& params);
+    ~noc_mesh_tile();
+
+    void init(unsigned int phase);
+    void complete(unsigned int phase);
+    void setup();
+    void finish();
+
+};
+
+}
+}
+
+#endif // COMPONENTS_KINGSLEY_NOC_MESH_TILE_H
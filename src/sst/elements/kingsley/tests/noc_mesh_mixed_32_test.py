@@ -0,0 +1,149 @@
+# Automatically generated SST Python input
+import sst
+
+# Same network as noc_mesh_32_test.py, but with the southwest and
+# northeast 2x2 blocks of routers built as kingsley.noc_mesh_tile and
+# the other two blocks built from kingsley.noc_mesh routers.  Output
+# should match the noc_mesh_32_test reference file exactly.
+
+sst.setProgramOption("timebase", "1ps")
+
+x_size = 4
+y_size = 4
+
+tile_x = 2
+tile_y = 2
+
+links = dict()
+def getLink(name1, name2):
+    name = "link.%s_%s"%(name1, name2)
+    if name not in links:
+        links[name] = sst.Link(name)
+    return links[name]
+
+num_endpoints = 1
+
+num_peers = (num_endpoints * (x_size * y_size)) + (2*x_size) + (2*y_size)
+num_messages = 10
+msg_size = "64B"
+link_bw = "32GB/s"
+flit_size = "32B"
+input_buf_size = "64B"
+
+router_params = {
+    "local_ports" : "%d"%(num_endpoints),
+    "link_bw" : link_bw,
+    "input_buf_size" : input_buf_size,
+    "flit_size" : flit_size,
+    "use_dense_map" : "true"
+}
+
+def addEndpoint(name, link):
+    ep = sst.Component(name, "merlin.test_nic")
+    ep.addParams({
+        "num_peers" : "%d"%(num_peers),
+        "link_bw" : "1GB/s",
+        "linkcontrol_type" : "kingsley.linkcontrol",
+        "message_size" : msg_size,
+        "num_messages" : "%d"%(num_messages)
+    })
+    sub = ep.setSubComponent("networkIF","kingsley.linkcontrol")
+    sub.addParam("link_bw","1GB/s")
+    sub.addLink(link, "rtr_port", "800ps")
+
+# Connect port on comp, which belongs to router (x,y), using the same
+# link and endpoint names as noc_mesh_32_test.py
+def connectNorth(comp, port, x, y):
+    if y != y_size - 1:
+        comp.addLink(getLink("rtr_%d_%d"%(x,y), "rtr_%d_%d"%(x,y+1)), port, "800ps")
+    else:
+        link = getLink("rtr_%d_%d"%(x,y), "ep0_%d_%d"%(x,y+1))
+        comp.addLink(link, port, "800ps")
+        addEndpoint("ep0_%d_%d"%(x,y+1), link)
+
+def connectSouth(comp, port, x, y):
+    if y != 0:
+        comp.addLink(getLink("rtr_%d_%d"%(x,y-1), "rtr_%d_%d"%(x,y)), port, "800ps")
+    else:
+        link = getLink("rtr_%d_X"%(x), "ep0_%d_%d"%(x,y))
+        comp.addLink(link, port, "800ps")
+        addEndpoint("ep0_%d_X"%(x), link)
+
+def connectEast(comp, port, x, y):
+    if x != x_size - 1:
+        comp.addLink(getLink("rtr_%d_%d"%(x,y), "rtr_%d_%d"%(x+1,y)), port, "800ps")
+    else:
+        link = getLink("rtr_%d_%d"%(x,y), "ep0_%d_%d"%(x+1,y))
+        comp.addLink(link, port, "800ps")
+        addEndpoint("ep0_%d_%d"%(x+1,y), link)
+
+def connectWest(comp, port, x, y):
+    if x != 0:
+        comp.addLink(getLink("rtr_%d_%d"%(x-1,y), "rtr_%d_%d"%(x,y)), port, "800ps")
+    else:
+        link = getLink("rtr_X_%d"%(y), "ep0_%d_%d"%(x,y))
+        comp.addLink(link, port, "800ps")
+        addEndpoint("ep0_X_%d"%(y), link)
+
+def connectLocal(comp, port, x, y, z):
+    link = getLink("rtr_%d_%d"%(x,y), "ep%d_%d_%d"%(z,x,y))
+    comp.addLink(link, port, "800ps")
+    addEndpoint("ep%d_%d_%d"%(z,x,y), link)
+
+def buildTile(tx, ty):
+    tile = sst.Component("tile_%d_%d"%(tx,ty), "kingsley.noc_mesh_tile")
+    tile.addParams(router_params)
+    tile.addParams({
+        "tile_x" : tile_x,
+        "tile_y" : tile_y,
+        "internal_latency" : "800ps"
+    })
+
+    for i in range(tile_x):
+        x = tx * tile_x + i
+        connectNorth(tile, "north%d"%i, x, ty * tile_y + tile_y - 1)
+        connectSouth(tile, "south%d"%i, x, ty * tile_y)
+
+    for j in range(tile_y):
+        y = ty * tile_y + j
+        connectEast(tile, "east%d"%j, tx * tile_x + tile_x - 1, y)
+        connectWest(tile, "west%d"%j, tx * tile_x, y)
+
+    for j in range(tile_y):
+        for i in range(tile_x):
+            for z in range(num_endpoints):
+                connectLocal(tile, "local%d"%((j * tile_x + i) * num_endpoints + z),
+                             tx * tile_x + i, ty * tile_y + j, z)
+
+def buildRouters(tx, ty):
+    for j in range(tile_y):
+        for i in range(tile_x):
+            x = tx * tile_x + i
+            y = ty * tile_y + j
+            rtr = sst.Component("rtr_%d_%d"%(x,y), "kingsley.noc_mesh")
+            rtr.addParams(router_params)
+            connectNorth(rtr, "north", x, y)
+            connectSouth(rtr, "south", x, y)
+            connectEast(rtr, "east", x, y)
+            connectWest(rtr, "west", x, y)
+            for z in range(num_endpoints):
+                connectLocal(rtr, "local%d"%(z), x, y, z)
+
+for ty in range(y_size // tile_y):
+    for tx in range(x_size // tile_x):
+        if tx == ty:
+            buildTile(tx, ty)
+        else:
+            buildRouters(tx, ty)
+
+
+sst.setStatisticLoadLevel(9)
+
+sst.setStatisticOutput("sst.statOutputCSV");
+sst.setStatisticOutputOptions({
+    "filepath" : "stats.csv",
+    "separator" : ", "
+})
+
+sst.enableAllStatisticsForComponentType("kingsley.noc_mesh", {"type":"sst.AccumulatorStatistic","rate":"0ns"})
+sst.enableAllStatisticsForComponentType("kingsley.noc_mesh_tile", {"type":"sst.AccumulatorStatistic","rate":"0ns"})
@@ -0,0 +1,118 @@
+# Automatically generated SST Python input
+import sst
+
+# Same network as noc_mesh_32_test.py, but built from 2x2 blocks of
+# routers (kingsley.noc_mesh_tile).  Output should match the
+# noc_mesh_32_test reference file exactly.
+
+sst.setProgramOption("timebase", "1ps")
+
+x_size = 4
+y_size = 4
+
+tile_x = 2
+tile_y = 2
+
+links = dict()
+def getLink(name1, name2):
+    name = "link.%s_%s"%(name1, name2)
+    if name not in links:
+        links[name] = sst.Link(name)
+    return links[name]
+
+num_endpoints = 1
+
+num_peers = (num_endpoints * (x_size * y_size)) + (2*x_size) + (2*y_size)
+num_messages = 10
+msg_size = "64B"
+link_bw = "32GB/s"
+flit_size = "32B"
+input_buf_size = "64B"
+
+def addEndpoint(name, link):
+    ep = sst.Component(name, "merlin.test_nic")
+    ep.addParams({
+        "num_peers" : "%d"%(num_peers),
+        "link_bw" : "1GB/s",
+        "linkcontrol_type" : "kingsley.linkcontrol",
+        "message_size" : msg_size,
+        "num_messages" : "%d"%(num_messages)
+    })
+    sub = ep.setSubComponent("networkIF","kingsley.linkcontrol")
+    sub.addParam("link_bw","1GB/s")
+    sub.addLink(link, "rtr_port", "800ps")
+
+for ty in range(y_size // tile_y):
+    for tx in range(x_size // tile_x):
+        tile = sst.Component("tile_%d_%d"%(tx,ty), "kingsley.noc_mesh_tile")
+        tile.addParams({
+            "tile_x" : tile_x,
+            "tile_y" : tile_y,
+            "internal_latency" : "800ps",
+            "local_ports" : "%d"%(num_endpoints),
+            "link_bw" : link_bw,
+            "input_buf_size" : input_buf_size,
+            "flit_size" : flit_size,
+            "use_dense_map" : "true"
+        })
+
+        # North and south edges of the block, indexed by column
+        for i in range(tile_x):
+            x = tx * tile_x + i
+
+            y = ty * tile_y + tile_y - 1
+            if y != y_size - 1:
+                tile.addLink(getLink("rtr_%d_%d"%(x,y), "rtr_%d_%d"%(x,y+1)), "north%d"%i, "800ps")
+            else:
+                link = getLink("rtr_%d_%d"%(x,y), "ep0_%d_%d"%(x,y+1))
+                tile.addLink(link, "north%d"%i, "800ps")
+                addEndpoint("ep0_%d_%d"%(x,y+1), link)
+
+            y = ty * tile_y
+            if y != 0:
+                tile.addLink(getLink("rtr_%d_%d"%(x,y-1), "rtr_%d_%d"%(x,y)), "south%d"%i, "800ps")
+            else:
+                link = getLink("rtr_%d_X"%(x), "ep0_%d_%d"%(x,y))
+                tile.addLink(link, "south%d"%i, "800ps")
+                addEndpoint("ep0_%d_X"%(x), link)
+
+        # East and west edges of the block, indexed by row
+        for j in range(tile_y):
+            y = ty * tile_y + j
+
+            x = tx * tile_x + tile_x - 1
+            if x != x_size - 1:
+                tile.addLink(getLink("rtr_%d_%d"%(x,y), "rtr_%d_%d"%(x+1,y)), "east%d"%j, "800ps")
+            else:
+                link = getLink("rtr_%d_%d"%(x,y), "ep0_%d_%d"%(x+1,y))
+                tile.addLink(link, "east%d"%j, "800ps")
+                addEndpoint("ep0_%d_%d"%(x+1,y), link)
+
+            x = tx * tile_x
+            if x != 0:
+                tile.addLink(getLink("rtr_%d_%d"%(x-1,y), "rtr_%d_%d"%(x,y)), "west%d"%j, "800ps")
+            else:
+                link = getLink("rtr_X_%d"%(y), "ep0_%d_%d"%(x,y))
+                tile.addLink(link, "west%d"%j, "800ps")
+                addEndpoint("ep0_X_%d"%(y), link)
+
+        # Add endpoints
+        for j in range(tile_y):
+            for i in range(tile_x):
+                x = tx * tile_x + i
+                y = ty * tile_y + j
+                for z in range(num_endpoints):
+                    link = getLink("rtr_%d_%d"%(x,y), "ep%d_%d_%d"%(z,x,y))
+                    tile.addLink(link, "local%d"%((j * tile_x + i) * num_endpoints + z), "800ps")
+                    addEndpoint("ep%d_%d_%d"%(z,x,y), link)
+
+
+sst.setStatisticLoadLevel(9)
+
+sst.setStatisticOutput("sst.statOutputCSV");
+sst.setStatisticOutputOptions({
+    "filepath" : "stats.csv",
+    "separator" : ", "
+})
+
+sst.enableAllStatisticsForComponentType("kingsley.noc_mesh_tile", {"type":"sst.AccumulatorStatistic","rate":"0ns"})
@@ -19,9 +19,18 @@ class testcase_kingsley_Component(SSTTestCase):
     def test_kingsly_noc_mesh_32(self):
         self.kingsley_test_template("noc_mesh_32_test")
 
+    def test_kingsly_noc_mesh_tile_32(self):
+        # Tiled version of noc_mesh_32 must match the untiled reference
+        self.kingsley_test_template("noc_mesh_tile_32_test", "noc_mesh_32_test")
+
+    def test_kingsly_noc_mesh_mixed_32(self):
+        # Tiles and noc_mesh routers in one mesh must also match the
+        # untiled reference
+        self.kingsley_test_template("noc_mesh_mixed_32_test", "noc_mesh_32_test")
+
 #####
 
-    def kingsley_test_template(self, testcase):
+    def kingsley_test_template(self, testcase, reftestcase = None):
         # Get the path to the test files
         test_path = self.get_testsuite_dir()
         outdir = self.get_test_output_run_dir()
@@ -31,7 +40,9 @@ class testcase_kingsley_Component(SSTTestCase):
         testDataFileName="test_kingsley_{0}".format(testcase)
 
         sdlfile = "{0}/{1}.py".format(test_path, testcase)
-        reffile = "{0}/refFiles/{1}.out".format(test_path, testDataFileName)
+        if reftestcase is None:
+            reftestcase = testcase
+        reffile = "{0}/refFiles/test_kingsley_{1}.out".format(test_path, reftestcase)
         outfile = "{0}/{1}.out".format(outdir, testDataFileName)
         errfile = "{0}/{1}.err".format(outdir, testDataFileName)
         mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
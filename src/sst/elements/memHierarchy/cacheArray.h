@@ -25,6 +25,7 @@
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/replacementManager.h"
 #include "sst/elements/memHierarchy/lineTypes.h"
+#include "sst/elements/memHierarchy/snapshot.h"
 
 using namespace std;
 
@@ -33,6 +34,10 @@ namespace SST { namespace MemHierarchy {
 /*
  * CacheArrays should  be templated on a line type
  * See the comment in lineTypes.h for the required API
+ *
+ * A sectored array groups 'sectors' consecutive lines under one tag. Each line
+ * (sector) keeps its own coherence state, so sectors are fetched and written
+ * back individually, but allocation and replacement are done per block.
  */
 
 template <class T>
@@ -52,9 +57,23 @@ class CacheArray {
         vector<T*>      lines_; // The actual cache
         State* setStates;
         std::map<unsigned int, std::vector<ReplacementInfo*> > rInfo;   // Lookup a vector of replacementInfo by set ID
+
+        /* Sectored arrays */
+        unsigned int    sectors_;       // Lines per tag, 1 if the array is not sectored
+        unsigned int    sectorOffset_;  // log2(sectors_)
+        vector<Addr>    blockTags_;     // Block number held by each block
+        vector<CoherenceReplacementInfo*> blockInfo_; // Replacement state of each block, summarized from its sectors
+        bool            coherenceInfo_; // Whether the line type tracks shared/owned for replacement
+
+        /* Compressed arrays */
+        Compressor*     compressor_;    // nullptr if the array is not compressed
+        unsigned int    linesPerWay_;   // Tags per way of data, 1 if the array is not compressed
+        uint64_t        setCapacity_;   // Bytes of data per set
+
+        void updateBlockInfo(unsigned int block);
     public:
 
-        CacheArray(Output* dbg, unsigned int numLines, unsigned int associativity, uint32_t lineSize, ReplacementPolicy* replacementMgr, HashFunction* hash);
+        CacheArray(Output* dbg, unsigned int numLines, unsigned int associativity, uint32_t lineSize, ReplacementPolicy* replacementMgr, HashFunction* hash, unsigned int sectors = 1);
 
         /** Destructor - Delete all cache line objects */
         virtual ~CacheArray();
@@ -85,6 +104,45 @@ class CacheArray {
         /** Deallocate a line and notify replacement manager that it's been deallocated */
         void deallocate(T* candidate);
 
+    /**** Sectored arrays */
+
+        /** Number of lines that share a tag */
+        unsigned int getSectorCount() { return sectors_; }
+
+        /** Return a sector in the same block as 'line' that is not in state I, or nullptr if there is none.
+         *  A block can only be replaced once this returns nullptr. Always nullptr if the array is not sectored. */
+        T * findValidSector(T* line);
+
+    /**** Compressed arrays */
+
+        /** Compress the array's data. The array must have been constructed with 'linesPerWay' times as many lines (tags)
+         *  as the data array holds; each set then holds as many lines as fit in associativity/linesPerWay uncompressed lines */
+        void setCompression(Compressor* compressor, unsigned int linesPerWay);
+
+        /** Whether the array is compressed */
+        bool isCompressed() { return compressor_ != nullptr; }
+
+        /** Return a line that must also be evicted before 'line' can be replaced, or nullptr if there is none.
+         *  Covers the other sectors of a sectored block and the data space of a compressed set. */
+        T * findNextVictim(T* line);
+
+        /** Cycles to decompress 'line' on a read, 0 if the array is not compressed */
+        uint64_t getDecompressionLatency(T* line) {
+            return compressor_ ? compressor_->decompress(line->getCompressedSize(), lineSize_) : 0;
+        }
+
+    /**** Warm-start snapshots */
+
+        /** Save geometry, every valid line and the replacement state. Lines must be in stable states */
+        void snapshot(SnapshotWriter &out);
+
+        /** Restore a snapshot into a freshly constructed array. Fails if the geometry does not match */
+        void restore(SnapshotReader &in);
+
+        /** Line by index, e.g., to relink lines across arrays after a restore */
+        unsigned int getNumLines() { return numLines_; }
+        T * getLine(unsigned int index) { return lines_[index]; }
+
     /**** Configuration and output */
         void setSliceAware(Addr size, Addr step);
         void setBanked(unsigned int numBanks);
@@ -94,8 +152,8 @@ class CacheArray {
 /************* Function definitions *****************/
 
 template <class T>
-CacheArray<T>::CacheArray(Output* dbg, unsigned int numLines, unsigned int associativity, uint32_t lineSize, ReplacementPolicy* replacementMgr, HashFunction* hash) :
-    dbg_(dbg), numLines_(numLines), associativity_(associativity), lineSize_(lineSize), replacementMgr_(replacementMgr), hash_(hash) {
+CacheArray<T>::CacheArray(Output* dbg, unsigned int numLines, unsigned int associativity, uint32_t lineSize, ReplacementPolicy* replacementMgr, HashFunction* hash, unsigned int sectors) :
+    dbg_(dbg), numLines_(numLines), associativity_(associativity), lineSize_(lineSize), replacementMgr_(replacementMgr), hash_(hash), sectors_(sectors), compressor_(nullptr), linesPerWay_(1) {
 
     // Error check parameters
     if (numLines_ == 0)
@@ -104,14 +162,24 @@ CacheArray<T>::CacheArray(Output* dbg, unsigned int numLines, unsigned int assoc
     if (associativity_ == 0)
         dbg_->fatal(CALL_INFO, -1, "CacheArray, Error: associativity is 0. Use 1 for direct mapped, 2 or more for set-associative.\n");
 
-    numSets_ = numLines_ / associativity_;
+    if (sectors_ == 0 || !isPowerOfTwo(sectors_))
+        dbg_->fatal(CALL_INFO, -1, "CacheArray, Error: number of sectors per line must be a power of 2. Number of sectors = %u.\n", sectors_);
+
+    if (numLines_ % sectors_ != 0)
+        dbg_->fatal(CALL_INFO, -1, "CacheArray, Error: The number of cachelines is not divisible by the number of sectors per tag. Number of lines = %u. Sectors = %u\n",
+                numLines_, sectors_);
+
+    sectorOffset_ = log2Of(sectors_);
+    unsigned int numBlocks = numLines_ / sectors_;
+
+    numSets_ = numBlocks / associativity_;
 
     if (numSets_ == 0)
-        dbg_->fatal(CALL_INFO, -1, "CacheArray, Error: number of sets (number of lines / associativity) is 0. Must be at least 1. Number of lines = %u. Associativity = %u.\n",
-                        numLines_, associativity_);
-    if ((numSets_ * associativity_) != numLines_)
-        dbg_->fatal(CALL_INFO, -1, "CacheArray, Error: The number of cachelines is not divisible by the cache associativity. Ensure (lines mod associativiy = 0). Number of lines = %u. Associativity = %u\n",
-                numLines_, associativity_);
+        dbg_->fatal(CALL_INFO, -1, "CacheArray, Error: number of sets (number of blocks / associativity) is 0. Must be at least 1. Number of blocks (lines / sectors) = %u. Associativity = %u.\n",
+                        numBlocks, associativity_);
+    if ((numSets_ * associativity_) != numBlocks)
+        dbg_->fatal(CALL_INFO, -1, "CacheArray, Error: The number of blocks is not divisible by the cache associativity. Ensure (blocks mod associativity = 0). Number of blocks (lines / sectors) = %u. Associativity = %u\n",
+                numBlocks, associativity_);
 
     lineOffset_ = log2Of(lineSize_);
     lines_.resize(numLines_);
@@ -125,14 +193,26 @@ CacheArray<T>::CacheArray(Output* dbg, unsigned int numLines, unsigned int assoc
         lines_[i] = new T(lineSize_, i);
     }
 
+    // Sectored arrays replace whole blocks, so the replacement manager sees one entry per block
+    coherenceInfo_ = dynamic_cast<CoherenceReplacementInfo*>(lines_[0]->getReplacementInfo()) != nullptr;
+    if (sectors_ > 1) {
+        blockTags_.resize(numBlocks, (Addr) -1);
+        for (unsigned int i = 0; i < numBlocks; i++)
+            blockInfo_.push_back(new CoherenceReplacementInfo(i, I, false, false));
+    }
+
     // Construct rInfo
     for (unsigned int i = 0; i < numSets_; i++) {
         std::vector<ReplacementInfo*> setInfo;
-        for (unsigned int j = 0; j < associativity; j++)
-            setInfo.push_back(lines_[i*associativity + j]->getReplacementInfo());
+        for (unsigned int j = 0; j < associativity; j++) {
+            if (sectors_ > 1)
+                setInfo.push_back(blockInfo_[i*associativity + j]);
+            else
+                setInfo.push_back(lines_[i*associativity + j]->getReplacementInfo());
+        }
         rInfo.insert(std::make_pair(i, setInfo));
     }
-    ReplacementInfo * info = rInfo.find(0)->second.front();
+    ReplacementInfo * info = lines_[0]->getReplacementInfo();
     if (!replacementMgr_->checkCompatibility(info))
         dbg_->fatal(CALL_INFO, -1, "CacheArray, Error: The replacement policy expects cache line state that is not provided by the cache line type of this cache. Check the type of the ReplacementInfo returned by the coherence protocol's line type and the ReplacementInfo type expected by the replacement policy.\n");
 
@@ -143,6 +223,8 @@ template <class T>
 CacheArray<T>::~CacheArray() {
     for (size_t i = 0; i < lines_.size(); i++)
         delete lines_[i];
+    for (size_t i = 0; i < blockInfo_.size(); i++)
+        delete blockInfo_[i];
     delete replacementMgr_;
     delete hash_;
     delete [] setStates;
@@ -159,6 +241,26 @@ Addr CacheArray<T>::toLineAddr(Addr addr) {
 template <class T>
 T* CacheArray<T>::lookup(const Addr addr, bool updateReplacement) {
     Addr laddr = toLineAddr(addr);
+
+    if (sectors_ > 1) {
+        Addr tag = laddr >> sectorOffset_;
+        int set = hash_->hash(0, tag) % numSets_;
+        int setBegin = set * associativity_;
+        int setEnd = setBegin + associativity_;
+
+        for (int i = setBegin; i < setEnd; i++) {
+            if (blockTags_[i] == tag) {
+                T* line = lines_[(i << sectorOffset_) + (laddr & (sectors_ - 1))];
+                if (line->getState() == I) // Sector not filled yet
+                    line->setAddr(addr);
+                if (updateReplacement)
+                    replacementMgr_->update(i, blockInfo_[i]);
+                return line;
+            }
+        }
+        return nullptr;
+    }
+
     int set = hash_->hash(0, laddr) % numSets_;
     int setBegin = set * associativity_;
     int setEnd = setBegin + associativity_;
@@ -176,6 +278,19 @@ T* CacheArray<T>::lookup(const Addr addr, bool updateReplacement) {
 template <class T>
 T * CacheArray<T>::findReplacementCandidate(Addr addr) {
     Addr laddr = toLineAddr(addr);
+
+    if (sectors_ > 1) {
+        int set = hash_->hash(0, laddr >> sectorOffset_) % numSets_;
+        for (unsigned int i = set * associativity_; i < (set + 1) * associativity_; i++)
+            updateBlockInfo(i);
+
+        unsigned int block = replacementMgr_->findBestCandidate(rInfo[set]);
+
+        // Hand back the sectors that need eviction first
+        T* line = findValidSector(lines_[block << sectorOffset_]);
+        return line ? line : lines_[block << sectorOffset_];
+    }
+
     int set = hash_->hash(0, laddr) % numSets_;
 
     unsigned int id = replacementMgr_->findBestCandidate(rInfo[set]);
@@ -185,6 +300,19 @@ T * CacheArray<T>::findReplacementCandidate(Addr addr) {
 
 template <class T>
 void CacheArray<T>::replace(Addr addr, T* candidate) {
+    if (sectors_ > 1) {
+        unsigned int block = candidate->getIndex() >> sectorOffset_;
+        replacementMgr_->replaced(block);
+        for (unsigned int i = 0; i < sectors_; i++)
+            lines_[(block << sectorOffset_) + i]->reset();
+
+        Addr laddr = toLineAddr(addr);
+        blockTags_[block] = laddr >> sectorOffset_;
+        lines_[(block << sectorOffset_) + (laddr & (sectors_ - 1))]->setAddr(addr);
+        replacementMgr_->update(block, blockInfo_[block]);
+        return;
+    }
+
     unsigned int index = candidate->getIndex();
     replacementMgr_->replaced(index);
     candidate->reset();
@@ -195,10 +323,147 @@ void CacheArray<T>::replace(Addr addr, T* candidate) {
 template <class T>
 void CacheArray<T>::deallocate(T* candidate) {
     unsigned int index = candidate->getIndex();
+    if (sectors_ > 1) {
+        candidate->reset();
+        if (!findValidSector(candidate))
+            replacementMgr_->replaced(index >> sectorOffset_);
+        return;
+    }
     replacementMgr_->replaced(index);
     candidate->reset();
 }
 
+template <class T>
+T * CacheArray<T>::findValidSector(T* line) {
+    if (sectors_ == 1)
+        return nullptr;
+
+    unsigned int first = line->getIndex() & ~(sectors_ - 1);
+    for (unsigned int i = first; i < first + sectors_; i++) {
+        if (lines_[i]->getState() != I)
+            return lines_[i];
+    }
+    return nullptr;
+}
+
+template <class T>
+void CacheArray<T>::setCompression(Compressor* compressor, unsigned int linesPerWay) {
+    if (sectors_ != 1)
+        dbg_->fatal(CALL_INFO, -1, "CacheArray, Error: compression is not supported with sectored arrays.\n");
+    if (linesPerWay == 0 || associativity_ % linesPerWay != 0)
+        dbg_->fatal(CALL_INFO, -1, "CacheArray, Error: associativity (%u) must be a multiple of compressed lines per way (%u).\n",
+                associativity_, linesPerWay);
+
+    compressor_ = compressor;
+    linesPerWay_ = linesPerWay;
+    setCapacity_ = (uint64_t)(associativity_ / linesPerWay_) * lineSize_;
+    for (unsigned int i = 0; i < numLines_; i++)
+        lines_[i]->setCompressor(compressor_);
+}
+
+/* A compressed set is full once the incoming line, which occupies a full line until its data arrives,
+ * no longer fits beside the others. The replacement policy picks among the set's valid lines. */
+template <class T>
+T * CacheArray<T>::findNextVictim(T* line) {
+    if (!compressor_)
+        return findValidSector(line);
+
+    unsigned int set = line->getIndex() / associativity_;
+    uint64_t used = 0;
+    std::vector<ReplacementInfo*> valid;
+    for (unsigned int i = set * associativity_; i < (set + 1) * associativity_; i++) {
+        if (lines_[i] == line || lines_[i]->getState() == I)
+            continue;
+        used += lines_[i]->getCompressedSize();
+        valid.push_back(rInfo[set][i - set * associativity_]);
+    }
+
+    if (used + lineSize_ <= setCapacity_) {
+        compressor_->recordEffectiveCapacity((uint64_t)(valid.size() + 1) * lineSize_ * numSets_);
+        return nullptr;
+    }
+    return lines_[replacementMgr_->findBestCandidate(valid)];
+}
+
+/* Summarize the sectors of a block for the replacement manager:
+ * invalid if all sectors are, M if any sector is dirty, otherwise the state of the first valid sector */
+template <class T>
+void CacheArray<T>::updateBlockInfo(unsigned int block) {
+    State state = I;
+    bool shared = false;
+    bool owned = false;
+
+    for (unsigned int i = block << sectorOffset_; i < (block + 1) << sectorOffset_; i++) {
+        ReplacementInfo* info = lines_[i]->getReplacementInfo();
+        if (info->getState() == I)
+            continue;
+        if (state == I || info->getState() == M)
+            state = info->getState();
+        if (coherenceInfo_) {
+            shared |= static_cast<CoherenceReplacementInfo*>(info)->getShared();
+            owned |= static_cast<CoherenceReplacementInfo*>(info)->getOwned();
+        }
+    }
+
+    blockInfo_[block]->setState(state);
+    blockInfo_[block]->setShared(shared);
+    blockInfo_[block]->setOwned(owned);
+}
+
+template <class T>
+void CacheArray<T>::snapshot(SnapshotWriter &out) {
+    out.put(numLines_);
+    out.put(associativity_);
+    out.put(lineSize_);
+    out.put(sectors_);
+    out.put(sliceSize_);
+    out.put(sliceStep_);
+    out.putString(compressor_ ? compressor_->getAlgorithm() : "none");
+    out.put(linesPerWay_);
+
+    for (unsigned int i = 0; i < numLines_; i++) {
+        State state = lines_[i]->getState();
+        if (state == I) {
+            out.put(0);
+            continue;
+        }
+        if (!isSnapshotState(state))
+            dbg_->fatal(CALL_INFO, -1, "CacheArray, Error: cannot snapshot line 0x%" PRIx64 " in transient state %s. Snapshots must be taken when the cache is idle. File: %s\n",
+                    lines_[i]->getAddr(), StateString[state], out.getFileName().c_str());
+        out.put(1);
+        lines_[i]->snapshot(out);
+    }
+
+    // Block tags, +1 so that unused blocks ((Addr)-1) encode in one byte
+    for (unsigned int i = 0; i < blockTags_.size(); i++)
+        out.put(blockTags_[i] + 1);
+
+    replacementMgr_->snapshot(out);
+}
+
+template <class T>
+void CacheArray<T>::restore(SnapshotReader &in) {
+    in.expect("lines", numLines_);
+    in.expect("associativity", associativity_);
+    in.expect("cache_line_size", lineSize_);
+    in.expect("sector_count", sectors_);
+    in.expect("slice size", sliceSize_);
+    in.expect("slice step", sliceStep_);
+    in.expect("compression", compressor_ ? compressor_->getAlgorithm() : "none");
+    in.expect("compressed_lines_per_way", linesPerWay_);
+
+    for (unsigned int i = 0; i < numLines_; i++) {
+        lines_[i]->reset();
+        if (in.get() != 0)
+            lines_[i]->restore(in);
+    }
+
+    for (unsigned int i = 0; i < blockTags_.size(); i++)
+        blockTags_[i] = in.get() - 1;
+
+    replacementMgr_->restore(in);
+}
+
 template <class T>
 void CacheArray<T>::setSliceAware(Addr size, Addr step) {
     sliceSize_ = size >> lineOffset_;
@@ -528,6 +528,13 @@ void Cache::setup() {
     // Enqueue the first wakeup event to check for deadlock
     if (timeout_ != 0)
         timeoutSelfLink_->send(1, nullptr);
+
+    // Restore a warm-start snapshot, init is done so slicing is configured
+    if (snapshotMode_ == SnapshotMode::LOAD) {
+        SnapshotReader in(out_, snapshotFile_, snapshotKind_);
+        coherenceMgr_->restore(in);
+        in.close();
+    }
 }
 
 
@@ -539,6 +546,12 @@ void Cache::finish() {
         listeners_[i]->printStats(*out_);
     linkDown_->finish();
     if (linkUp_ != linkDown_) linkUp_->finish();
+
+    if (snapshotMode_ == SnapshotMode::SAVE) {
+        SnapshotWriter out(out_, snapshotFile_, snapshotKind_);
+        coherenceMgr_->snapshot(out);
+        out.close();
+    }
 }
 
 
@@ -35,6 +35,7 @@
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/cacheListener.h"
 #include "sst/elements/memHierarchy/memLinkBase.h"
+#include "sst/elements/memHierarchy/snapshot.h"
 
 namespace SST { namespace MemHierarchy {
 
@@ -90,6 +91,11 @@ public:
             {"force_noncacheable_reqs", "(bool) Used for verification purposes. All requests are considered to be 'noncacheable'. Options: 0[off], 1[on]", "false"},
             {"min_packet_size",         "(string) Number of bytes in a request/response not including payload (e.g., addr + cmd). Specify in B.", "8B"},
             {"banks",                   "(uint) Number of cache banks: One access per bank per cycle. Use '0' to simulate no bank limits (only limits on bandwidth then are max_requests_per_cycle and *_link_width", "0"},
+            {"sector_count",            "(uint) Number of cache_line_size sectors that share one tag. Values above 1 make a sectored cache: misses fetch and evictions write back single sectors, blocks of sector_count lines are allocated and replaced together. Must be a power of 2. Only for MESI/MSI inclusive caches and L1s.", "1"},
+            {"compression",             "(string) Compress the data array with a built-in algorithm: 'none', 'bdi' (base-delta-immediate), 'fpc' (frequent pattern) or 'zero' (zero lines only). Alternatively, put a compressor in the 'compressor' slot. Compressed sizes depend on real data, so the memory needs a backing store. Only for MESI/MSI inclusive caches and L1s, not with sector_count.", "none"},
+            {"compressed_lines_per_way", "(uint) If compressed, tags per way of data: each set has associativity*compressed_lines_per_way tags and holds as many lines as fit in associativity*cache_line_size bytes.", "2"},
+            {"checkpoint",              "(string) Warm-start snapshot of the tag array, coherence state and replacement state. 'save' writes it at the end of simulation, 'load' restores it during setup. Use the same setting for every cache, directory and memory in the hierarchy.", ""},
+            {"checkpointDir",           "(string) Directory that holds snapshots, one file per component named after the component. Required if checkpoint is set.", ""},
             /* Old parameters - deprecated or moved */
             {"network_address",             "DEPRECATED - Now auto-detected by link control."}, // Remove 9.0
             {"network_bw",                  "MOVED - Now a member of the MemNIC subcomponent.", "80GiB/s"}, // Remove 9.0
@@ -166,7 +172,8 @@ public:
             {"prefetcher", "Prefetcher(s)", "SST::MemHierarchy::CacheListener"},
             {"listener", "Cache listener(s) for statistics, tracing, etc. In contrast to prefetcher, cannot send events to cache", "SST::MemHierarchy::CacheListener"},
             {"replacement", "Replacement policies, slot 0 is for cache, slot 1 is for directory (if it exists)", "SST::MemHierarchy::ReplacementPolicy"},
-            {"hash", "Hash function for mapping addresses to cache lines", "SST::MemHierarchy::HashFunction"} )
+            {"hash", "Hash function for mapping addresses to cache lines", "SST::MemHierarchy::HashFunction"},
+            {"compressor", "Compression algorithm for the data array, overrides the 'compression' parameter", "SST::MemHierarchy::Compressor"} )
 
 /* Class definition */
     friend class InstructionStream; // TODO what is this?
@@ -272,6 +279,9 @@ private:
     SimTime_t           timeout_;
     uint64_t            maxOutstandingPrefetch_;
     bool                banked_;
+    SnapshotMode        snapshotMode_;  // Save or restore a warm-start snapshot
+    std::string         snapshotFile_;
+    std::string         snapshotKind_;  // Protocol and cache type, checked on restore
 
     /** Clocks *****************************************************************/
     Clock::Handler<Cache>*  clockHandler_;
@@ -82,6 +82,9 @@ Cache::Cache(ComponentId_t id, Params &params) : Component(id) {
 
     createCoherenceManager(params);
 
+    /* Warm-start snapshots */
+    snapshotMode_ = getSnapshotMode(params, out_, getName(), snapshotFile_);
+
     /* Register statistics */
     registerStatistics();
 
@@ -125,6 +128,26 @@ void Cache::createCoherenceManager(Params &params) {
                 getName().c_str(), itype.c_str(), protStr.c_str());
     }
 
+    if (params.find<uint64_t>("sector_count", 1) > 1 && (protocol == CoherenceProtocol::NONE || itype != "inclusive")) {
+        out_->fatal(CALL_INFO, -1, "%s, Invalid param combo: sector_count - sectored caches must be inclusive and use the MESI or MSI protocol. You specified: cache_type = '%s', coherence_protocol = '%s'\n",
+                getName().c_str(), itype.c_str(), protStr.c_str());
+    }
+
+    std::string compression = params.find<std::string>("compression", "none");
+    to_lower(compression);
+    SubComponentSlotInfo* cslot = getSubComponentSlotInfo("compressor");
+    if (compression != "none" || (cslot && cslot->isPopulated(0))) {
+        if (protocol == CoherenceProtocol::NONE || itype != "inclusive")
+            out_->fatal(CALL_INFO, -1, "%s, Invalid param combo: compression - compressed caches must be inclusive and use the MESI or MSI protocol. You specified: cache_type = '%s', coherence_protocol = '%s'\n",
+                    getName().c_str(), itype.c_str(), protStr.c_str());
+        if (params.find<uint64_t>("sector_count", 1) > 1)
+            out_->fatal(CALL_INFO, -1, "%s, Invalid param combo: compression and sector_count - a cache cannot be both compressed and sectored.\n", getName().c_str());
+        if (params.find<uint64_t>("compressed_lines_per_way", 2) == 0)
+            out_->fatal(CALL_INFO, -1, "%s, Invalid param: compressed_lines_per_way - must be at least 1.\n", getName().c_str());
+    }
+
+    snapshotKind_ = "Cache/" + protStr + "/" + itype + (L1 ? "/L1" : "");
+
     /* Create MSHR */
     uint64_t mshrLatency = createMSHR(params, accessLatency, L1);
 
@@ -151,7 +174,10 @@ void Cache::createCoherenceManager(Params &params) {
     coherenceParams.insert("banks", params.find<std::string>("banks", "0"));
     coherenceParams.insert("associativity", params.find<std::string>("associativity", "-1"));
     coherenceParams.insert("lines", params.find<std::string>("lines", "0"));
+    coherenceParams.insert("sector_count", params.find<std::string>("sector_count", "1"));
     coherenceParams.insert("replacement_policy", params.find<std::string>("replacement_policy", "lru"));
+    coherenceParams.insert("compression", compression);
+    coherenceParams.insert("compressed_lines_per_way", params.find<std::string>("compressed_lines_per_way", "2"));
     coherenceParams.insert("dlines", params.find<std::string>("noninclusive_directory_entries", "0"));
     coherenceParams.insert("dassoc", params.find<std::string>("noninclusive_directory_associativity", "0"));
     coherenceParams.insert("drpolicy", params.find<std::string>("noninclusive_directory_repl", "lru"));
@@ -709,7 +735,14 @@ void Cache::createCacheArray(Params &params) {
                 getName().c_str(), sizeStr.c_str(), lineSize_);
     if (!isPowerOfTwo(lineSize_)) out_->fatal(CALL_INFO, -1, "%s, cache_line_size - must be a power of 2. You specified '%" PRIu64 "'.\n", getName().c_str(), lineSize_);
 
+    uint64_t sectors = params.find<uint64_t>("sector_count", 1);
+    if (sectors == 0 || !isPowerOfTwo(sectors))
+        out_->fatal(CALL_INFO, -1, "%s, Invalid param: sector_count - must be a power of 2. You specified '%" PRIu64 "'.\n", getName().c_str(), sectors);
+
     uint64_t lines = cacheSize / lineSize_;
+    if (lines % sectors != 0)
+        out_->fatal(CALL_INFO, -1, "%s, Invalid param combo: sector_count and cache_size - cache must hold a whole number of sectored blocks. You specified: cache_size = '%s', cache_line_size = '%" PRIu64 "', sector_count = '%" PRIu64 "'\n",
+                getName().c_str(), sizeStr.c_str(), lineSize_, sectors);
     params.insert("lines", std::to_string(lines));
     return;
 }
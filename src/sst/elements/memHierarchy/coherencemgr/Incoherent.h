@@ -266,6 +266,8 @@ public:
 
     Addr getBank(Addr addr) { return cacheArray_->getBank(addr); }
     void setSliceAware(uint64_t interleaveSize, uint64_t interleaveStep) { cacheArray_->setSliceAware(interleaveSize, interleaveStep); }
+    void snapshot(SnapshotWriter &out) { cacheArray_->snapshot(out); }
+    void restore(SnapshotReader &in) { cacheArray_->restore(in); }
 
     MemEventInitCoherence * getInitCoherenceEvent();
 
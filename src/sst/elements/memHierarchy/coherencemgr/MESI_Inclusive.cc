@@ -112,7 +112,7 @@ bool MESIInclusive::handleGetS(MemEvent * event, bool inMSHR) {
             recordPrefetchResult(line, statPrefetchHit);
             line->addSharer(event->getSrc());
 
-            sendTime = sendResponseUp(event, line->getData(), inMSHR, line->getTimestamp());
+            sendTime = sendResponseUp(event, line->getData(), inMSHR, std::max(line->getTimestamp(), timestamp_) + cacheArray_->getDecompressionLatency(line));
             line->setTimestamp(sendTime - 1);
             cleanUpAfterRequest(event, inMSHR);
 
@@ -179,7 +179,7 @@ bool MESIInclusive::handleGetS(MemEvent * event, bool inMSHR) {
                 }
             }
 
-            sendTime = sendResponseUp(event, line->getData(), inMSHR, line->getTimestamp(), respcmd);
+            sendTime = sendResponseUp(event, line->getData(), inMSHR, std::max(line->getTimestamp(), timestamp_) + cacheArray_->getDecompressionLatency(line), respcmd);
             line->setTimestamp(sendTime);
             cleanUpAfterRequest(event, inMSHR);
 
@@ -323,7 +323,7 @@ bool MESIInclusive::handleGetX(MemEvent * event, bool inMSHR) {
             line->setOwner(event->getSrc());
             if (line->isSharer(event->getSrc()))
                 line->removeSharer(event->getSrc());
-            sendTime = sendResponseUp(event, line->getData(), inMSHR, line->getTimestamp());
+            sendTime = sendResponseUp(event, line->getData(), inMSHR, std::max(line->getTimestamp(), timestamp_) + cacheArray_->getDecompressionLatency(line));
             line->setTimestamp(sendTime);
 
             if (is_debug_event(event))
@@ -1747,12 +1747,14 @@ bool MESIInclusive::handleNACK(MemEvent * event, bool inMSHR) {
 
 MemEventStatus MESIInclusive::processCacheMiss(MemEvent * event, SharedCacheLine * line, bool inMSHR) {
     MemEventStatus status = inMSHR ? MemEventStatus::OK : allocateMSHR(event, false); // Miss means we need an MSHR entry
+    if (!inMSHR && sectored_ && line && line->getState() == I)
+        stat_sectorMiss->addData(1);
     if (inMSHR && mshr_->getFrontEvent(event->getBaseAddr()) != event) { // Sometimes happens if eviction and event both retry
         if (is_debug_event(event))
             eventDI.action = "Stall";
         return MemEventStatus::Stall;
     }
-    if (status == MemEventStatus::OK && !line) { // Need a cache line too
+    if (status == MemEventStatus::OK && (!line || (line->getState() == I && cacheArray_->isCompressed()))) { // Need a cache line too, or room in a compressed set
         line = allocateLine(event, line);
         status = line ? MemEventStatus::OK : MemEventStatus::Stall;
     }
@@ -1762,12 +1764,23 @@ MemEventStatus MESIInclusive::processCacheMiss(MemEvent * event, SharedCacheLine
 
 SharedCacheLine * MESIInclusive::allocateLine(MemEvent * event, SharedCacheLine * line) {
     bool evicted = handleEviction(event->getBaseAddr(), line);
-    if (evicted) {
+    SharedCacheLine * target = line; // Gets the new tag; later victims only free up space
+
+    // A sectored block is replaced only once all of its sectors are evicted, a compressed set once the new line fits
+    while (evicted) {
         notifyListenerOfEvict(line->getAddr(), lineSize_, event->getInstructionPointer());
-        cacheArray_->replace(event->getBaseAddr(), line);
+        SharedCacheLine * sector = cacheArray_->findNextVictim(line);
+        if (!sector)
+            break;
+        line = sector;
+        evicted = handleEviction(event->getBaseAddr(), line);
+    }
+
+    if (evicted) {
+        cacheArray_->replace(event->getBaseAddr(), target);
         if (is_debug_event(event))
             printDebugAlloc(true, event->getBaseAddr(), "");
-        return line;
+        return target;
     } else {
         mshr_->insertEviction(line->getAddr(), event->getBaseAddr());
         if (is_debug_event(event)) {
@@ -1864,6 +1877,12 @@ bool MESIInclusive::handleEviction(Addr addr, SharedCacheLine *& line) {
         mshr_->insertWriteback(line->getAddr(), false);
     }
 
+    if (evict && sectored_) {
+        stat_sectorEvict->addData(1);
+        if (state == M)
+            stat_sectorWriteback->addData(1);
+    }
+
     recordPrefetchResult(line, statPrefetchEvict);
     return evict;
 }
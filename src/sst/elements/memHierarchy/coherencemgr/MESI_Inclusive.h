@@ -236,11 +236,16 @@ public:
         {"prefetch_inv",            "Prefetched block was invalidated before being accessed", "count", 2},
         {"prefetch_coherence_miss", "Prefetched block incurred a coherence miss (upgrade) on its first access", "count", 2},
         {"prefetch_redundant",      "Prefetch issued for a block that was already in cache", "count", 2},
+        /* Sectored caches (sector_count > 1) */
+        {"sector_miss",             "Miss to an invalid sector of a resident block, only the sector is fetched", "count", 2},
+        {"sector_evict",            "Valid sectors evicted to make room for a new block", "count", 2},
+        {"sector_writeback",        "Dirty sectors written back when their block was evicted", "count", 2},
         {"default_stat",            "Default statistic used for unexpected events/states/etc. Should be 0, if not, check for missing statistic registerations.", "none", 7})
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
             {"replacement", "Replacement policies, slot 0 is for cache, slot 1 is for directory (if it exists)", "SST::MemHierarchy::ReplacementPolicy"},
-            {"hash", "Hash function for mapping addresses to cache lines", "SST::MemHierarchy::HashFunction"} )
+            {"hash", "Hash function for mapping addresses to cache lines", "SST::MemHierarchy::HashFunction"},
+            {"compressor", "Compression algorithm for the cache's data array, if compressed", "SST::MemHierarchy::Compressor"} )
 
 /* Class definition */
     /** Constructor for MESIInclusive. Note that MESIInclusive handles both MESI & MSI protocols */
@@ -256,10 +261,17 @@ public:
         // Cache Array
         uint64_t lines = params.find<uint64_t>("lines");
         uint64_t assoc = params.find<uint64_t>("associativity");
+        uint64_t sectors = params.find<uint64_t>("sector_count", 1);
 
-        ReplacementPolicy * rmgr = createReplacementPolicy(lines, assoc, params, false);
+        // A compressed array has compressed_lines_per_way tags per way of data
+        Compressor * compressor = createCompressor(params);
+        uint64_t linesPerWay = compressor ? params.find<uint64_t>("compressed_lines_per_way", 2) : 1;
+
+        ReplacementPolicy * rmgr = createReplacementPolicy(lines * linesPerWay / sectors, assoc * linesPerWay, params, false);
         HashFunction * ht = createHashFunction(params);
-        cacheArray_ = new CacheArray<SharedCacheLine>(debug, lines, assoc, lineSize_, rmgr, ht);
+        cacheArray_ = new CacheArray<SharedCacheLine>(debug, lines * linesPerWay, assoc * linesPerWay, lineSize_, rmgr, ht, sectors);
+        if (compressor)
+            cacheArray_->setCompression(compressor, linesPerWay);
         cacheArray_->setBanked(params.find<uint64_t>("banks", 0));
 
         /* Statistics */
@@ -429,6 +441,14 @@ public:
             statPrefetchRedundant = registerStatistic<uint64_t>("prefetch_redundant");
         }
 
+        /* Sector statistics */
+        sectored_ = sectors > 1;
+        if (sectored_) {
+            stat_sectorMiss = registerStatistic<uint64_t>("sector_miss");
+            stat_sectorEvict = registerStatistic<uint64_t>("sector_evict");
+            stat_sectorWriteback = registerStatistic<uint64_t>("sector_writeback");
+        }
+
         /* Only for caches that expect writeback acks but we don't know yet so always enabled for now (can't register statistics later) */
         stat_eventState[(int)Command::AckPut][I] = registerStatistic<uint64_t>("stateEvent_AckPut_I");
 
@@ -503,6 +523,8 @@ public:
     /** Cache interface **/
     virtual Addr getBank(Addr addr) { return cacheArray_->getBank(addr); }
     virtual void setSliceAware(uint64_t size, uint64_t step) { cacheArray_->setSliceAware(size, step); }
+    virtual void snapshot(SnapshotWriter &out) { cacheArray_->snapshot(out); }
+    virtual void restore(SnapshotReader &in) { cacheArray_->restore(in); }
 
     /** Initialization **/
     MemEventInitCoherence * getInitCoherenceEvent();
@@ -590,6 +612,7 @@ private:
 
 /* Variables */
     CacheArray<SharedCacheLine> * cacheArray_;
+    bool sectored_;             // Cache array has more than one sector per tag
     State protocolState_;       // State to transition to on exclusive response to read/shared request
     bool protocol_;             // True for MESI, false for MSI
 
@@ -605,6 +628,9 @@ private:
     Statistic<uint64_t>* stat_miss[3][2];
     Statistic<uint64_t>* stat_hits;
     Statistic<uint64_t>* stat_misses;
+    Statistic<uint64_t>* stat_sectorMiss;
+    Statistic<uint64_t>* stat_sectorEvict;
+    Statistic<uint64_t>* stat_sectorWriteback;
 };
 
 
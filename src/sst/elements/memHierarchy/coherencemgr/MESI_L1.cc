@@ -107,7 +107,7 @@ bool MESIL1::handleGetS(MemEvent * event, bool inMSHR) {
                 line->atomicStart(timestamp_ + llscBlockCycles_, event->getThreadID());
             }
             data.assign(line->getData()->begin() + (event->getAddr() - event->getBaseAddr()), line->getData()->begin() + (event->getAddr() - event->getBaseAddr() + event->getSize()));
-            sendTime = sendResponseUp(event, &data, inMSHR, line->getTimestamp());
+            sendTime = sendResponseUp(event, &data, inMSHR, std::max(line->getTimestamp(), timestamp_) + cacheArray_->getDecompressionLatency(line));
             line->setTimestamp(sendTime - 1);
             cleanUpAfterRequest(event, inMSHR);
             break;
@@ -370,7 +370,7 @@ bool MESIL1::handleGetSX(MemEvent* event, bool inMSHR) {
             else
                 line->incLock();
             data.assign(line->getData()->begin() + (event->getAddr() - event->getBaseAddr()), line->getData()->begin() + (event->getAddr() - event->getBaseAddr() + event->getSize()));
-            sendTime = sendResponseUp(event, &data, inMSHR, line->getTimestamp());
+            sendTime = sendResponseUp(event, &data, inMSHR, std::max(line->getTimestamp(), timestamp_) + cacheArray_->getDecompressionLatency(line));
             line->setTimestamp(sendTime - 1);
             cleanUpAfterRequest(event, inMSHR);
             if (is_debug_addr(addr))
@@ -1124,10 +1124,12 @@ MemEventStatus MESIL1::processCacheMiss(MemEvent* event, L1CacheLine * line, boo
         }
     } else {
         status = allocateMSHR(event, false);
+        if (sectored_ && line && line->getState() == I)
+            stat_sectorMiss->addData(1);
     }
 
-    // Allocate a cache line
-    if (status == MemEventStatus::OK && !line) {
+    // Allocate a cache line. A compressed set must also make room for a line whose tag is still present
+    if (status == MemEventStatus::OK && (!line || (line->getState() == I && cacheArray_->isCompressed()))) {
         line = allocateLine(event, line);
         status = line ? MemEventStatus::OK : MemEventStatus::Stall;
     }
@@ -1162,13 +1164,23 @@ MemEventStatus MESIL1::checkMSHRCollision(MemEvent* event, bool inMSHR) {
  */
 L1CacheLine* MESIL1::allocateLine(MemEvent* event, L1CacheLine* line) {
     bool evicted = handleEviction(event->getBaseAddr(), line);
+    L1CacheLine* target = line; // Gets the new tag; later victims only free up space
 
-    if (evicted) {
+    // A sectored block is replaced only once all of its sectors are evicted, a compressed set once the new line fits
+    while (evicted) {
         notifyListenerOfEvict(line->getAddr(), lineSize_, event->getInstructionPointer());
-        cacheArray_->replace(event->getBaseAddr(), line);
+        L1CacheLine* sector = cacheArray_->findNextVictim(line);
+        if (!sector)
+            break;
+        line = sector;
+        evicted = handleEviction(event->getBaseAddr(), line);
+    }
+
+    if (evicted) {
+        cacheArray_->replace(event->getBaseAddr(), target);
         if (is_debug_addr(event->getBaseAddr()))
             printDebugAlloc(true, event->getBaseAddr(), "");
-        return line;
+        return target;
     } else {
         if (is_debug_event(event)) {
             eventDI.action = "Stall";
@@ -1260,6 +1272,12 @@ bool MESIL1::handleEviction(Addr addr, L1CacheLine*& line) {
             return false;
     }
 
+    if (sectored_) {
+        stat_sectorEvict->addData(1);
+        if (state == M)
+            stat_sectorWriteback->addData(1);
+    }
+
     line->atomicEnd();
     recordPrefetchResult(line, statPrefetchEvict);
     return true;
@@ -1604,6 +1622,14 @@ void MESIL1::setSliceAware(uint64_t interleaveSize, uint64_t interleaveStep) {
     cacheArray_->setSliceAware(interleaveSize, interleaveStep);
 }
 
+void MESIL1::snapshot(SnapshotWriter &out) {
+    cacheArray_->snapshot(out);
+}
+
+void MESIL1::restore(SnapshotReader &in) {
+    cacheArray_->restore(in);
+}
+
 Addr MESIL1::getBank(Addr addr) {
     return cacheArray_->getBank(addr);
 }
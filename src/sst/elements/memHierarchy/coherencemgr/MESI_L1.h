@@ -170,13 +170,18 @@ public:
         {"prefetch_inv",            "Prefetched block was invalidated before being accessed", "count", 2},
         {"prefetch_coherence_miss", "Prefetched block incurred a coherence miss (upgrade) on its first access", "count", 2},
         {"prefetch_redundant",      "Prefetch issued for a block that was already in cache", "count", 2},
+        /* Sectored caches (sector_count > 1) */
+        {"sector_miss",             "Miss to an invalid sector of a resident block, only the sector is fetched", "count", 2},
+        {"sector_evict",            "Valid sectors evicted to make room for a new block", "count", 2},
+        {"sector_writeback",        "Dirty sectors written back when their block was evicted", "count", 2},
         /* Miscellaneous */
         {"EventStalledForLockedCacheline",  "Number of times an event (FetchInv, FetchInvX, eviction, Fetch, etc.) was stalled because a cache line was locked", "instances", 1},
         {"default_stat",            "Default statistic used for unexpected events/states/etc. Should be 0, if not, check for missing statistic registrations.", "none", 7})
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
             {"replacement", "Replacement policies, slot 0 is for cache, slot 1 is for directory (if it exists)", "SST::MemHierarchy::ReplacementPolicy"},
-            {"hash", "Hash function for mapping addresses to cache lines", "SST::MemHierarchy::HashFunction"} )
+            {"hash", "Hash function for mapping addresses to cache lines", "SST::MemHierarchy::HashFunction"},
+            {"compressor", "Compression algorithm for the cache's data array, if compressed", "SST::MemHierarchy::Compressor"} )
 
 /* Class definition */
     /** Constructor for MESIL1 */
@@ -203,10 +208,16 @@ public:
         // Cache Array
         uint64_t lines = params.find<uint64_t>("lines", 0);
         uint64_t assoc = params.find<uint64_t>("associativity", 0);
-        ReplacementPolicy * rmgr = createReplacementPolicy(lines, assoc, params, true);
-        HashFunction * ht = createHashFunction(params);
+        uint64_t sectors = params.find<uint64_t>("sector_count", 1);
+        // A compressed array has compressed_lines_per_way tags per way of data
+        Compressor * compressor = createCompressor(params);
+        uint64_t linesPerWay = compressor ? params.find<uint64_t>("compressed_lines_per_way", 2) : 1;
 
-        cacheArray_ = new CacheArray<L1CacheLine>(debug, lines, assoc, lineSize_, rmgr, ht);
+        ReplacementPolicy * rmgr = createReplacementPolicy(lines * linesPerWay / sectors, assoc * linesPerWay, params, true);
+        HashFunction * ht = createHashFunction(params);
+        cacheArray_ = new CacheArray<L1CacheLine>(debug, lines * linesPerWay, assoc * linesPerWay, lineSize_, rmgr, ht, sectors);
+        if (compressor)
+            cacheArray_->setCompression(compressor, linesPerWay);
         cacheArray_->setBanked(params.find<uint64_t>("banks", 0));
 
         // Register statistics
@@ -346,6 +357,14 @@ public:
             statPrefetchRedundant = registerStatistic<uint64_t>("prefetch_redundant");
         }
 
+        /* Sector statistics */
+        sectored_ = sectors > 1;
+        if (sectored_) {
+            stat_sectorMiss = registerStatistic<uint64_t>("sector_miss");
+            stat_sectorEvict = registerStatistic<uint64_t>("sector_evict");
+            stat_sectorWriteback = registerStatistic<uint64_t>("sector_writeback");
+        }
+
         /* MESI-specific statistics (as opposed to MSI) */
         if (MESI) {
             stat_eventState[(int)Command::GetS][E]          = registerStatistic<uint64_t>("stateEvent_GetS_E");
@@ -387,6 +406,8 @@ public:
     MemEventInitCoherence* getInitCoherenceEvent();
     virtual std::set<Command> getValidReceiveEvents();
     void setSliceAware(uint64_t interleaveSize, uint64_t interleaveStep);
+    void snapshot(SnapshotWriter &out);
+    void restore(SnapshotReader &in);
 
     void printStatus(Output& out);
 
@@ -440,6 +461,7 @@ private:
     Link* llscTimeoutSelfLink_; // A self-link to trigger waiting requests when a LoadLink times out 
 
     CacheArray<L1CacheLine>* cacheArray_;
+    bool sectored_;             // Cache array has more than one sector per tag
 
     /** Statistics */
     Statistic<uint64_t>* stat_eventStalledForLock;
@@ -452,6 +474,9 @@ private:
     Statistic<uint64_t>* stat_miss[3][2];
     Statistic<uint64_t>* stat_hits;
     Statistic<uint64_t>* stat_misses;
+    Statistic<uint64_t>* stat_sectorMiss;
+    Statistic<uint64_t>* stat_sectorEvict;
+    Statistic<uint64_t>* stat_sectorWriteback;
 };
 
 
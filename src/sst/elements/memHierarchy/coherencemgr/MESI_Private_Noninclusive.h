@@ -444,6 +444,8 @@ public:
 
     virtual Addr getBank(Addr addr) { return cacheArray_->getBank(addr); }
     virtual void setSliceAware(uint64_t size, uint64_t step) { cacheArray_->setSliceAware(size, step); }
+    virtual void snapshot(SnapshotWriter &out) { cacheArray_->snapshot(out); }
+    virtual void restore(SnapshotReader &in) { cacheArray_->restore(in); }
 
     /* Initialization */
     virtual void hasUpperLevelCacheName(std::string cachename);
@@ -3208,6 +3208,30 @@ void MESISharNoninclusive::printLine(Addr addr) {
     }
 }
 
+/* Data lines point at their directory lines, save those links after the arrays */
+void MESISharNoninclusive::snapshot(SnapshotWriter &out) {
+    dirArray_->snapshot(out);
+    dataArray_->snapshot(out);
+
+    for (unsigned int i = 0; i < dataArray_->getNumLines(); i++) {
+        DirectoryLine * tag = dataArray_->getLine(i)->getTag();
+        out.put(tag ? tag->getIndex() + 1 : 0);
+    }
+}
+
+void MESISharNoninclusive::restore(SnapshotReader &in) {
+    dirArray_->restore(in);
+    dataArray_->restore(in);
+
+    for (unsigned int i = 0; i < dataArray_->getNumLines(); i++) {
+        uint64_t tag = in.get();
+        if (tag > dirArray_->getNumLines())
+            output->fatal(CALL_INFO, -1, "%s, Error: snapshot '%s' links a data line to directory line %" PRIu64 " which does not exist\n",
+                    cachename_.c_str(), in.getFileName().c_str(), tag - 1);
+        dataArray_->getLine(i)->setTag(tag ? dirArray_->getLine(tag - 1) : nullptr);
+    }
+}
+
 void MESISharNoninclusive::printStatus(Output &out) {
     out.output("    Directory Array\n");
     dirArray_->printCacheArray(out);
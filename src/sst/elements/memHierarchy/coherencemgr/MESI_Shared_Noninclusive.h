@@ -546,6 +546,8 @@ public:
         dirArray_->setSliceAware(size, step);
         dataArray_->setSliceAware(size, step);
     }
+    virtual void snapshot(SnapshotWriter &out);
+    virtual void restore(SnapshotReader &in);
 
     std::set<Command> getValidReceiveEvents() {
         std::set<Command> cmds = { Command::GetS,
@@ -168,6 +168,22 @@ HashFunction* CoherenceController::createHashFunction(Params& params) {
     return ht;
 }
 
+Compressor* CoherenceController::createCompressor(Params& params) {
+    Compressor * compressor = loadUserSubComponent<Compressor>("compressor");
+    if (compressor) return compressor;
+
+    Params cparams;
+    std::string algorithm = params.find<std::string>("compression", "none");
+    to_lower(algorithm);
+
+    if (algorithm == "none") return nullptr;
+    if (algorithm == "bdi" || algorithm == "fpc" || algorithm == "zero")
+        return loadAnonymousSubComponent<Compressor>("memHierarchy.compression." + algorithm, "compressor", 0, ComponentInfo::INSERT_STATS, cparams);
+
+    debug->fatal(CALL_INFO, -1, "%s, Invalid param: compression - supported algorithms are 'none', 'bdi', 'fpc', and 'zero'. You specified '%s'.\n", getName().c_str(), algorithm.c_str());
+    return nullptr;
+}
+
 /*******************************************************************************
  * Event handlers - one per event type
  * Handlers return whether event was accepted (true) or rejected (false)
@@ -32,6 +32,8 @@
 #include "sst/elements/memHierarchy/memLinkBase.h"
 #include "sst/elements/memHierarchy/replacementManager.h"
 #include "sst/elements/memHierarchy/hash.h"
+#include "sst/elements/memHierarchy/compression.h"
+#include "sst/elements/memHierarchy/snapshot.h"
 
 namespace SST { namespace MemHierarchy {
 using namespace std;
@@ -155,6 +157,14 @@ public:
     /* Call through to cache array to configure banking/slicing */
     virtual void setSliceAware(uint64_t interleaveSize, uint64_t interleaveStep) = 0;
 
+    /* Warm-start snapshots: save/restore the tag, coherence and replacement state of the cache arrays */
+    virtual void snapshot(SnapshotWriter &out) {
+        output->fatal(CALL_INFO, -1, "%s, Error: this coherence manager does not support snapshots\n", cachename_.c_str());
+    }
+    virtual void restore(SnapshotReader &in) {
+        output->fatal(CALL_INFO, -1, "%s, Error: this coherence manager does not support snapshots\n", cachename_.c_str());
+    }
+
     /* Register callback to enable the cache's clock if needed */
     void registerClockEnableFunction(std::function<void()> fcn) { reenableClock_ = fcn; }
     
@@ -252,6 +262,7 @@ protected:
     /* Initialization */
     ReplacementPolicy * createReplacementPolicy(uint64_t lines, uint64_t assoc, Params& params, bool L1, int slotnum = 0);
     HashFunction * createHashFunction(Params& params);
+    Compressor * createCompressor(Params& params); // nullptr if the cache is not compressed
 
     /*********************************************************************************
      * Data members
@@ -0,0 +1,236 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+
+#include <string.h>
+
+#include "compression.h"
+
+using namespace SST::MemHierarchy;
+
+/*
+ * Size kernels
+ * Each kernel is a handful of passes over the line's words, written without early exits so that the
+ * compiler vectorizes them. They are compiled and dispatched per ISA the same way as the reduction
+ * kernels in iris/sumi/comm_functions.h, see there.
+ */
+namespace {
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define MEMH_COMPRESSION_MULTI_ISA 1
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__)
+#define MEMH_COMPRESSION_VECTORIZE __attribute__((optimize("tree-vectorize","vect-cost-model=dynamic")))
+#else
+#define MEMH_COMPRESSION_VECTORIZE
+#endif
+
+#define MEMH_COMPRESSION_INLINE inline __attribute__((always_inline))
+
+template <typename W>
+MEMH_COMPRESSION_INLINE W loadWord(const uint8_t* data, uint32_t i) {
+    W w;
+    memcpy(&w, data + i * sizeof(W), sizeof(W));
+    return w;
+}
+
+MEMH_COMPRESSION_INLINE bool isZero(const uint8_t* data, uint32_t size) {
+    uint64_t bits = 0;
+    for (uint32_t i = 0; i < size / 8; i++)
+        bits |= loadWord<uint64_t>(data, i);
+    for (uint32_t i = size & ~7u; i < size; i++)
+        bits |= data[i];
+    return bits == 0;
+}
+
+struct ZeroKernel {
+    static MEMH_COMPRESSION_INLINE uint32_t size(const uint8_t* data, uint32_t size) {
+        return (size > 1 && isZero(data, size)) ? 1 : size;
+    }
+};
+
+/* Whether 'value' is within a signed 'deltaBytes'-byte delta of 'base' */
+template <typename W>
+MEMH_COMPRESSION_INLINE W fitsDelta(W value, W base, unsigned deltaBytes) {
+    W bias = (W)1 << (8 * deltaBytes - 1);
+    return (W)(value - base + bias) < (W)(bias << 1);
+}
+
+/* BDI with W-sized words and deltaBytes-sized deltas. Each word is a delta from zero or from the base,
+ * which is the first word that is not a delta from zero */
+template <typename W>
+MEMH_COMPRESSION_INLINE bool fitsBDI(const uint8_t* data, uint32_t words, unsigned deltaBytes) {
+    W base = 0;
+    for (uint32_t i = 0; i < words; i++) {
+        W w = loadWord<W>(data, i);
+        if (!fitsDelta<W>(w, 0, deltaBytes)) {
+            base = w;
+            break;
+        }
+    }
+
+    W fits = 1;
+    for (uint32_t i = 0; i < words; i++) {
+        W w = loadWord<W>(data, i);
+        fits &= fitsDelta<W>(w, 0, deltaBytes) | fitsDelta<W>(w, base, deltaBytes);
+    }
+    return fits;
+}
+
+struct BDIKernel {
+    static MEMH_COMPRESSION_INLINE uint32_t size(const uint8_t* data, uint32_t size) {
+        if (size < 16 || (size % 8) != 0)
+            return size;
+        if (isZero(data, size))
+            return 1;
+
+        uint32_t n8 = size / 8;
+        uint64_t first = loadWord<uint64_t>(data, 0);
+        uint64_t same = 1;
+        for (uint32_t i = 1; i < n8; i++)
+            same &= (loadWord<uint64_t>(data, i) == first);
+        if (same)
+            return 8;
+
+        // Base + words * delta for each (base, delta) encoding
+        uint32_t best = size;
+        if (8 + n8 < best && fitsBDI<uint64_t>(data, n8, 1))         best = 8 + n8;
+        if (4 + 2 * n8 < best && fitsBDI<uint32_t>(data, 2 * n8, 1)) best = 4 + 2 * n8;
+        if (8 + 2 * n8 < best && fitsBDI<uint64_t>(data, n8, 2))     best = 8 + 2 * n8;
+        if (2 + 4 * n8 < best && fitsBDI<uint16_t>(data, 4 * n8, 1)) best = 2 + 4 * n8;
+        if (4 + 4 * n8 < best && fitsBDI<uint32_t>(data, 2 * n8, 2)) best = 4 + 4 * n8;
+        if (8 + 4 * n8 < best && fitsBDI<uint64_t>(data, n8, 4))     best = 8 + 4 * n8;
+        return best;
+    }
+};
+
+struct FPCKernel {
+    static MEMH_COMPRESSION_INLINE uint32_t size(const uint8_t* data, uint32_t size) {
+        if (size < 8 || (size % 4) != 0)
+            return size;
+
+        uint32_t words = size / 4;
+
+        // Bits for the non-zero words: a 3-bit prefix plus the smallest pattern that holds the word
+        uint32_t bits = 0;
+        for (uint32_t i = 0; i < words; i++) {
+            uint32_t w = loadWord<uint32_t>(data, i);
+            uint32_t lo = w & 0xFFFF;
+            uint32_t hi = w >> 16;
+            uint32_t se4 = (uint32_t)(w + 8) < 16;
+            uint32_t se8 = (uint32_t)(w + 128) < 256;
+            uint32_t se16 = (uint32_t)(w + 32768) < 65536;
+            uint32_t padded = lo == 0;
+            uint32_t halves = (((lo + 128) & 0xFFFF) < 256) & (((hi + 128) & 0xFFFF) < 256);
+            uint32_t repeated = w == (w & 0xFF) * 0x01010101u;
+
+            uint32_t cost = repeated ? 8 : 32;
+            cost = (se16 | padded | halves) ? (cost < 16 ? cost : 16) : cost;
+            cost = se8 ? 8 : cost;
+            cost = se4 ? 4 : cost;
+            bits += (w != 0) ? 3 + cost : 0;
+        }
+
+        // Runs of up to 8 zero words share one 3-bit prefix and a 3-bit run length
+        uint32_t run = 0;
+        for (uint32_t i = 0; i < words; i++) {
+            if (loadWord<uint32_t>(data, i) != 0) {
+                run = 0;
+            } else {
+                if (run == 0)
+                    bits += 6;
+                run = (run + 1) & 7;
+            }
+        }
+
+        uint32_t bytes = (bits + 7) / 8;
+        return bytes < size ? bytes : size;
+    }
+};
+
+template <typename Kernel>
+MEMH_COMPRESSION_VECTORIZE uint32_t runScalar(const uint8_t* data, uint32_t size) {
+    return Kernel::size(data, size);
+}
+
+#ifdef MEMH_COMPRESSION_MULTI_ISA
+template <typename Kernel>
+MEMH_COMPRESSION_VECTORIZE __attribute__((target("avx2"))) uint32_t runAVX2(const uint8_t* data, uint32_t size) {
+    return Kernel::size(data, size);
+}
+
+template <typename Kernel>
+MEMH_COMPRESSION_VECTORIZE __attribute__((target("avx512f,avx512bw"))) uint32_t runAVX512(const uint8_t* data, uint32_t size) {
+    return Kernel::size(data, size);
+}
+#endif
+
+template <typename Kernel>
+CompressionKernel selectKernel() {
+#ifdef MEMH_COMPRESSION_MULTI_ISA
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) return &runAVX512<Kernel>;
+    if (__builtin_cpu_supports("avx2")) return &runAVX2<Kernel>;
+#endif
+    return &runScalar<Kernel>;
+}
+
+}
+
+/* Compressor */
+
+Compressor::Compressor(ComponentId_t id, Params& params, uint64_t defaultLatency) : SubComponent(id) {
+    decompressionLatency_ = params.find<uint64_t>("decompression_latency", defaultLatency);
+
+    stat_compressionRatio = registerStatistic<double>("compression_ratio");
+    stat_compressedSize = registerStatistic<uint64_t>("compressed_size");
+    stat_decompressionLatency = registerStatistic<uint64_t>("decompression_latency");
+    stat_effectiveCapacity = registerStatistic<uint64_t>("effective_capacity");
+}
+
+uint32_t Compressor::compress(const std::vector<uint8_t>& data) {
+    if (data.empty())
+        return 0;
+
+    uint32_t size = compressedSize(data.data(), data.size());
+    if (size == 0 || size > data.size())
+        size = data.size();
+
+    stat_compressionRatio->addData((double) data.size() / size);
+    stat_compressedSize->addData(size);
+    return size;
+}
+
+uint64_t Compressor::decompress(uint32_t size, uint32_t original) {
+    uint64_t latency = size < original ? decompressionLatency_ : 0;
+    stat_decompressionLatency->addData(latency);
+    return latency;
+}
+
+/* Built-in algorithms */
+
+ZeroLineCompressor::ZeroLineCompressor(ComponentId_t id, Params& params) : Compressor(id, params, 0) {
+    kernel_ = selectKernel<ZeroKernel>();
+}
+
+BDICompressor::BDICompressor(ComponentId_t id, Params& params) : Compressor(id, params, 1) {
+    kernel_ = selectKernel<BDIKernel>();
+}
+
+FPCCompressor::FPCCompressor(ComponentId_t id, Params& params) : Compressor(id, params, 5) {
+    kernel_ = selectKernel<FPCKernel>();
+}
@@ -0,0 +1,158 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_COMPRESSION_H
+#define MEMHIERARCHY_COMPRESSION_H
+
+#include <string>
+#include <vector>
+
+#include <sst/core/subcomponent.h>
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Compression algorithms
+ *
+ * A compressor computes the size that a block of data would occupy once compressed. It does not
+ * transform the data: caches and memories keep the uncompressed bytes and use the size to decide how
+ * many lines fit in the data array and whether a read pays the decompression latency.
+ * Sizes are only meaningful if real data flows with events, i.e., the memory has a backing store.
+ * Without one, all lines read from memory are zero.
+ *
+ * To add an algorithm, inherit from Compressor and implement compressedSize().
+ */
+
+#define COMPRESSOR_ELI_STATS \
+    {"compression_ratio",       "Uncompressed size over compressed size, for each line that is compressed", "ratio", 1},\
+    {"compressed_size",         "Compressed size of each line that is compressed", "bytes", 2},\
+    {"decompression_latency",   "Decompression latency of each read, 0 for reads of lines stored uncompressed", "cycles", 1},\
+    {"effective_capacity",      "Amount of uncompressed data the owner holds, sampled when lines are allocated (caches) or written (memories)", "bytes", 1}
+
+class Compressor : public SubComponent {
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT_API(SST::MemHierarchy::Compressor)
+
+    Compressor(ComponentId_t id, Params& params, uint64_t defaultLatency);
+    virtual ~Compressor() {}
+
+    /* Compressed size of 'data' in bytes, at most data.size(). Records the compression statistics */
+    uint32_t compress(const std::vector<uint8_t>& data);
+
+    /* Latency in cycles to read a line stored in 'size' bytes that is 'original' bytes uncompressed.
+     * Lines that did not compress are stored as-is and cost nothing extra. Records the latency statistic */
+    uint64_t decompress(uint32_t size, uint32_t original);
+
+    /* Sample the amount of uncompressed data the owner holds */
+    void recordEffectiveCapacity(uint64_t bytes) { stat_effectiveCapacity->addData(bytes); }
+
+    /* Name of the algorithm, saved in snapshots since compressed sizes are only valid for the algorithm that computed them */
+    virtual std::string getAlgorithm() = 0;
+
+protected:
+    /* The algorithm: compressed size of 'size' bytes starting at 'data' */
+    virtual uint32_t compressedSize(const uint8_t* data, uint32_t size) = 0;
+
+    uint64_t decompressionLatency_;
+
+private:
+    Statistic<double>* stat_compressionRatio;
+    Statistic<uint64_t>* stat_compressedSize;
+    Statistic<uint64_t>* stat_decompressionLatency;
+    Statistic<uint64_t>* stat_effectiveCapacity;
+};
+
+/* Size kernels of the built-in algorithms, vectorized for the host CPU */
+typedef uint32_t (*CompressionKernel)(const uint8_t* data, uint32_t size);
+
+/* ------------------------------------------------------------------------------------------
+ *  Zero-line detection: lines of all zeros take one byte, everything else is uncompressed
+ * ------------------------------------------------------------------------------------------*/
+class ZeroLineCompressor : public Compressor {
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(ZeroLineCompressor, "memHierarchy", "compression.zero", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "Zero-line detection, all-zero lines are stored in one byte", SST::MemHierarchy::Compressor)
+
+    SST_ELI_DOCUMENT_PARAMS(
+            {"decompression_latency", "(uint) Cycles to decompress a line", "0"} )
+
+    SST_ELI_DOCUMENT_STATISTICS( COMPRESSOR_ELI_STATS )
+
+    ZeroLineCompressor(ComponentId_t id, Params& params);
+
+    std::string getAlgorithm() override { return "zero"; }
+
+protected:
+    uint32_t compressedSize(const uint8_t* data, uint32_t size) override { return kernel_(data, size); }
+
+private:
+    CompressionKernel kernel_;
+};
+
+/* ------------------------------------------------------------------------------------------
+ *  Base-Delta-Immediate (Pekhimenko et al., PACT 2012)
+ *  A line is one base plus small deltas, each delta relative to either the base or zero.
+ *  Tries 8/4/2-byte bases with 1/2/4-byte deltas, plus all-zero and repeated 8-byte value lines.
+ * ------------------------------------------------------------------------------------------*/
+class BDICompressor : public Compressor {
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(BDICompressor, "memHierarchy", "compression.bdi", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "Base-Delta-Immediate compression", SST::MemHierarchy::Compressor)
+
+    SST_ELI_DOCUMENT_PARAMS(
+            {"decompression_latency", "(uint) Cycles to decompress a line", "1"} )
+
+    SST_ELI_DOCUMENT_STATISTICS( COMPRESSOR_ELI_STATS )
+
+    BDICompressor(ComponentId_t id, Params& params);
+
+    std::string getAlgorithm() override { return "bdi"; }
+
+protected:
+    uint32_t compressedSize(const uint8_t* data, uint32_t size) override { return kernel_(data, size); }
+
+private:
+    CompressionKernel kernel_;
+};
+
+/* ------------------------------------------------------------------------------------------
+ *  Frequent Pattern Compression (Alameldeen & Wood, 2004)
+ *  Each 32-bit word gets a 3-bit prefix and is stored as a zero run, a sign-extended 4/8/16-bit
+ *  value, a halfword padded with zeros, two sign-extended bytes, a repeated byte, or uncompressed.
+ * ------------------------------------------------------------------------------------------*/
+class FPCCompressor : public Compressor {
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(FPCCompressor, "memHierarchy", "compression.fpc", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "Frequent Pattern Compression", SST::MemHierarchy::Compressor)
+
+    SST_ELI_DOCUMENT_PARAMS(
+            {"decompression_latency", "(uint) Cycles to decompress a line", "5"} )
+
+    SST_ELI_DOCUMENT_STATISTICS( COMPRESSOR_ELI_STATS )
+
+    FPCCompressor(ComponentId_t id, Params& params);
+
+    std::string getAlgorithm() override { return "fpc"; }
+
+protected:
+    uint32_t compressedSize(const uint8_t* data, uint32_t size) override { return kernel_(data, size); }
+
+private:
+    CompressionKernel kernel_;
+};
+
+}}
+
+#endif // MEMHIERARCHY_COMPRESSION_H
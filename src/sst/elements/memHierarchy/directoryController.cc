@@ -316,6 +316,8 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
     /* Get latencies */
     accessLatency   = params.find<uint64_t>("access_latency_cycles", 0);
     mshrLatency     = params.find<uint64_t>("mshr_latency_cycles", 0);
+
+    snapshotMode = getSnapshotMode(params, &out, getName(), snapshotFile);
 }
 
 
@@ -705,6 +707,9 @@ void DirectoryController::init(unsigned int phase) {
 
 void DirectoryController::finish(void){
     cpuLink->finish();
+
+    if (snapshotMode == SnapshotMode::SAVE)
+        snapshot();
 }
 
 
@@ -714,6 +719,9 @@ void DirectoryController::setup(void){
     if (cpuLink != memLink)
         memLink->setup();
     //MemLinkBase * mem = memLink ? memLink : network;
+
+    if (snapshotMode == SnapshotMode::LOAD)
+        restore();
 }
 
 
@@ -2308,6 +2316,74 @@ void DirectoryController::updateCache(DirEntry * entry) { // TODO replace with a
     }
 }
 
+/* Snapshot layout: geometry, then the entry cache from most to least recently used, then the uncached entries */
+std::string DirectoryController::snapshotKind() {
+    return protocol == CoherenceProtocol::MESI ? "DirectoryController/mesi" : "DirectoryController/msi";
+}
+
+void DirectoryController::snapshot() {
+    SnapshotWriter snap(&out, snapshotFile, snapshotKind());
+    snap.put(lineSize);
+    snap.put(entryCacheMaxSize);
+    snap.put(region.start);
+    snap.put(region.end);
+    snap.put(region.interleaveSize);
+    snap.put(region.interleaveStep);
+
+    std::vector<DirEntry*> entries(entryCache.begin(), entryCache.end());
+    for (std::unordered_map<Addr, DirEntry*>::iterator it = directory.begin(); it != directory.end(); it++) {
+        if (it->second->cacheIter == entryCache.end())
+            entries.push_back(it->second);
+    }
+
+    snap.put(entryCacheSize);
+    snap.put(entries.size());
+    for (std::vector<DirEntry*>::iterator it = entries.begin(); it != entries.end(); it++) {
+        DirEntry* entry = *it;
+        if (!isSnapshotState(entry->getState()))
+            out.fatal(CALL_INFO, -1, "%s, Error: cannot snapshot directory entry 0x%" PRIx64 " in transient state %s. Snapshots must be taken when the directory is idle.\n",
+                    getName().c_str(), entry->getBaseAddr(), StateString[entry->getState()]);
+        snap.put(entry->getBaseAddr());
+        snap.put(entry->getState());
+        snap.put(entry->isCached());
+        snap.putString(entry->getOwner());
+        snap.put(entry->getSharerCount());
+        for (std::set<std::string>::iterator sh = entry->getSharers()->begin(); sh != entry->getSharers()->end(); sh++)
+            snap.putString(*sh);
+    }
+    snap.close();
+}
+
+void DirectoryController::restore() {
+    SnapshotReader snap(&out, snapshotFile, snapshotKind());
+    snap.expect("cache_line_size", lineSize);
+    snap.expect("entry_cache_size", entryCacheMaxSize);
+    snap.expect("addr_range_start", region.start);
+    snap.expect("addr_range_end", region.end);
+    snap.expect("interleave_size", region.interleaveSize);
+    snap.expect("interleave_step", region.interleaveStep);
+
+    uint64_t cached = snap.get();
+    uint64_t count = snap.get();
+    for (uint64_t i = 0; i < count; i++) {
+        DirEntry* entry = getDirEntry(snap.get());
+        entry->setState((State) snap.get());
+        entry->setCached(snap.get());
+        std::string owner = snap.getString();
+        if (!owner.empty())
+            entry->setOwner(owner);
+        for (uint64_t sharers = snap.get(); sharers > 0; sharers--)
+            entry->addSharer(snap.getString());
+
+        if (i < cached) {
+            entryCache.push_back(entry);
+            entry->cacheIter = std::prev(entryCache.end());
+            ++entryCacheSize;
+        }
+    }
+    snap.close();
+}
+
 void DirectoryController::sendEntryToMemory(DirEntry *entry) {
     Addr entryAddr = 0;
     MemEvent * me = new MemEvent(getName(), entryAddr, entryAddr, Command::PutE, lineSize);
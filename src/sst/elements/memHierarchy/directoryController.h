@@ -37,6 +37,7 @@
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/mshr.h"
+#include "sst/elements/memHierarchy/snapshot.h"
 
 using namespace std;
 
@@ -68,6 +69,8 @@ public:
             {"interleave_size",         "Size of interleaved chunks. E.g., to interleave 8B chunks among 3 directories, set size=8B, step=24B", "0B"},
             {"interleave_step",         "Distance between interleaved chunks. E.g., to interleave 8B chunks among 3 directories, set size=8B, step=24B", "0B"},
             {"node",					"Node number in multinode environment"},
+            {"checkpoint",              "(string) Warm-start snapshot of the directory entries and entry cache order. 'save' writes it at the end of simulation, 'load' restores it during setup. Use the same setting for every cache, directory and memory in the hierarchy.", ""},
+            {"checkpointDir",           "(string) Directory that holds snapshots, one file per component named after the component. Required if checkpoint is set.", ""},
             /* Old parameters - deprecated or moved */
             {"network_num_vc",          "DEPRECATED. Number of virtual channels (VCs) on the on-chip network. memHierarchy only uses one VC.", "1"}, // Remove SST 9.0
             {"network_address",         "DEPRECATD - Now auto-detected by link control", ""},   // Remove SST 9.0
@@ -376,6 +379,11 @@ private:
     void updateCache(DirEntry * entry);
     void sendEntryToMemory(DirEntry* entry);
 
+    /* Warm-start snapshots */
+    void snapshot();
+    void restore();
+    std::string snapshotKind();
+
     void issueMemoryRequest(MemEvent* event, DirEntry* entry, bool lineGranularity);
     void issueFlush(MemEvent* event);
     void issueFetch(MemEvent* event, DirEntry* entry, Command cmd);
@@ -430,6 +438,9 @@ private:
 
     std::set<std::string> incoherentSrc;
 
+    SnapshotMode snapshotMode;
+    std::string snapshotFile;
+
 };
 
 }
@@ -0,0 +1,140 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_IDTABLE_H
+#define MEMHIERARCHY_IDTABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Open-addressed table keyed by event/request ID
+ *
+ * Entries are stored inline in a power-of-two slot array and probed linearly,
+ * so insert/erase never allocate once the table has grown to the working set.
+ * Erase uses backward-shift deletion so no tombstones accumulate.
+ * Intended for small, high-churn sets such as outstanding request tracking.
+ */
+template<typename Key, typename Value, typename Hash>
+class IDTable {
+public:
+    IDTable(size_t initialCapacity = 64) : count_(0) {
+        size_t cap = 16;
+        while (cap < initialCapacity) cap <<= 1;
+        slots_.resize(cap);
+        mask_ = cap - 1;
+    }
+
+    size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+
+    /* Returns a pointer to the value for 'key' or nullptr if absent. Pointer is invalidated by insert/erase. */
+    Value* find(const Key& key) {
+        size_t idx = hash_(key) & mask_;
+        while (slots_[idx].used) {
+            if (slots_[idx].key == key)
+                return &(slots_[idx].value);
+            idx = (idx + 1) & mask_;
+        }
+        return nullptr;
+    }
+
+    /* Insert or overwrite the value for 'key' */
+    void insert(const Key& key, const Value& value) {
+        if ((count_ + 1) * 2 > slots_.size())
+            grow();
+        size_t idx = hash_(key) & mask_;
+        while (slots_[idx].used) {
+            if (slots_[idx].key == key) {
+                slots_[idx].value = value;
+                return;
+            }
+            idx = (idx + 1) & mask_;
+        }
+        slots_[idx].used = true;
+        slots_[idx].key = key;
+        slots_[idx].value = value;
+        count_++;
+    }
+
+    /* Remove 'key', copying its value to 'value'. Returns false if 'key' was not present. */
+    bool take(const Key& key, Value& value) {
+        size_t idx = hash_(key) & mask_;
+        while (slots_[idx].used) {
+            if (slots_[idx].key == key) {
+                value = slots_[idx].value;
+                eraseSlot(idx);
+                return true;
+            }
+            idx = (idx + 1) & mask_;
+        }
+        return false;
+    }
+
+    template<typename Func>
+    void forEach(Func f) {
+        for (auto& slot : slots_) {
+            if (slot.used) f(slot.key, slot.value);
+        }
+    }
+
+private:
+    struct Slot {
+        Slot() : used(false), key(), value() {}
+        bool used;
+        Key key;
+        Value value;
+    };
+
+    void eraseSlot(size_t hole) {
+        slots_[hole].used = false;
+        count_--;
+        size_t idx = (hole + 1) & mask_;
+        while (slots_[idx].used) {
+            size_t home = hash_(slots_[idx].key) & mask_;
+            /* Move entry back if 'hole' lies on its probe path from 'home' to 'idx' */
+            if (((idx - home) & mask_) >= ((idx - hole) & mask_)) {
+                slots_[hole] = slots_[idx];
+                slots_[idx].used = false;
+                hole = idx;
+            }
+            idx = (idx + 1) & mask_;
+        }
+    }
+
+    void grow() {
+        std::vector<Slot> old;
+        old.swap(slots_);
+        slots_.resize(old.size() * 2);
+        mask_ = slots_.size() - 1;
+        count_ = 0;
+        for (auto& slot : old) {
+            if (slot.used) insert(slot.key, slot.value);
+        }
+    }
+
+    std::vector<Slot> slots_;
+    size_t mask_;
+    size_t count_;
+    Hash hash_;
+};
+
+}}
+
+#endif /* MEMHIERARCHY_IDTABLE_H */
@@ -23,6 +23,8 @@
 #include "sst/elements/memHierarchy/memTypes.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/replacementManager.h"
+#include "sst/elements/memHierarchy/snapshot.h"
+#include "sst/elements/memHierarchy/compression.h"
 
 using namespace std;
 
@@ -35,6 +37,10 @@ namespace SST { namespace MemHierarchy {
  * - getString() for debug
  * - getAddr() for identifiying a line
  * - getReplacementInfo() for returning the information that a replacement policy might need
+ * - snapshot()/restore() to save and reload the line's stable state for warm starts
+ * Lines with data additionally:
+ * - getCompressedSize() for the space the line occupies in a compressed data array
+ * - setCompressor() to attach the array's compressor, if any
  */
 
 
@@ -115,6 +121,27 @@ class DirectoryLine {
         // Replacement
         ReplacementInfo* getReplacementInfo() { return info_; }
 
+        // Snapshot
+        void snapshot(SnapshotWriter &out) {
+            out.put(addr_);
+            out.put(state_);
+            out.put(wasPrefetch_);
+            out.putString(owner_);
+            out.put(sharers_.size());
+            for (std::set<std::string>::iterator it = sharers_.begin(); it != sharers_.end(); it++)
+                out.putString(*it);
+        }
+        void restore(SnapshotReader &in) {
+            addr_ = in.get();
+            state_ = (State) in.get();
+            wasPrefetch_ = in.get();
+            std::string owner = in.getString();
+            if (!owner.empty())
+                setOwner(owner);
+            for (uint64_t count = in.get(); count > 0; count--)
+                addSharer(in.getString());
+        }
+
         // String-ify for debugging
         std::string getString() {
             std::ostringstream str;
@@ -171,6 +198,16 @@ class DataLine {
         // Replacement
         ReplacementInfo* getReplacementInfo() { return tag_ ? tag_->getReplacementInfo() : info_; }
 
+        // Snapshot - the owner links the line back to its directory line after a restore
+        void snapshot(SnapshotWriter &out) {
+            out.put(addr_);
+            out.putBytes(data_);
+        }
+        void restore(SnapshotReader &in) {
+            addr_ = in.get();
+            in.getBytes(data_);
+        }
+
         // String-ify for debugging
         std::string getString() {
             return (tag_ ? "Valid" : "Invalid");
@@ -185,6 +222,10 @@ class CacheLine {
         State state_;
         vector<uint8_t> data_;
 
+        // Compression - size is the full line unless the array has a compressor
+        Compressor* compressor_;
+        uint32_t compressedSize_;
+
         // Timing
         uint64_t lastSendTimestamp_;
 
@@ -193,13 +234,14 @@ class CacheLine {
 
         virtual void updateReplacement() = 0;
     public:
-        CacheLine(uint32_t size, unsigned int index) : index_(index), addr_(0), state_(I), lastSendTimestamp_(0), wasPrefetch_(false) {
+        CacheLine(uint32_t size, unsigned int index) : index_(index), addr_(0), state_(I), compressor_(nullptr), compressedSize_(size), lastSendTimestamp_(0), wasPrefetch_(false) {
             data_.resize(size);
         }
         virtual ~CacheLine() { }
 
         void reset() {
             state_ = I;
+            compressedSize_ = data_.size();
             lastSendTimestamp_ = 0;
             wasPrefetch_ = false;
         }
@@ -219,8 +261,14 @@ class CacheLine {
         vector<uint8_t>* getData() { return &data_; }
         void setData(vector<uint8_t> in, uint32_t offset) {
             std::copy(in.begin(), in.end(), std::next(data_.begin(), offset));
+            if (compressor_)
+                compressedSize_ = compressor_->compress(data_);
         }
 
+        // Compression
+        uint32_t getCompressedSize() { return compressedSize_; }
+        void setCompressor(Compressor* compressor) { compressor_ = compressor; }
+
         // Timestamp
         uint64_t getTimestamp() { return lastSendTimestamp_; }
         void setTimestamp(uint64_t timestamp) { lastSendTimestamp_ = timestamp; }
@@ -231,6 +279,23 @@ class CacheLine {
 
         virtual ReplacementInfo* getReplacementInfo() = 0;
 
+        // Snapshot
+        void snapshot(SnapshotWriter &out) {
+            out.put(addr_);
+            out.put(state_);
+            out.put(wasPrefetch_);
+            out.put(compressedSize_);
+            out.putBytes(data_);
+        }
+        // The array checks that the compression algorithm matches, so the saved size is still valid
+        void restore(SnapshotReader &in) {
+            addr_ = in.get();
+            setState((State) in.get());
+            wasPrefetch_ = in.get();
+            compressedSize_ = in.get();
+            in.getBytes(data_);
+        }
+
         // String-ify for debugging
         std::string getString() {
             std::ostringstream str;
@@ -370,6 +435,23 @@ class SharedCacheLine : public CacheLine {
         // Replacement
         ReplacementInfo * getReplacementInfo() { return info; }
 
+        // Snapshot
+        void snapshot(SnapshotWriter &out) {
+            CacheLine::snapshot(out);
+            out.putString(owner_);
+            out.put(sharers_.size());
+            for (std::set<std::string>::iterator it = sharers_.begin(); it != sharers_.end(); it++)
+                out.putString(*it);
+        }
+        void restore(SnapshotReader &in) {
+            CacheLine::restore(in);
+            std::string owner = in.getString();
+            if (!owner.empty())
+                setOwner(owner);
+            for (uint64_t count = in.get(); count > 0; count--)
+                addSharer(in.getString());
+        }
+
         // String-ify for debugging
         std::string getString() {
             std::ostringstream str;
@@ -416,6 +498,18 @@ class PrivateCacheLine : public CacheLine {
         // Replacement
         ReplacementInfo * getReplacementInfo() { return info; }
 
+        // Snapshot
+        void snapshot(SnapshotWriter &out) {
+            CacheLine::snapshot(out);
+            out.put(shared);
+            out.put(owned);
+        }
+        void restore(SnapshotReader &in) {
+            CacheLine::restore(in);
+            setShared(in.get());
+            setOwned(in.get());
+        }
+
         // String-ify for debugging
         std::string getString() {
             std::string str = "O: ";
@@ -27,6 +27,20 @@ namespace SST { namespace MemHierarchy {
 
 using namespace std;
 
+/**
+ * Hash for event IDs so that id-keyed lookup tables
+ * can use unordered containers instead of ordered maps
+ */
+struct EventIDHash {
+    size_t operator()(const SST::Event::id_type& id) const {
+        uint64_t key = id.first ^ ((uint64_t)id.second << 40) ^ ((uint64_t)id.second >> 24);
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdULL;
+        key ^= key >> 33;
+        return (size_t)key;
+    }
+};
+
 /**
  * Base class for memH events
  *
@@ -59,6 +59,8 @@ MemNIC::MemNIC(ComponentId_t id, Params &params, TimeConverter* tc) : MemNICBase
 
     clockHandler = new Clock::Handler<MemNIC>(this, &MemNIC::clock);
     clockTC = registerClock(tc, clockHandler);
+
+    configureAggregation(params);
 }
 
 void MemNIC::init(unsigned int phase) {
@@ -82,20 +84,30 @@ bool MemNIC::clock(SimTime_t cycle) {
  */
 bool MemNIC::recvNotify(int) {
     MemRtrEvent * mre = doRecv(link_control);
-    if (mre) {
-        MemEventBase* ev = mre->takeEvent();
+    if (mre && mre->isAggregate()) {
+        std::vector<MemRtrEvent*> events;
+        static_cast<AggregateMemRtrEvent*>(mre)->takeEvents(events);
         delete mre;
-        if (ev) {
-            if (is_debug_event(ev)) {
-                dbg.debug(_L5_, "E: %-40" PRIu64 "  %-20s NIC:Recv      (%s)\n", 
-                    getCurrentSimCycle(), getName().c_str(), ev->getBriefString().c_str());
-            }
-            (*recvHandler)(ev);
-        }
+        for (auto it = events.begin(); it != events.end(); it++)
+            deliver(*it);
+    } else if (mre) {
+        deliver(mre);
     }
     return true;
 }
 
+void MemNIC::deliver(MemRtrEvent* mre) {
+    MemEventBase* ev = mre->takeEvent();
+    delete mre;
+    if (ev) {
+        if (is_debug_event(ev)) {
+            dbg.debug(_L5_, "E: %-40" PRIu64 "  %-20s NIC:Recv      (%s)\n", 
+                getCurrentSimCycle(), getName().c_str(), ev->getBriefString().c_str());
+        }
+        (*recvHandler)(ev);
+    }
+}
+
 
 /* Send event to memNIC */
 void MemNIC::send(MemEventBase *ev) {
@@ -112,8 +124,15 @@ void MemNIC::send(MemEventBase *ev) {
     }
 
     req->givePayload(mre);
-    sendQueue.push(req);
     //printf("%s, %" PRIu64 ", Receive %s, 0x%" PRIx64 "\n", getName().c_str(), getCurrentSimTime("1ps"), CommandString[(int)ev->getCmd()], ev->getRoutingAddress() );
+    if (aggregating())
+        aggregateRequest(req, 0, link_control);
+    else
+        queuePacket(req, 0);
+}
+
+void MemNIC::queuePacket(SimpleNetwork::Request* req, int net) {
+    sendQueue.push(req);
     if (sendQueue.size() == 1)
         drainQueue(&sendQueue, link_control);
     if (sendQueue.size() == 1) /* Attempt again in 1 cycle */
@@ -136,8 +155,15 @@ void MemNIC::printStatus(Output &out) {
     // Since this is just debug/fatal we're just going to read out the queue & re-populate it
     std::queue<SST::Interfaces::SimpleNetwork::Request*> tmpQ;
     while (!sendQueue.empty()) {
-        MemEventBase * ev = static_cast<MemRtrEvent*>(sendQueue.front()->inspectPayload())->inspectEvent();
-        out.output("      %s\n", ev->getVerboseString(out.getVerboseLevel()).c_str());
+        MemRtrEvent * mre = static_cast<MemRtrEvent*>(sendQueue.front()->inspectPayload());
+        if (mre->isAggregate()) {
+            std::vector<MemRtrEvent*> &events = static_cast<AggregateMemRtrEvent*>(mre)->events;
+            out.output("      Aggregate (%zu events):\n", events.size());
+            for (auto it = events.begin(); it != events.end(); it++)
+                out.output("        %s\n", (*it)->inspectEvent()->getVerboseString(out.getVerboseLevel()).c_str());
+        } else {
+            out.output("      %s\n", mre->inspectEvent()->getVerboseString(out.getVerboseLevel()).c_str());
+        }
         tmpQ.push(sendQueue.front());
         sendQueue.pop();
     }
@@ -151,10 +177,19 @@ void MemNIC::emergencyShutdownDebug(Output &out) {
     out.output(" Draining link control...\n");
     MemRtrEvent * mre = doRecv(link_control);
     while (mre != nullptr) {
-        MemEventBase * ev = mre->takeEvent();
-        delete mre;
-        if (ev) {
-            out.output("      Undelivered message: %s\n", ev->getVerboseString(out.getVerboseLevel()).c_str());
+        std::vector<MemRtrEvent*> events;
+        if (mre->isAggregate()) {
+            static_cast<AggregateMemRtrEvent*>(mre)->takeEvents(events);
+            delete mre;
+        } else {
+            events.push_back(mre);
+        }
+        for (auto it = events.begin(); it != events.end(); it++) {
+            MemEventBase * ev = (*it)->takeEvent();
+            delete *it;
+            if (ev) {
+                out.output("      Undelivered message: %s\n", ev->getVerboseString(out.getVerboseLevel()).c_str());
+            }
         }
         mre = doRecv(link_control);
     }
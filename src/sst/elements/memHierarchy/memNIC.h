@@ -50,6 +50,7 @@ public:
 /* Element Library Info */
 #define MEMNIC_ELI_PARAMS MEMNICBASE_ELI_PARAMS, \
         { "min_packet_size",             "(string) Size of a packet without a payload (e.g., control message size)", "8B"},\
+        { "aggregate_events",            "(uint) Maximum number of events to the same destination that are packed into one network packet if they are sent in the same cycle. Reduces the number of network events, e.g., across ranks in a parallel simulation. Each event is still charged its own size. Packets are also limited to what fits in the link control's output buffer. Events wait 1ps and arrive with the rest of their packet, so each can arrive up to 1ps + output buffer size / link bandwidth later than unaggregated. 1 disables aggregation.", "1"},\
         { "network_bw",                  "(string) Network bandwidth. Not used if linkcontrol subcomponent slot is filled.", "80GiB/s" },\
         { "network_input_buffer_size",   "(string) Size of input buffer. Not used if linkcontrol subcomponent slot is filled", "1KiB"},\
         { "network_output_buffer_size",  "(string) Size of output buffer. Not used if linkcontrol subcomponent slot is filled.", "1KiB"},\
@@ -97,8 +98,14 @@ public:
     void printStatus(Output &out) override;
     void emergencyShutdownDebug(Output &out) override;
 
+protected:
+    void queuePacket(SST::Interfaces::SimpleNetwork::Request* req, int net) override;
+
 private:
 
+    /* Hand a received event to the parent */
+    void deliver(MemRtrEvent* mre);
+
     // Other parameters
     size_t packetHeaderBytes;
 
@@ -19,6 +19,7 @@
 #include <string>
 #include <unordered_map>
 #include <queue>
+#include <vector>
 
 #include <sst/core/event.h>
 #include <sst/core/output.h>
@@ -91,6 +92,7 @@ class MemNICBase : public MemLinkBase {
                 }
 
                 virtual bool hasClientData() const { return true; }
+                virtual bool isAggregate() const { return false; }
 
                 virtual std::string toString() const override {
                     return event->toString();
@@ -140,6 +142,48 @@ class MemNICBase : public MemLinkBase {
                 ImplementSerializable(SST::MemHierarchy::MemNICBase::InitMemRtrEvent);
         };
 
+        // Several MemRtrEvents to the same destination carried in a single network packet
+        class AggregateMemRtrEvent : public MemRtrEvent {
+            public:
+                std::vector<MemRtrEvent*> events;
+
+                AggregateMemRtrEvent() : MemRtrEvent() { }
+                ~AggregateMemRtrEvent() {
+                    for (auto it = events.begin(); it != events.end(); it++)
+                        delete *it;
+                }
+
+                virtual Event* clone(void) override {
+                    AggregateMemRtrEvent * amre = new AggregateMemRtrEvent(*this);
+                    amre->event = nullptr;
+                    for (auto it = amre->events.begin(); it != amre->events.end(); it++)
+                        *it = static_cast<MemRtrEvent*>((*it)->clone());
+                    return amre;
+                }
+
+                virtual bool isAggregate() const override { return true; }
+
+                /* Give up ownership of the contained events */
+                void takeEvents(std::vector<MemRtrEvent*> &out) {
+                    out = std::move(events);
+                    events.clear();
+                }
+
+                virtual std::string toString() const override {
+                    std::string str = "Aggregate (" + std::to_string(events.size()) + " events)";
+                    for (auto it = events.begin(); it != events.end(); it++)
+                        str += "\n  " + (*it)->toString();
+                    return str;
+                }
+
+                void serialize_order(SST::Core::Serialization::serializer &ser) override {
+                    MemRtrEvent::serialize_order(ser);
+                    ser & events;
+                }
+
+                ImplementSerializable(SST::MemHierarchy::MemNICBase::AggregateMemRtrEvent);
+        };
+
         // Init functions
         virtual void sendUntimedData(MemEventInit* ev, bool broadcast = true) {
             DISABLE_WARN_DEPRECATED_DECLARATION
@@ -475,6 +519,82 @@ class MemNICBase : public MemLinkBase {
             return size.getRoundedValue();
         }
 
+        /*
+         * Event aggregation
+         * Events sent to the same destination on the same network at the same time are packed into one
+         * packet, up to 'aggregate_events' per packet. Open packets are sent 1ps later, which reduces the number
+         * of network events (e.g., across ranks in a partitioned simulation). Each packet is sized as the sum of
+         * its events' sizes so that the network still charges bandwidth per event.
+         * A packet is never made larger than the link control can currently accept (spaceToSend), so it always
+         * fits in the output buffer and cannot stall the NIC.
+         * Aggregation changes timing: every event waits 1ps for the flush and arrives together with the rest of
+         * its packet. An event can therefore arrive up to the serialization time of the events packed behind it
+         * later than it would unaggregated, at most 1ps + output buffer size / link bandwidth.
+         * Subclasses that support aggregation document the parameter, call configureAggregation() from their
+         * constructor, and pass requests to aggregateRequest() instead of queueing them when aggregating().
+         */
+        void configureAggregation(Params &params) {
+            aggregateMax = params.find<uint32_t>("aggregate_events", 1);
+            if (aggregateMax > 1) {
+                aggregateSelfLink = configureSelfLink("AggregateSelfLink", "1ps", new Event::Handler<MemNICBase>(this, &MemNICBase::aggregateFlush));
+            }
+        }
+
+        bool aggregating() const { return aggregateMax > 1; }
+
+        // Add a request to the open packet for its network and destination or open a new packet
+        // If the request would not fit in the packet, the packet is sent and the request opens a new one
+        void aggregateRequest(SST::Interfaces::SimpleNetwork::Request* req, int net, SST::Interfaces::SimpleNetwork* linkcontrol) {
+            for (auto it = aggregateBuffer.begin(); it != aggregateBuffer.end(); it++) {
+                if (it->first != net || it->second->dest != req->dest) continue;
+
+                SST::Interfaces::SimpleNetwork::Request* packet = it->second;
+                if (!linkcontrol->spaceToSend(packet->vn, packet->size_in_bits + req->size_in_bits)) {
+                    aggregateBuffer.erase(it);
+                    queuePacket(packet, net);
+                    break;
+                }
+
+                MemRtrEvent * mre = static_cast<MemRtrEvent*>(packet->inspectPayload());
+                AggregateMemRtrEvent * amre;
+                if (mre->isAggregate()) {
+                    amre = static_cast<AggregateMemRtrEvent*>(mre);
+                } else {
+                    amre = new AggregateMemRtrEvent();
+                    amre->events.push_back(static_cast<MemRtrEvent*>(packet->takePayload()));
+                    packet->givePayload(amre);
+                }
+                amre->events.push_back(static_cast<MemRtrEvent*>(req->takePayload()));
+                packet->size_in_bits += req->size_in_bits;
+                delete req;
+
+                if (amre->events.size() >= aggregateMax) { // Packet is full, send it now
+                    aggregateBuffer.erase(it);
+                    queuePacket(packet, net);
+                }
+                return;
+            }
+
+            aggregateBuffer.push_back(std::make_pair(net, req));
+            if (!aggregateFlushPending) {
+                aggregateFlushPending = true;
+                aggregateSelfLink->send(nullptr);
+            }
+        }
+
+        // End of cycle, send all open packets
+        void aggregateFlush(SST::Event* ev) {
+            aggregateFlushPending = false;
+            for (auto it = aggregateBuffer.begin(); it != aggregateBuffer.end(); it++)
+                queuePacket(it->second, it->first);
+            aggregateBuffer.clear();
+        }
+
+        // Queue a packet on a network's send queue. Must be implemented by subclasses that aggregate.
+        virtual void queuePacket(SST::Interfaces::SimpleNetwork::Request* req, int net) {
+            dbg.fatal(CALL_INFO, -1, "%s (MemNICBase), Error: this NIC does not support event aggregation\n", getName().c_str());
+        }
+
         // Drain a send queue
         void drainQueue(std::queue<SST::Interfaces::SimpleNetwork::Request*>* queue, SST::Interfaces::SimpleNetwork* linkcontrol) {
             while (!(queue->empty())) {
@@ -545,6 +665,12 @@ class MemNICBase : public MemLinkBase {
         std::unordered_set<uint32_t> sourceIDs, destIDs; // IDs which this endpoint cares about
         uint32_t range_check = true; // Enable overlapping range check
 
+        // Aggregation
+        uint32_t aggregateMax = 1; // Max events per packet, 1 = no aggregation
+        SST::Link* aggregateSelfLink = nullptr;
+        bool aggregateFlushPending = false;
+        std::vector<std::pair<int, SST::Interfaces::SimpleNetwork::Request*> > aggregateBuffer; // Open packets by network, in the order they were opened
+
     private:
 
         void build(Params& params) {
@@ -79,6 +79,8 @@ MemNICFour::MemNICFour(ComponentId_t id, Params &params, TimeConverter* tc) : Me
     std::string timebase = params.find<std::string>("clock", "1GHz", found);
     if (found)
         setDefaultTimeBase(getTimeConverter(timebase));
+
+    configureAggregation(params);
 }
 
 void MemNICFour::init(unsigned int phase) {
@@ -159,6 +161,13 @@ void MemNICFour::send(MemEventBase *ev) {
         dbg.debug(_L5_, "N: %-40" PRI_NID "  %-20s Enqueue:%s  Dst: %" PRI_NID ", bits: %zu, (%s)\n",
             getCurrentSimCycle(), getName().c_str(), netstr.c_str(), req->dest, req->size_in_bits, ev->getBriefString().c_str());
     }
+    if (aggregating())
+        aggregateRequest(req, net, link_control[net]);
+    else
+        queuePacket(req, net);
+}
+
+void MemNICFour::queuePacket(SimpleNetwork::Request* req, int net) {
     sendQueue[net].push(req);
     if (sendQueue[net].size() == 1) { /* Send this cycle if we're not already stalled */
         drainQueue(&sendQueue[net], link_control[net]);
@@ -197,43 +206,56 @@ bool MemNICFour::recvNotifyData(int) {
 
 void MemNICFour::doRecv(SimpleNetwork::Request * req, NetType net) {
     uint64_t src = req->src;
-    OrderedMemRtrEvent * mre = processRecv(req); // Return the splitmemrtrevent if we have one
+    MemRtrEvent * mre = processRecv(req); // Return the splitmemrtrevent if we have one
+
+    if (mre == nullptr)
+        return;
+
+    if (mre->isAggregate()) { // Each event in an aggregate carries its own order tag
+        std::vector<MemRtrEvent*> events;
+        static_cast<AggregateMemRtrEvent*>(mre)->takeEvents(events);
+        delete mre;
+        for (auto it = events.begin(); it != events.end(); it++)
+            orderRecv(static_cast<OrderedMemRtrEvent*>(*it), src, net);
+    } else {
+        orderRecv(static_cast<OrderedMemRtrEvent*>(mre), src, net);
+    }
+}
 
-    if (mre != nullptr) {
-        dbg.debug(_L3_, "%s, memNIC received a message: <%" PRIu64 ", %u>\n",
-                getName().c_str(), src, mre->tag);
+void MemNICFour::orderRecv(OrderedMemRtrEvent * mre, uint64_t src, NetType net) {
+    dbg.debug(_L3_, "%s, memNIC received a message: <%" PRIu64 ", %u>\n",
+            getName().c_str(), src, mre->tag);
+
+    stat_oooDepthSrc->addData(orderBuffer[src].size());
+    stat_oooDepth->addData(totalOOO);
+    if (mre->tag == recvTags[src]) { // Got the tag we were expecting
+        stat_oooEvent[net]->addData(0); // Count total number of events received
+        recvTags[src]++;
+
+        if (recvQueue.empty())
+            recvNotify(mre);
+        else {
+            // Still push one message for every receive...
+            recvQueue.push(mre);
+            recvNotify(recvQueue.front());
+            recvQueue.pop();
+        }
 
-        stat_oooDepthSrc->addData(orderBuffer[src].size());
-        stat_oooDepth->addData(totalOOO);
-        if (mre->tag == recvTags[src]) { // Got the tag we were expecting
-            stat_oooEvent[net]->addData(0); // Count total number of events received
+        while (orderBuffer[src].find(recvTags[src]) != orderBuffer[src].end()) {
+            totalOOO--;
+            recvQueue.push(orderBuffer[src][recvTags[src]].first);
+            stat_orderLatency->addData(getCurrentSimTime() - orderBuffer[src][recvTags[src]].second);
+            orderBuffer[src].erase(recvTags[src]);
             recvTags[src]++;
-
-            if (recvQueue.empty())
-                recvNotify(mre);
-            else {
-                // Still push one message for every receive...
-                recvQueue.push(mre);
-                recvNotify(recvQueue.front());
-                recvQueue.pop();
-            }
-
-            while (orderBuffer[src].find(recvTags[src]) != orderBuffer[src].end()) {
-                totalOOO--;
-                recvQueue.push(orderBuffer[src][recvTags[src]].first);
-                stat_orderLatency->addData(getCurrentSimTime() - orderBuffer[src][recvTags[src]].second);
-                orderBuffer[src].erase(recvTags[src]);
-                recvTags[src]++;
-            }
-        } else {
-            totalOOO++;
-            stat_oooEvent[net]->addData(1); // Count number of out of order events received
-            orderBuffer[src][mre->tag] = std::make_pair(mre,getCurrentSimTime());
-        }
-        if (!clockOn && !recvQueue.empty()) {
-            clockOn = true;
-            reregisterClock(clockTC, clockHandler);
         }
+    } else {
+        totalOOO++;
+        stat_oooEvent[net]->addData(1); // Count number of out of order events received
+        orderBuffer[src][mre->tag] = std::make_pair(mre,getCurrentSimTime());
+    }
+    if (!clockOn && !recvQueue.empty()) {
+        clockOn = true;
+        reregisterClock(clockTC, clockHandler);
     }
 }
 
@@ -252,19 +274,13 @@ void MemNICFour::recvNotify(OrderedMemRtrEvent* mre) {
     (*recvHandler)(me);
 }
 
-MemNICFour::OrderedMemRtrEvent* MemNICFour::processRecv(SimpleNetwork::Request * req) {
+MemNICBase::MemRtrEvent* MemNICFour::processRecv(SimpleNetwork::Request * req) {
     if (req != nullptr) {
         MemRtrEvent * mre = static_cast<MemRtrEvent*>(req->takePayload());
         delete req;
 
         if (mre->hasClientData()) {
-            OrderedMemRtrEvent * smre = static_cast<OrderedMemRtrEvent*>(mre);
-            /*if (smre->event != nullptr) {
-             * This should not be needed, we shouldn't be using the link IDs for anything in elements
-                MemEventBase * ev = static_cast<MemEventBase*>(smre->event);
-                ev->setDeliveryLink(smre->getLinkId(), NULL);
-            }*/
-            return smre;
+            return mre;
         } else {
             InitMemRtrEvent *imre = static_cast<InitMemRtrEvent*>(mre);
             if (networkAddressMap.find(imre->info.name) == networkAddressMap.end()) {
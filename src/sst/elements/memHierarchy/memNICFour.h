@@ -57,7 +57,8 @@ public:
         { "fwd.network_output_buffer_size", "(string) Fwd network. Size of output buffer", "1KiB"},\
         { "fwd.min_packet_size",            "(string) Fwd network. Size of a packet without a payload (e.g., control message size)", "8B"},\
         { "fwd.port",                       "(string) Fwd network. Set by parent component. Name of port this NIC sits on.", ""},\
-        { "clock",                          "(string) Units for latency statistics. If not specified, units provided by parent component will be used.", "1GHz"}
+        { "clock",                          "(string) Units for latency statistics. If not specified, units provided by parent component will be used.", "1GHz"},\
+        { "aggregate_events",               "(uint) Maximum number of events to the same destination on the same network that are packed into one packet if they are sent in the same cycle. Reduces the number of network events, e.g., across ranks in a parallel simulation. Each event is still charged its own size. Packets are also limited to what fits in the link control's output buffer. Events wait 1ps and arrive with the rest of their packet, so each can arrive up to 1ps + output buffer size / link bandwidth later than unaggregated. 1 disables aggregation.", "1"}
 
 
     SST_ELI_REGISTER_SUBCOMPONENT(MemNICFour, "memHierarchy", "MemNICFour", SST_ELI_ELEMENT_VERSION(1,0,0),
@@ -146,10 +147,14 @@ public:
     /* Debug support */
     void printStatus(Output& out);
 
+protected:
+    void queuePacket(SST::Interfaces::SimpleNetwork::Request* req, int net) override;
+
 private:
 
     void recvNotify(MemNICFour::OrderedMemRtrEvent* mre);
-    MemNICFour::OrderedMemRtrEvent* processRecv(SST::Interfaces::SimpleNetwork::Request* req);
+    void orderRecv(MemNICFour::OrderedMemRtrEvent* mre, uint64_t src, NetType net);
+    MemRtrEvent* processRecv(SST::Interfaces::SimpleNetwork::Request* req);
 
     // Other parameters
     size_t packetHeaderBytes[4];
@@ -116,7 +116,9 @@ SimpleNetwork::Request* MemNetBridge::translate(SimpleNetwork::Request *req, uin
 
     SimpleNetwork::nid_t tgt;
     if ( mre->hasClientData() ) {
-        tgt = getAddrFor(outNet, mre->inspectEvent()->getDst());
+        /* Aggregated events all share a destination */
+        MemEventBase *ev = mre->isAggregate() ? static_cast<MemNIC::AggregateMemRtrEvent*>(mre)->events.front()->inspectEvent() : mre->inspectEvent();
+        tgt = getAddrFor(outNet, ev->getDst());
         dbg.debug(_L5_, "E: %-40" PRIu64 " %-21s Bridge:Tx     %d to %" PRI_NID ": (%s)\n",
                 getCurrentSimCycle(), getName().c_str(), fromNet, tgt, mre->toString().c_str());
     } else {
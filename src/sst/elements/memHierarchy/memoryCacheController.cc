@@ -72,6 +72,11 @@ MemCacheController::MemCacheController(ComponentId_t id, Params &params) : Compo
     // Output for warnings
     out.init("", params.find<int>("verbose", 1), 0, Output::STDOUT);
 
+    sectors_ = params.find<unsigned int>("sector_count", 1);
+    if (sectors_ == 0 || sectors_ > 64 || !isPowerOfTwo(sectors_))
+        out.fatal(CALL_INFO, -1, "%s, Error - Invalid param: sector_count. Must be a power of 2 between 1 and 64. You specified %u\n", getName().c_str(), sectors_);
+    blockSize_ = lineSize_ * sectors_;
+
     /* Clock Handler */
     std::string clockfreq = params.find<std::string>("clock");
     UnitAlgebra clock_ua(clockfreq);
@@ -117,10 +122,10 @@ MemCacheController::MemCacheController(ComponentId_t id, Params &params) : Compo
     lineOffset_ = log2Of(lineSize_);
     uint64_t addrStart = params.find<uint64_t>("cache_num", 0);
     uint64_t interleaveStep = params.find<uint64_t>("num_caches", 1);
-    region_.start = addrStart * lineSize_;
+    region_.start = addrStart * blockSize_;
     region_.end = (uint64_t) - 1;
-    region_.interleaveSize = lineSize_;
-    region_.interleaveStep = lineSize_ * interleaveStep; //(lineSize_ * interleaveStep) >> lineOffset_;
+    region_.interleaveSize = blockSize_; // Sectored caches own whole blocks
+    region_.interleaveStep = blockSize_ * interleaveStep; //(lineSize_ * interleaveStep) >> lineOffset_;
    // if (region_.interleaveSize == 0) region_.interleaveSize = lineSize_;
    // if (region_.interleaveStep == 0) region_.interleaveStep = ;
 
@@ -187,17 +192,24 @@ MemCacheController::MemCacheController(ComponentId_t id, Params &params) : Compo
     }
 
     /* Initialize cache */
-    uint64_t cachesize = memSize_ / lineSize_;
-    if (memSize_ % lineSize_ != 0)
-        out.fatal(CALL_INFO, -1, "%s, Error - memory size must be a multiple of line size. Memory size is %zu bytes and line size is %" PRIu64 " bytes\n",
-                getName().c_str(), memSize_, lineSize_);
+    uint64_t cachesize = memSize_ / blockSize_;
+    if (memSize_ % blockSize_ != 0)
+        out.fatal(CALL_INFO, -1, "%s, Error - memory size must be a multiple of line size times sector_count. Memory size is %zu bytes and line size * sector_count is %" PRIu64 " bytes\n",
+                getName().c_str(), memSize_, blockSize_);
     cache_.resize(cachesize, CacheState(0,I));
 
+    snapshotMode_ = getSnapshotMode(params, &out, getName(), snapshotFile_);
+
     /* Statistics */
     statReadHit = registerStatistic<uint64_t>("CacheHits_Read");
     statReadMiss = registerStatistic<uint64_t>("CacheMisses_Read");
     statWriteHit = registerStatistic<uint64_t>("CacheHits_Write");
     statWriteMiss = registerStatistic<uint64_t>("CacheMisses_Write");
+    if (sectors_ > 1) {
+        statSectorMiss = registerStatistic<uint64_t>("SectorMisses");
+        statSectorWriteback = registerStatistic<uint64_t>("SectorWritebacks");
+        statSectorsEvicted = registerStatistic<uint64_t>("SectorsEvicted");
+    }
 
 }
 
@@ -285,11 +297,17 @@ void MemCacheController::handleRead(MemEvent* event, bool replay) {
         if (is_debug_event(event))
             Debug(_L3_, "%" PRIu64 " (%s) StateTransition %" PRIu64 ", STALL\n", getCurrentSimTimeNano(), getName().c_str(), event->getID().first);
         return;
-    } else if (blockState == I || blockAddr != event->getBaseAddr()) {      // MISS
+    } else if (blockState == I || blockAddr != toBlockAddr(event->getBaseAddr())) {      // MISS
         it->second.status = (blockState == M) ? AccessStatus::MISS_WB : AccessStatus::MISS;
         statReadMiss->addData(1);
         if (is_debug_event(event))
             Debug(_L3_, "%" PRIu64 " (%s) StateTransition %" PRIu64 ", %s\n", getCurrentSimTimeNano(), getName().c_str(), event->getID().first, (blockState == M) ? "MISS_WB" : "MISS");
+    } else if (!(cache_[cacheIndex].valid & (UINT64_C(1) << toSector(event->getBaseAddr())))) { // MISS, sector only
+        it->second.status = AccessStatus::MISS_SECTOR;
+        statReadMiss->addData(1);
+        statSectorMiss->addData(1);
+        if (is_debug_event(event))
+            Debug(_L3_, "%" PRIu64 " (%s) StateTransition %" PRIu64 ", MISS_SECTOR\n", getCurrentSimTimeNano(), getName().c_str(), event->getID().first);
     } else {                                                                // HIT
         statReadHit->addData(1);
         it->second.status = AccessStatus::HIT;
@@ -298,8 +316,8 @@ void MemCacheController::handleRead(MemEvent* event, bool replay) {
     }
 
     it->second.reqev = new MemEvent(*event);
-    it->second.reqev->setBaseAddr(cacheIndex);
-    it->second.reqev->setAddr(event->getAddr() - event->getBaseAddr() + cacheIndex);
+    it->second.reqev->setBaseAddr(toCacheLine(event->getBaseAddr()));
+    it->second.reqev->setAddr(event->getAddr() - event->getBaseAddr() + toCacheLine(event->getBaseAddr()));
     it->second.reqev->setCmd(Command::GetS);
 
     memBackendConvertor_->handleMemEvent(it->second.reqev);
@@ -326,12 +344,18 @@ void MemCacheController::handleWrite(MemEvent* event, bool replay) {
         if (is_debug_event(event))
             Debug(_L3_, "\n%" PRIu64 " (%s) StateTransition %" PRIu64 ", STALL\n", getCurrentSimTimeNano(), getName().c_str(), event->getID().first);
         return;
-    } else if (blockState == I || blockAddr != event->getBaseAddr()) {      // MISS
+    } else if (blockState == I || blockAddr != toBlockAddr(event->getBaseAddr())) {      // MISS
         // Do a read to time the state lookup
         statWriteMiss->addData(1);
         it->second.status = (blockState == M ) ? AccessStatus::MISS_WB : AccessStatus::MISS;
         if (is_debug_event(event))
             Debug(_L3_, "\n%" PRIu64 " (%s) StateTransition %" PRIu64 ", %s\n", getCurrentSimTimeNano(), getName().c_str(), event->getID().first, (blockState == M) ? "MISS_WB" : "MISS");
+    } else if (!(cache_[cacheIndex].valid & (UINT64_C(1) << toSector(event->getBaseAddr())))) { // MISS, sector only
+        statWriteMiss->addData(1);
+        statSectorMiss->addData(1);
+        it->second.status = AccessStatus::MISS_SECTOR;
+        if (is_debug_event(event))
+            Debug(_L3_, "\n%" PRIu64 " (%s) StateTransition %" PRIu64 ", MISS_SECTOR\n", getCurrentSimTimeNano(), getName().c_str(), event->getID().first);
     } else {                                                                // HIT
         statWriteHit->addData(1);
         it->second.status = AccessStatus::HIT_TAG;
@@ -341,8 +365,8 @@ void MemCacheController::handleWrite(MemEvent* event, bool replay) {
 
     /* Lookup tag data -> required whether or not this is a hit */
     it->second.reqev = new MemEvent(*event);
-    it->second.reqev->setBaseAddr(cacheIndex);
-    it->second.reqev->setAddr(event->getAddr() - event->getBaseAddr() + cacheIndex);
+    it->second.reqev->setBaseAddr(toCacheLine(event->getBaseAddr()));
+    it->second.reqev->setAddr(event->getAddr() - event->getBaseAddr() + toCacheLine(event->getBaseAddr()));
     it->second.reqev->setCmd(Command::GetS);
 
     memBackendConvertor_->handleMemEvent(it->second.reqev);
@@ -372,8 +396,8 @@ void MemCacheController::handleDataResponse(MemEvent* event) {
 
     // Update local memory
     it->second.reqev = new MemEvent(*it->second.event);
-    it->second.reqev->setAddr(cacheIndex);
-    it->second.reqev->setBaseAddr(cacheIndex);
+    it->second.reqev->setAddr(toCacheLine(event->getBaseAddr()));
+    it->second.reqev->setBaseAddr(toCacheLine(event->getBaseAddr()));
     it->second.reqev->setCmd(Command::PutM);
     it->second.reqev->setPayload(event->getPayload());
     it->second.reqev->clearFlag();
@@ -384,12 +408,15 @@ void MemCacheController::handleDataResponse(MemEvent* event) {
     memBackendConvertor_->handleMemEvent(it->second.reqev);
 
     // Update backing store from the request that missed if it was a write
+    uint64_t sector = UINT64_C(1) << toSector(event->getBaseAddr());
+    cache_[cacheIndex].valid |= sector;
     if (it->second.event->getCmd() == Command::PutM || it->second.event->getCmd() == Command::Write) {
         cache_[cacheIndex].state = M;
+        cache_[cacheIndex].dirty |= sector;
         if (backing_)
             writeData(it->second.event);
     } else {
-        cache_[cacheIndex].state = E;
+        cache_[cacheIndex].state = cache_[cacheIndex].dirty ? M : E;
     }
 
     // Respond to requestor
@@ -437,13 +464,26 @@ void MemCacheController::handleLocalMemResponse( Event::id_type id, uint32_t fla
     Addr localIndex;
     switch (it->second.status) {
         case AccessStatus::MISS_WB:
-            /* Write back data to memory */
-            remoteWr = new MemEvent(getName(), blockAddr, blockAddr, Command::PutM, lineSize_);
-            readData(remoteWr);
-            remoteWr->setFlag(MemEvent::F_NORESPONSE); // Don't send a response to this
-            remoteWr->setDst(link_->getTargetDestination(remoteWr->getBaseAddr()));
-            link_->send(remoteWr);
+            /* Write back dirty data to memory */
+            for (unsigned int i = 0; i < sectors_; i++) {
+                if (!(cache_[cacheIndex].dirty & (UINT64_C(1) << i)))
+                    continue;
+                remoteWr = new MemEvent(getName(), blockAddr + i * lineSize_, blockAddr + i * lineSize_, Command::PutM, lineSize_);
+                readData(remoteWr);
+                remoteWr->setFlag(MemEvent::F_NORESPONSE); // Don't send a response to this
+                remoteWr->setDst(link_->getTargetDestination(remoteWr->getBaseAddr()));
+                link_->send(remoteWr);
+                if (sectors_ > 1)
+                    statSectorWriteback->addData(1);
+            }
         case AccessStatus::MISS:
+            /* Replace the block */
+            if (sectors_ > 1 && blockState != I)
+                statSectorsEvicted->addData(__builtin_popcountll(cache_[cacheIndex].valid));
+            cache_[cacheIndex].addr = toBlockAddr(ev->getBaseAddr());
+            cache_[cacheIndex].valid = 0;
+            cache_[cacheIndex].dirty = 0;
+        case AccessStatus::MISS_SECTOR:
             /* Read new data from memory */
             remoteRd = new MemEvent(*ev);
             remoteRd->setCmd(Command::GetS);
@@ -456,7 +496,6 @@ void MemCacheController::handleLocalMemResponse( Event::id_type id, uint32_t fla
             it->second.status = AccessStatus::DATA; // We've request data, waiting for response
             if (is_debug_event(it->second.event))
                 Debug(_L3_, "\n%" PRIu64 " (%s) StateTransition %" PRIu64 ", DATA\n", getCurrentSimTimeNano(), getName().c_str(), it->second.event->getID().first);
-            cache_[cacheIndex].addr = ev->getBaseAddr();
             cache_[cacheIndex].state = IM;
             break;
         case AccessStatus::HIT_TAG: // tag hit, issue write
@@ -466,6 +505,7 @@ void MemCacheController::handleLocalMemResponse( Event::id_type id, uint32_t fla
                 Debug(_L3_, "\n%" PRIu64 " (%s) StateTransition %" PRIu64 ", HIT\n", getCurrentSimTimeNano(), getName().c_str(), it->second.event->getID().first);
             memBackendConvertor_->handleMemEvent(ev);
             cache_[cacheIndex].state = M;
+            cache_[cacheIndex].dirty |= UINT64_C(1) << toSector(ev->getBaseAddr());
             break;
         case AccessStatus::HIT:
             /* Write data. Here instead of receive to try to match backing access order to backend execute order */
@@ -576,6 +616,8 @@ void MemCacheController::setup(void) {
     memBackendConvertor_->setup();
     link_->setup();
 
+    if (snapshotMode_ == SnapshotMode::LOAD)
+        restore();
 }
 
 
@@ -583,6 +625,86 @@ void MemCacheController::finish(void) {
     Cycle_t cycle = getNextClockCycle(clockTimeBase_);
     memBackendConvertor_->finish(cycle);
     link_->finish();
+
+    if (snapshotMode_ == SnapshotMode::SAVE)
+        snapshot();
+}
+
+/* Snapshot layout: geometry, then each resident block as
+ * (index distance from the previous block, address, state, valid mask, dirty mask, data of each valid sector) */
+void MemCacheController::snapshot() {
+    SnapshotWriter snap(&out, snapshotFile_, "MemCacheController");
+    snap.put(memSize_);
+    snap.put(lineSize_);
+    snap.put(sectors_);
+    snap.put(region_.start);
+    snap.put(region_.interleaveStep);
+    snap.put(backing_ != nullptr);
+
+    uint64_t count = 0;
+    for (size_t i = 0; i < cache_.size(); i++) {
+        if (cache_[i].state != I)
+            count++;
+    }
+    snap.put(count);
+
+    std::vector<uint8_t> data(lineSize_);
+    uint64_t last = 0;
+    for (size_t i = 0; i < cache_.size(); i++) {
+        CacheState& block = cache_[i];
+        if (block.state == I)
+            continue;
+        if (!isSnapshotState(block.state))
+            out.fatal(CALL_INFO, -1, "%s, Error: cannot snapshot block 0x%" PRIx64 " in transient state %s. Snapshots must be taken when the cache is idle.\n",
+                    getName().c_str(), block.addr, StateString[block.state]);
+
+        snap.put(i - last);
+        last = i;
+        snap.put(block.addr);
+        snap.put(block.state);
+        snap.put(block.valid);
+        snap.put(block.dirty);
+        for (unsigned int s = 0; backing_ && s < sectors_; s++) {
+            if (block.valid & (1ULL << s)) {
+                backing_->get(toCacheLine(block.addr + s * lineSize_), lineSize_, data);
+                snap.putBytes(data);
+            }
+        }
+    }
+    snap.close();
+}
+
+void MemCacheController::restore() {
+    SnapshotReader snap(&out, snapshotFile_, "MemCacheController");
+    snap.expect("mem_size", memSize_);
+    snap.expect("cache_line_size", lineSize_);
+    snap.expect("sector_count", sectors_);
+    snap.expect("cache_num", region_.start / blockSize_);
+    snap.expect("num_caches", region_.interleaveStep / blockSize_);
+    snap.expect("backing", backing_ != nullptr);
+
+    std::vector<uint8_t> data;
+    uint64_t index = 0;
+    for (uint64_t count = snap.get(); count > 0; count--) {
+        index += snap.get();
+        if (index >= cache_.size())
+            out.fatal(CALL_INFO, -1, "%s, Error: snapshot '%s' is truncated or corrupt\n", getName().c_str(), snapshotFile_.c_str());
+
+        CacheState& block = cache_[index];
+        block.addr = snap.get();
+        block.state = (State) snap.get();
+        block.valid = snap.get();
+        block.dirty = snap.get();
+        for (unsigned int s = 0; backing_ && s < sectors_; s++) {
+            if (block.valid & (1ULL << s)) {
+                snap.getBytes(data);
+                if (data.size() != lineSize_)
+                    out.fatal(CALL_INFO, -1, "%s, Error: snapshot '%s' is truncated or corrupt\n", getName().c_str(), snapshotFile_.c_str());
+                backing_->set(toCacheLine(block.addr + s * lineSize_), lineSize_, data);
+            }
+        }
+    }
+    snap.close();
 }
 
 void MemCacheController::writeData(MemEvent* event) {
@@ -590,7 +712,7 @@ void MemCacheController::writeData(MemEvent* event) {
     bool noncacheable = event->queryFlag(MemEvent::F_NONCACHEABLE);
     Addr addr = noncacheable ? event->getAddr() : event->getBaseAddr();
 
-    addr = toLocalAddr(addr);
+    addr = toCacheLine(addr);
 
     if (event->getCmd() == Command::PutM) { /* Write request to memory */
         if (is_debug_event(event)) { Debug(_L4_, "\tUpdate backing. Addr = %" PRIx64 ", Size = %i\n", addr, event->getSize()); }
@@ -615,7 +737,7 @@ void MemCacheController::readData(MemEvent* event) {
     bool noncacheable = event->queryFlag(MemEvent::F_NONCACHEABLE);
     Addr localAddr = noncacheable ? event->getAddr() : event->getBaseAddr();
 
-    localAddr = toLocalAddr(localAddr);
+    localAddr = toCacheLine(localAddr);
 
     vector<uint8_t> payload;
     payload.resize(event->getSize(), 0);
@@ -659,6 +781,11 @@ Addr MemCacheController::toLocalAddr(Addr addr) {
     return rAddr;
 }
 
+/* Local line of an address: the cache index for unsectored caches, the index of the sector otherwise */
+Addr MemCacheController::toCacheLine(Addr addr) {
+    return toLocalAddr(addr) * sectors_ + toSector(addr);
+}
+
 
 
 void MemCacheController::processInitEvent( MemEventInit* me ) {
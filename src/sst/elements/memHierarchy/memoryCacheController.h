@@ -26,6 +26,7 @@
 #include "sst/elements/memHierarchy/memLinkBase.h"
 #include "sst/elements/memHierarchy/membackend/backing.h"
 #include "sst/elements/memHierarchy/customcmd/customCmdMemory.h"
+#include "sst/elements/memHierarchy/snapshot.h"
 
 namespace SST {
 namespace MemHierarchy {
@@ -42,9 +43,12 @@ public:
             {"num_caches",          "(uint) Total number of memory caches", "1"},\
             {"cache_num",           "(uint) Index of this cache between 0 and num_caches-1", "0"}, \
             {"cache_line_size",     "(uint) Cache line size in bytes", "64"}, \
+            {"sector_count",        "(uint) Number of cache_line_size sectors that share one tag, up to 64. Values above 1 make a sectored cache with per-sector valid and dirty bits: misses fetch one sector and evictions write back only dirty sectors. Caches are then interleaved at cache_line_size*sector_count.", "1"}, \
             {"backing",             "(string) Type of backing store to use. Options: 'none' - no backing store (only use if simulation does not require correct memory values), 'malloc', or 'mmap'", "mmap"},\
             {"backing_size_unit",   "(string) For 'malloc' backing stores, malloc granularity", "1MiB"},\
             {"memory_file",         "(string) Optional backing-store file to pre-load memory, or store resulting state", "N/A"},\
+            {"checkpoint",          "(string) Warm-start snapshot of the tags, sector valid/dirty bits and cached data. 'save' writes it at the end of simulation, 'load' restores it during setup. Use the same setting for every cache, directory and memory in the hierarchy.", ""},\
+            {"checkpointDir",       "(string) Directory that holds snapshots, one file per component named after the component. Required if checkpoint is set.", ""},\
             {"verbose",             "(uint) Output verbosity for warnings/errors. 0[fatal error only], 1[warnings], 2[full state dump on fatal error]","1"},\
             {"debug",               "(uint) 0: No debugging, 1: STDOUT, 2: STDERR, 3: FILE.", "0"},\
             {"debug_level",         "(uint) Debugging level: 0 to 10. Must configure sst-core with '--enable-debug'. 1=info, 2-10=debug output", "0"},\
@@ -57,6 +61,9 @@ public:
             {"CacheHits_Write",  "Number of write hits", "count", 1},
             {"CacheMisses_Read",  "Number of read misses", "count", 1},
             {"CacheMisses_Write",  "Number of write misses", "count", 1},
+            {"SectorMisses",  "Number of misses to an invalid sector of a resident block (sectored caches only)", "count", 2},
+            {"SectorWritebacks",  "Number of dirty sectors written back on eviction (sectored caches only)", "count", 2},
+            {"SectorsEvicted",  "Number of valid sectors in each evicted block (sectored caches only)", "sectors", 2},
             )
 
 #define MEMCACHE_ELI_SUBCOMPONENTSLOTS {"backend", "Memory controller and/or memory timing model.", "SST::MemHierarchy::MemBackend"},\
@@ -94,10 +101,11 @@ protected:
      *  HIT_TAG: The lookup will be a hit but we need to check the tag first (needed for a write)
      *  MISS: The lookup will be a miss; the current access is to check the tag
      *  MISS_WB: The lookup will be a miss and require a writeback; the current access is to check the tag
+     *  MISS_SECTOR: The block is present but the sector is not, only the sector is fetched; the current access is to check the tag
      *  STALL: Another access for the same line is outstanding, stall until it finishes -> may not actually be how MCDRAM works...
      *  DATA: Sent a request for data to the remote memroy
      */
-    enum class AccessStatus { HIT, HIT_TAG, MISS, MISS_WB, DATA, STALL, FIN };
+    enum class AccessStatus { HIT, HIT_TAG, MISS, MISS_WB, MISS_SECTOR, DATA, STALL, FIN };
 
     struct MemAccessRecord {
         MemEvent* event;
@@ -115,12 +123,19 @@ protected:
     struct CacheState {
         Addr addr;
         State state;
-        CacheState(Addr a, State s) : addr(a), state(s) { }
+        uint64_t valid; // One bit per sector
+        uint64_t dirty; // One bit per sector
+        CacheState(Addr a, State s) : addr(a), state(s), valid(0), dirty(0) { }
     };
 
     std::vector<CacheState> cache_;
     Addr lineSize_;
     Addr lineOffset_;
+    unsigned int sectors_;  // Lines per tag, 1 if the cache is not sectored
+    Addr blockSize_;        // lineSize_ * sectors_
+
+    Addr toBlockAddr(Addr addr) { return sectors_ > 1 ? addr & ~(blockSize_ - 1) : addr; }
+    unsigned int toSector(Addr addr) { return (addr >> lineOffset_) & (sectors_ - 1); }
 
     void notifyListeners( MemEvent* ev ) {
         if (  ! listeners_.empty()) {
@@ -145,6 +160,12 @@ protected:
     void handleDataResponse(MemEvent* ev);
     void retry(Addr cacheIndex);
 
+    /* Warm-start snapshots */
+    void snapshot();
+    void restore();
+    SnapshotMode snapshotMode_;
+    std::string snapshotFile_;
+
     void sendResponse(MemEvent* ev, uint32_t flags);
 
     Output out;
@@ -173,6 +194,7 @@ protected:
 
     MemRegion region_; // Which address region we are, for translating to local addresses
     Addr toLocalAddr(Addr addr);
+    Addr toCacheLine(Addr addr);
 
     Clock::Handler<MemCacheController>* clockHandler_;
     TimeConverter* clockTimeBase_;
@@ -187,6 +209,9 @@ protected:
     Statistic<uint64_t>* statReadMiss;
     Statistic<uint64_t>* statWriteHit;
     Statistic<uint64_t>* statWriteMiss;
+    Statistic<uint64_t>* statSectorMiss;
+    Statistic<uint64_t>* statSectorWriteback;
+    Statistic<uint64_t>* statSectorsEvicted;
 
 private:
     void handleCustomEvent(MemEventBase* ev);
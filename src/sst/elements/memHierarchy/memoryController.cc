@@ -350,6 +350,27 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id),
                     std::bind(static_cast<void(MemController::*)(Addr,std::vector<uint8_t>*)>(&MemController::writeData), this, _1, _2));
         }
     }
+
+    /* Compression */
+    compressedBytes_ = 0;
+    uncompressedBytes_ = 0;
+    decompressLink_ = nullptr;
+    compressor_ = loadUserSubComponent<Compressor>("compressor");
+    if (!compressor_) {
+        std::string algorithm = params.find<std::string>("compression", "none");
+        to_lower(algorithm);
+        if (algorithm == "bdi" || algorithm == "fpc" || algorithm == "zero") {
+            Params cparams;
+            compressor_ = loadAnonymousSubComponent<Compressor>("memHierarchy.compression." + algorithm, "compressor", 0, ComponentInfo::INSERT_STATS, cparams);
+        } else if (algorithm != "none") {
+            out.fatal(CALL_INFO, -1, "%s, Invalid param: compression - supported algorithms are 'none', 'bdi', 'fpc', and 'zero'. You specified '%s'.\n", getName().c_str(), algorithm.c_str());
+        }
+    }
+    if (compressor_) {
+        if (!backing_)
+            out.output("%s, ** WARNING ** Compression is enabled without a backing store. All lines read from memory are zero, so compressed sizes will not be representative.\n", getName().c_str());
+        decompressLink_ = configureSelfLink("DecompressLink", clockTimeBase_, new Event::Handler<MemController>(this, &MemController::handleDecompressed));
+    }
 }
 
 void MemController::handleEvent(SST::Event* event) {
@@ -545,6 +566,9 @@ void MemController::handleMemResponse( Event::id_type id, uint32_t flags ) {
     if (backing_ && (ev->getCmd() == Command::PutM || (ev->getCmd() == Command::Write)))
         writeData(ev);
 
+    if (compressor_ && ev->getCmd() == Command::PutM && !noncacheable)
+        recordCompressedWrite(ev);
+
     if (ev->queryFlag(MemEvent::F_NORESPONSE)) {
         delete ev;
         return;
@@ -570,10 +594,43 @@ void MemController::handleMemResponse( Event::id_type id, uint32_t flags ) {
                 getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), resp->getVerboseString(dlevel).c_str());
     }
 
-    link_->send( resp );
+    /* Compressed lines are decompressed before they are returned. Lines that were never written back are stored uncompressed */
+    uint64_t latency = 0;
+    if (compressor_ && (resp->getCmd() == Command::GetSResp || resp->getCmd() == Command::GetXResp) && !noncacheable) {
+        uint32_t lineSize = resp->getPayload().size();
+        auto size = compressedSizes_.find(ev->getBaseAddr());
+        latency = compressor_->decompress(size != compressedSizes_.end() ? size->second : lineSize, lineSize);
+    }
+
+    if (latency)
+        decompressLink_->send(latency, resp);
+    else
+        link_->send( resp );
     delete ev;
 }
 
+void MemController::handleDecompressed(SST::Event* ev) {
+    link_->send(static_cast<MemEventBase*>(ev));
+}
+
+/* Track the compressed size of each line written back and sample how much uncompressed data the memory could hold */
+void MemController::recordCompressedWrite(MemEvent* ev) {
+    uint32_t size = compressor_->compress(ev->getPayload());
+    auto it = compressedSizes_.find(ev->getBaseAddr());
+    if (it != compressedSizes_.end()) {
+        compressedBytes_ -= it->second;
+        uncompressedBytes_ -= ev->getPayload().size();
+        it->second = size;
+    } else {
+        compressedSizes_.insert(std::make_pair(ev->getBaseAddr(), size));
+    }
+    compressedBytes_ += size;
+    uncompressedBytes_ += ev->getPayload().size();
+
+    if (compressedBytes_ != 0)
+        compressor_->recordEffectiveCapacity((uint64_t)((double)memSize_ * uncompressedBytes_ / compressedBytes_));
+}
+
 void MemController::init(unsigned int phase) {
     link_->init(phase);
 
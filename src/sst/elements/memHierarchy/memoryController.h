@@ -16,6 +16,8 @@
 #ifndef MEMHIERARCHY_MEMORYCONTROLLER_H
 #define MEMHIERARCHY_MEMORYCONTROLLER_H
 
+#include <unordered_map>
+
 #include <sst/core/sst_types.h>
 
 #include <sst/core/component.h>
@@ -26,6 +28,7 @@
 #include "sst/elements/memHierarchy/memLinkBase.h"
 #include "sst/elements/memHierarchy/membackend/backing.h"
 #include "sst/elements/memHierarchy/customcmd/customCmdMemory.h"
+#include "sst/elements/memHierarchy/compression.h"
 
 namespace SST {
 namespace MemHierarchy {
@@ -57,7 +60,8 @@ public:
             {"addr_range_end",      "(uint) Highest address handled by this memory.", "uint64_t-1"},\
             {"interleave_size",     "(string) Size of interleaved chunks. E.g., to interleave 8B chunks among 3 memories, set size=8B, step=24B", "0B"},\
             {"interleave_step",     "(string) Distance between interleaved chunks. E.g., to interleave 8B chunks among 3 memories, set size=8B, step=24B", "0B"},\
-            {"customCmdMemHandler", "(string) Name of the custom command handler to load", ""}
+            {"customCmdMemHandler", "(string) Name of the custom command handler to load", ""},\
+            {"compression",         "(string) Model compressed memory with a built-in algorithm: 'none', 'bdi', 'fpc' or 'zero'. Reads of compressed lines pay the decompression latency. Alternatively, put a compressor in the 'compressor' slot. Requires a backing store.", "none"}
 
     SST_ELI_DOCUMENT_PARAMS( MEMCONTROLLER_ELI_PARAMS )
 
@@ -74,7 +78,8 @@ public:
 #define MEMCONTROLLER_ELI_SUBCOMPONENTSLOTS {"backend", "Backend memory model to use for timing. Defaults to simpleMem", "SST::MemHierarchy::MemBackend"},\
             {"customCmdHandler", "Optional handler for custom command types", "SST::MemHierarchy::CustomCmdMemHandler"}, \
             {"listener", "Optional listeners to gather statistics, create traces, etc. Multiple listeners supported.", "SST::MemHierarchy::CacheListener"}, \
-            {"cpulink", "CPU-side link manager (e.g., to caches/cpu). Defaults to MemLink.", "SST::MemHierarchy::MemLinkBase"}
+            {"cpulink", "CPU-side link manager (e.g., to caches/cpu). Defaults to MemLink.", "SST::MemHierarchy::MemLinkBase"}, \
+            {"compressor", "Optional compression algorithm, overrides the 'compression' parameter", "SST::MemHierarchy::Compressor"}
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS( MEMCONTROLLER_ELI_SUBCOMPONENTSLOTS )
 
@@ -157,6 +162,16 @@ protected:
 
     CustomCmdMemHandler * customCommandHandler_;
 
+    /* Compression - sizes of the lines written back, for the read latency and to estimate the effective capacity */
+    Compressor* compressor_;
+    Link* decompressLink_;      // Delays read responses by the decompression latency
+    std::unordered_map<Addr, uint32_t> compressedSizes_;
+    uint64_t compressedBytes_;
+    uint64_t uncompressedBytes_;
+
+    void recordCompressedWrite(MemEvent* ev);
+    void handleDecompressed(SST::Event* ev);
+
     /* Debug -triggered by output.fatal() and/or SIGUSR2 */
     virtual void printStatus(Output &out);
     virtual void emergencyShutdown();
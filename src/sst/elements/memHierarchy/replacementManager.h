@@ -20,6 +20,7 @@
 #include "sst/core/rng/marsaglia.h"
 
 #include "memEvent.h"
+#include "snapshot.h"
 
 using namespace std;
 
@@ -77,9 +78,13 @@ class ReplacementPolicy : public SubComponent{
         virtual void update(uint64_t id, ReplacementInfo * rInfo) = 0;
         virtual void replaced(uint64_t id) = 0;
 
-        // Get replacement candidates
+        // Get replacement candidates. rInfo is usually a whole set but may be a subset of one, e.g., the valid lines of a compressed set
         virtual uint64_t getBestCandidate() = 0;
         virtual uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) = 0;
+
+        // Warm-start snapshots. Random number generators are not saved, they restart from their seeds
+        virtual void snapshot(SnapshotWriter &out) { }
+        virtual void restore(SnapshotReader &in) { }
 };
 
 /* ------------------------------------------------------------------------------------------
@@ -135,6 +140,20 @@ public:
 
     uint64_t getBestCandidate() { return bestCandidate; }
 
+    void snapshot(SnapshotWriter &out) {
+        out.putString("lru");
+        out.put(timestamp);
+        for (uint64_t i = 0; i < array.size(); i++)
+            out.put(array[i]);
+    }
+
+    void restore(SnapshotReader &in) {
+        in.expect("replacement_policy", "lru");
+        timestamp = in.get();
+        for (uint64_t i = 0; i < array.size(); i++)
+            array[i] = in.get();
+    }
+
 private:
     uint64_t timestamp;
     uint64_t bestCandidate;
@@ -207,6 +226,20 @@ public:
 
     uint64_t getBestCandidate() { return bestCandidate; }
 
+    void snapshot(SnapshotWriter &out) {
+        out.putString("lru-opt");
+        out.put(timestamp);
+        for (uint64_t i = 0; i < array.size(); i++)
+            out.put(array[i]);
+    }
+
+    void restore(SnapshotReader &in) {
+        in.expect("replacement_policy", "lru-opt");
+        timestamp = in.get();
+        for (uint64_t i = 0; i < array.size(); i++)
+            array[i] = in.get();
+    }
+
 private:
     uint64_t timestamp;
     uint64_t bestCandidate;
@@ -288,6 +321,24 @@ public:
 
     uint64_t getBestCandidate() { return bestCandidate; }
 
+    void snapshot(SnapshotWriter &out) {
+        out.putString("lfu");
+        out.put(timestamp);
+        for (uint64_t i = 0; i < array.size(); i++) {
+            out.put(array[i].ts);
+            out.put(array[i].acc);
+        }
+    }
+
+    void restore(SnapshotReader &in) {
+        in.expect("replacement_policy", "lfu");
+        timestamp = in.get();
+        for (uint64_t i = 0; i < array.size(); i++) {
+            array[i].ts = in.get();
+            array[i].acc = in.get();
+        }
+    }
+
     //void replaced(uint64_t id) { array[id].acc = 0; }
     void replaced(uint64_t id) { array[id].acc = 0; }
 private:
@@ -371,6 +422,24 @@ public:
 
     uint64_t getBestCandidate() { return bestCandidate; }
 
+    void snapshot(SnapshotWriter &out) {
+        out.putString("lfu-opt");
+        out.put(timestamp);
+        for (uint64_t i = 0; i < array.size(); i++) {
+            out.put(array[i].ts);
+            out.put(array[i].acc);
+        }
+    }
+
+    void restore(SnapshotReader &in) {
+        in.expect("replacement_policy", "lfu-opt");
+        timestamp = in.get();
+        for (uint64_t i = 0; i < array.size(); i++) {
+            array[i].ts = in.get();
+            array[i].acc = in.get();
+        }
+    }
+
     //void replaced(uint64_t id) { array[id].acc = 0; }
     void replaced(uint64_t id) { array[id].acc = 0; }
 private:
@@ -493,6 +562,20 @@ public:
 
     uint64_t getBestCandidate() { return bestCandidate;}
 
+    void snapshot(SnapshotWriter &out) {
+        out.putString("mru");
+        out.put(timestamp);
+        for (uint64_t i = 0; i < array.size(); i++)
+            out.put(array[i]);
+    }
+
+    void restore(SnapshotReader &in) {
+        in.expect("replacement_policy", "mru");
+        timestamp = in.get();
+        for (uint64_t i = 0; i < array.size(); i++)
+            array[i] = in.get();
+    }
+
 };
 
 
@@ -581,6 +664,20 @@ public:
 
     uint64_t getBestCandidate() { return bestCandidate; }
 
+    void snapshot(SnapshotWriter &out) {
+        out.putString("mru-opt");
+        out.put(timestamp);
+        for (uint64_t i = 0; i < array.size(); i++)
+            out.put(array[i]);
+    }
+
+    void restore(SnapshotReader &in) {
+        in.expect("replacement_policy", "mru-opt");
+        timestamp = in.get();
+        for (uint64_t i = 0; i < array.size(); i++)
+            array[i] = in.get();
+    }
+
 };
 
 
@@ -627,12 +724,15 @@ public:
                 return bestCandidate;
             }
         }
-        bestCandidate = rInfo[(gen->generateNextUInt64() % ways)]->getIndex();
+        bestCandidate = rInfo[(gen->generateNextUInt64() % rInfo.size())]->getIndex();
         return bestCandidate;
     }
 
     uint64_t getBestCandidate() { return bestCandidate; }
 
+    void snapshot(SnapshotWriter &out) { out.putString("random"); }
+    void restore(SnapshotReader &in) { in.expect("replacement_policy", "random"); }
+
 private:
     uint64_t bestCandidate;
     uint64_t ways;
@@ -685,12 +785,28 @@ public:
 
     // Return an empty slot if one exists, otherwise return any slot that is not the most-recently used in the set
     uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) {
-        for (uint64_t i = 0; i < ways; i++) {
+        for (uint64_t i = 0; i < rInfo.size(); i++) {
             if (rInfo[i]->getState() == I) {
                 bestCandidate = rInfo[i]->getIndex();
                 return bestCandidate;
             }
         }
+
+        // Subset of a set: pick among the candidates that are not the most recently used
+        if (rInfo.size() != ways) {
+            uint64_t mru = (rInfo[0]->getIndex() / ways) * ways + array[rInfo[0]->getIndex() / ways];
+            std::vector<uint64_t> candidates;
+            for (uint64_t i = 0; i < rInfo.size(); i++) {
+                if (rInfo[i]->getIndex() != mru)
+                    candidates.push_back(rInfo[i]->getIndex());
+            }
+            if (candidates.empty())
+                bestCandidate = mru;
+            else
+                bestCandidate = candidates[gen->generateNextUInt64() % candidates.size()];
+            return bestCandidate;
+        }
+
         uint64_t setBegin = rInfo[0]->getIndex();
         uint64_t index = gen->generateNextUInt64() % (ways-1);
         if (index < array[setBegin/ways])
@@ -702,6 +818,18 @@ public:
     }
 
     uint64_t getBestCandidate() { return bestCandidate; }
+
+    void snapshot(SnapshotWriter &out) {
+        out.putString("nmru");
+        for (uint64_t i = 0; i < array.size(); i++)
+            out.put(array[i]);
+    }
+
+    void restore(SnapshotReader &in) {
+        in.expect("replacement_policy", "nmru");
+        for (uint64_t i = 0; i < array.size(); i++)
+            array[i] = in.get();
+    }
 };
 
 
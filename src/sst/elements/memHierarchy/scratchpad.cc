@@ -416,17 +416,17 @@ void Scratchpad::processIncomingRemoteEvent(SST::Event * event) {
                 getCurrentSimCycle(), timestamp_, getName().c_str(), ev->getVerboseString(dlevel).c_str());
 
     // Determine what kind of event spawned this and pass off to handler
-    std::map<SST::Event::id_type,SST::Event::id_type>::iterator it = responseIDMap_.find(ev->getResponseToID());
+    auto it = responseIDMap_.find(ev->getResponseToID());
 
     if (it == responseIDMap_.end()) {
         dbg.fatal(CALL_INFO, -1, "(%s) Received data response from remote but no matching request in responseIDMap_, id is (%" PRIu64 ", %" PRIu32 "), timestamp is %" PRIu64 "\n",
                 getName().c_str(), ev->getResponseToID().first, ev->getResponseToID().second, timestamp_);
     }
 
-    SST::Event::id_type requestID = it->second;
+    SST::Event::id_type requestID = it->second.requestID;
     responseIDMap_.erase(it);
 
-    MemEventBase * requestBase = outstandingEventList_.find(requestID)->second.request;
+    MemEventBase * requestBase = getOutstanding(requestID)->request;
 
     if (requestBase->getCmd() == Command::Get) handleRemoteGetResponse(ev, requestID);
     else handleRemoteReadResponse(ev, requestID);
@@ -537,21 +537,21 @@ void Scratchpad::handleScratchRead(MemEvent * ev) {
     MemEvent * read = new MemEvent(getName(), ev->getAddr(), ev->getBaseAddr(), Command::GetS, ev->getSize());
     read->copyMetadata(ev);
 
-    responseIDMap_.insert(std::make_pair(read->getID(),ev->getID()));
-    responseIDAddrMap_.insert(std::make_pair(read->getID(),ev->getBaseAddr()));
-    outstandingEventList_.insert(std::make_pair(ev->getID(),OutstandingEvent(ev,response)));
+    responseIDMap_.emplace(read->getID(), ResponseInfo(ev->getID(), ev->getBaseAddr()));
+    createOutstanding(ev, response);
 
-    if (mshr_.find(ev->getBaseAddr()) == mshr_.end()) {
+    std::unordered_map<Addr,std::list<MSHREntry> >::iterator mshrIt = mshr_.find(ev->getBaseAddr());
+    if (mshrIt == mshr_.end()) {
         std::vector<uint8_t> data = doScratchRead(read);
         response->setPayload(data);
-        mshr_.insert(std::make_pair(ev->getBaseAddr(), std::list<MSHREntry>(1,MSHREntry(ev->getID(), Command::GetS, true, false))));
+        mshr_[ev->getBaseAddr()].push_back(MSHREntry(ev->getID(), Command::GetS, true, false));
         if (caching_ && !ev->queryFlag(MemEvent::F_NONCACHEABLE)) {
             cacheStatus_.at(ev->getBaseAddr()/scratchLineSize_) = true;
         }
         if (is_debug_addr(addr))
             eventDI.action = "ScrRead";
     } else {
-        mshr_.find(ev->getBaseAddr())->second.push_back(MSHREntry(ev->getID(), Command::GetS, read));
+        mshrIt->second.push_back(MSHREntry(ev->getID(), Command::GetS, read));
         if (is_debug_addr(addr)) {
             eventDI.action = "stall";
             eventDI.reason = "MSHR conflict";
@@ -589,11 +589,12 @@ void Scratchpad::handleScratchWrite(MemEvent * ev) {
     /* Check for writeback/invalidation races */
     if (!directory_ && ev->isWriteback() && mshr_.find(ev->getBaseAddr()) != mshr_.end()) {
         MSHREntry * entry = &(mshr_.find(ev->getBaseAddr())->second.front());
-        if (outstandingEventList_.find(entry->id)->second.request->getCmd() == Command::Get) {
+        Command entryCmd = getOutstanding(entry->id)->request->getCmd();
+        if (entryCmd == Command::Get) {
             handleAckInv(ev);
             return;
             // TODO handle corner cases where Get only writes partial line
-        } else if (outstandingEventList_.find(entry->id)->second.request->getCmd() == Command::Put) {
+        } else if (entryCmd == Command::Put) {
             if (ev->getPayload().empty()) {
                 handleAckInv(ev);
             } else {
@@ -604,7 +605,7 @@ void Scratchpad::handleScratchWrite(MemEvent * ev) {
     } else if (directory_ && ev->isWriteback() && mshr_.find(ev->getBaseAddr()) != mshr_.end()) {
         /* Drop writeback if we're stalled waiting for a ForceInv response */
         MSHREntry * entry = &(mshr_.find(ev->getBaseAddr())->second.front());
-        if (outstandingEventList_.find(entry->id)->second.request->getCmd() == Command::Get) {
+        if (getOutstanding(entry->id)->request->getCmd() == Command::Get) {
             MemEvent * response = ev->makeResponse();
             sendResponse(response);
             delete ev;
@@ -644,7 +645,7 @@ void Scratchpad::handleScratchWrite(MemEvent * ev) {
                     sendResponse(response); /* Send response when request is sent to scratch, since scratch doesn't respond */
                     delete ev;
                 } else {
-                    outstandingEventList_.insert(std::make_pair(ev->getID(),OutstandingEvent(ev,response)));
+                    createOutstanding(ev, response);
                     it = entry->insert(it, MSHREntry(ev->getID(), Command::GetX, write));
 
                     if (is_debug_event(ev))
@@ -665,7 +666,7 @@ void Scratchpad::handleScratchWrite(MemEvent * ev) {
             cacheStatus_.at(ev->getBaseAddr()/scratchLineSize_) = directory_;
         }
     } else {
-        outstandingEventList_.insert(std::make_pair(ev->getID(),OutstandingEvent(ev,response)));
+        createOutstanding(ev, response);
         mshr_.find(ev->getBaseAddr())->second.push_back(MSHREntry(ev->getID(), Command::GetX, write));
 
         if (is_debug_event(ev))
@@ -697,7 +698,8 @@ void Scratchpad::handleScratchGet(MemEventBase * event) {
     stat_ScratchGetReceived->addData(1);
 
     MoveEvent * response = ev->makeResponse();
-    outstandingEventList_.insert(std::make_pair(ev->getID(),OutstandingEvent(ev,response)));
+    OutstandingEvent * outstanding = createOutstanding(ev, response);
+    outstanding->firstLine = daddr;
 
     // Issue remote read
     ev->setSrcBaseAddr((ev->getSrcAddr() - remoteAddrOffset_) & ~(remoteLineSize_ - 1));
@@ -706,7 +708,7 @@ void Scratchpad::handleScratchGet(MemEventBase * event) {
     remoteRead->setFlag(MemEvent::F_NONCACHEABLE);
     remoteRead->setVirtualAddress(ev->getSrcVirtualAddress());
     remoteRead->setInstructionPointer(ev->getInstructionPointer());
-    responseIDMap_.insert(std::make_pair(remoteRead->getID(), ev->getID()));
+    responseIDMap_.emplace(remoteRead->getID(), ResponseInfo(ev->getID()));
 
     if (is_debug_event(remoteRead)) {
         dbg.debug(_L10_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Get           0x%-16" PRIx64 " 0x%-16" PRIx64 " Remote Read (<%" PRIu64 ", %" PRIu32 ">, 0x%" PRIx64 ")\n",
@@ -718,21 +720,24 @@ void Scratchpad::handleScratchGet(MemEventBase * event) {
     // Insert into mshr and send inv if needed
     // start base addr -> end base addr
     // start base addr + size
+    // The whole move is tracked as one outstanding event with a bit per line
     uint32_t lineCount = 1 + (ev->getDstAddr() + ev->getSize() - ev->getDstBaseAddr() - 1)/ scratchLineSize_;
+    outstanding->lineMask.reserve((lineCount + 63) / 64);
     for (uint32_t i = 0; i < lineCount; i++) {
         Addr baseAddr = ev->getDstBaseAddr() + i*scratchLineSize_;
-        if (mshr_.find(baseAddr) == mshr_.end()) {
+        outstanding->setLine(i);
+
+        std::list<MSHREntry>& entries = mshr_[baseAddr];
+        if (entries.empty()) {
             bool needAck = startGet(baseAddr, ev);
-            mshr_.insert(std::make_pair(baseAddr, std::list<MSHREntry>(1, MSHREntry(ev->getID(), Command::Get, true, needAck))));
+            entries.push_back(MSHREntry(ev->getID(), Command::Get, true, needAck));
         } else {
-            mshr_.find(baseAddr)->second.push_back(MSHREntry(ev->getID(), Command::Get, true));
+            entries.push_back(MSHREntry(ev->getID(), Command::Get, true));
         }
 
         if (is_debug_addr(baseAddr))
             dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:InsEv    0x%-16" PRIx64 " %s\n",
-                    getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.find(baseAddr)->second.back().getString().c_str());
-
-        outstandingEventList_.find(ev->getID())->second.incrementCount();
+                    getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, entries.back().getString().c_str());
     }
 }
 
@@ -763,32 +768,32 @@ void Scratchpad::handleScratchPut(MemEventBase * event) {
     remoteWrite->setFlag(MemEvent::F_NONCACHEABLE);
     remoteWrite->setFlag(MemEvent::F_NORESPONSE);
 
-    outstandingEventList_.insert(std::make_pair(ev->getID(), OutstandingEvent(ev, response, remoteWrite)));
+    OutstandingEvent * outstanding = createOutstanding(ev, response, remoteWrite);
+    outstanding->firstLine = ev->getSrcBaseAddr();
 
-    Addr addr = ev->getSrcAddr();
-    Addr baseAddr = ev->getSrcBaseAddr();
-    uint32_t bytesLeft = ev->getSize();
-    while (bytesLeft != 0) {
-        uint32_t size = (baseAddr + scratchLineSize_) - addr;
-        if (size > bytesLeft) size = bytesLeft;
+    // Mark every line outstanding before starting any of them so that a line
+    // which completes immediately cannot finish the move early
+    uint32_t lineCount = 1 + (ev->getSrcAddr() + ev->getSize() - ev->getSrcBaseAddr() - 1) / scratchLineSize_;
+    outstanding->lineMask.reserve((lineCount + 63) / 64);
+    for (uint32_t i = 0; i < lineCount; i++)
+        outstanding->setLine(i);
 
-        if (mshr_.find(baseAddr) == mshr_.end()) {
+    Addr baseAddr = ev->getSrcBaseAddr();
+    for (uint32_t i = 0; i < lineCount; i++) {
+        std::list<MSHREntry>& entries = mshr_[baseAddr];
+        if (entries.empty()) {
             bool needAck = startPut(baseAddr, ev);
-            mshr_.insert(std::make_pair(baseAddr, std::list<MSHREntry>(1, MSHREntry(ev->getID(), Command::Put, !needAck, needAck))));
+            entries.push_back(MSHREntry(ev->getID(), Command::Put, !needAck, needAck));
         } else {
-            mshr_.find(baseAddr)->second.push_back(MSHREntry(ev->getID(), Command::Put));
+            entries.push_back(MSHREntry(ev->getID(), Command::Put));
         }
 
         if (is_debug_addr(baseAddr))
             dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:InsEv    0x%-16" PRIx64 " %s\n",
                     getCurrentSimCycle(), timestamp_, getName().c_str(),
-                    baseAddr, mshr_.find(baseAddr)->second.back().getString().c_str());
+                    baseAddr, entries.back().getString().c_str());
 
-        bytesLeft -= size;
         baseAddr += scratchLineSize_;
-        addr = baseAddr;
-
-        outstandingEventList_.find(ev->getID())->second.incrementCount();
     }
 }
 
@@ -801,18 +806,17 @@ void Scratchpad::handleScratchPut(MemEventBase * event) {
  *  All others (regular read responses): call finishRequest()
  */
 void Scratchpad::handleScratchResponse(SST::Event::id_type responseID) {
-    SST::Event::id_type requestID = responseIDMap_.find(responseID)->second;
-    responseIDMap_.erase(responseID);
-
-    Addr baseAddr = responseIDAddrMap_.find(responseID)->second;
-    responseIDAddrMap_.erase(responseID);
+    auto it = responseIDMap_.find(responseID);
+    SST::Event::id_type requestID = it->second.requestID;
+    Addr baseAddr = it->second.baseAddr;
+    responseIDMap_.erase(it);
 
     if (is_debug_addr(baseAddr))
         dbg.debug(_L5_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Scratch:Recv  0x%-16" PRIx64 " <%" PRIu64 ", %" PRIu32 ">\n",
                 getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, responseID.first, responseID.second);
 
-    if (outstandingEventList_.find(requestID)->second.request->getCmd() == Command::Put) {
-        updatePut(requestID);
+    if (getOutstanding(requestID)->request->getCmd() == Command::Put) {
+        updatePut(requestID, baseAddr);
     } else { // Anything else - GetS, GetX, etc.
         finishRequest(requestID);
     }
@@ -836,7 +840,8 @@ void Scratchpad::handleAckInv(MemEventBase * event) {
     /* Look up request in mshr */
     MSHREntry * entry = &(mshr_.find(baseAddr)->second.front());
     SST::Event::id_type requestID = entry->id;
-    MoveEvent * request = static_cast<MoveEvent*>(outstandingEventList_.find(requestID)->second.request);
+    OutstandingEvent * outstanding = getOutstanding(requestID);
+    MoveEvent * request = static_cast<MoveEvent*>(outstanding->request);
 
     /* Update cache status */
     if (is_debug_addr(baseAddr))
@@ -853,7 +858,7 @@ void Scratchpad::handleAckInv(MemEventBase * event) {
                     getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, entry->getString().c_str());
 
         if (!entry->needData) {
-            updateGet(entry->id);
+            updateGet(entry->id, baseAddr);
             updateMSHR(baseAddr);
         }
     } else if (entry->cmd == Command::Put) { // Command::Put
@@ -877,16 +882,12 @@ void Scratchpad::handleAckInv(MemEventBase * event) {
         read->MemEventBase::copyMetadata(request);
         read->setVirtualAddress(request->getSrcVirtualAddress());
         read->setInstructionPointer(request->getInstructionPointer());
-        responseIDMap_.insert(std::make_pair(read->getID(),requestID));
-        responseIDAddrMap_.insert(std::make_pair(read->getID(), baseAddr));
+        responseIDMap_.emplace(read->getID(), ResponseInfo(requestID, baseAddr));
 
         std::vector<uint8_t> data = doScratchRead(read);
-        std::vector<uint8_t> payload = outstandingEventList_.find(requestID)->second.remoteWrite->getPayload();
+        std::vector<uint8_t>& payload = outstanding->remoteWrite->getPayload();
         uint32_t offset = addr - request->getSrcAddr();
-        for (uint32_t i = 0; i < size; i++) {
-            payload[i+offset] = data[i];
-        }
-        outstandingEventList_.find(requestID)->second.remoteWrite->setPayload(payload);
+        std::copy(data.begin(), data.begin() + size, payload.begin() + offset);
     } else {
         dbg.fatal(CALL_INFO, -1, "%s, Error: unhandled case in handleAckInv. Time = %" PRIu64 ", Event = (%s).\n",
                 getName().c_str(), timestamp_, event->getVerboseString(dlevel).c_str());
@@ -911,7 +912,8 @@ void Scratchpad::handleFetchResp(MemEventBase * event) {
     /* Look up request in mshr */
     MSHREntry * entry = &(mshr_.find(baseAddr)->second.front());
     SST::Event::id_type requestID = entry->id;
-    MoveEvent * put = static_cast<MoveEvent*>(outstandingEventList_.find(requestID)->second.request);
+    OutstandingEvent * outstanding = getOutstanding(requestID);
+    MoveEvent * put = static_cast<MoveEvent*>(outstanding->request);
 
     /* Update cache status */
     cacheStatus_.at(baseAddr/scratchLineSize_) = false;
@@ -933,15 +935,12 @@ void Scratchpad::handleFetchResp(MemEventBase * event) {
     uint32_t size = deriveSize(addr, baseAddr, put->getSrcAddr(), put->getSize());
 
     // Update write payload
-    std::vector<uint8_t> payload = outstandingEventList_.find(requestID)->second.remoteWrite->getPayload();
+    std::vector<uint8_t>& payload = outstanding->remoteWrite->getPayload();
     uint32_t offset = addr - put->getSrcAddr();
-    for (uint32_t i = 0; i < size; i++) {
-        payload[i+offset] = response->getPayload()[i];
-    }
-    outstandingEventList_.find(requestID)->second.remoteWrite->setPayload(payload);
+    std::copy(response->getPayload().begin(), response->getPayload().begin() + size, payload.begin() + offset);
 
     // Clear this mshr entry
-    updatePut(requestID);
+    updatePut(requestID, baseAddr);
     updateMSHR(baseAddr);   // Delete mshr entry
     delete response;        // Delete response
 }
@@ -1001,8 +1000,8 @@ void Scratchpad::handleRemoteRead(MemEvent * event) {
     request->setFlag(MemEvent::F_NONCACHEABLE); // Use byte not line address
 
     MemEvent * response = event->makeResponse();
-    outstandingEventList_.insert(std::make_pair(event->getID(), OutstandingEvent(event, response)));
-    responseIDMap_.insert(std::make_pair(request->getID(), event->getID()));
+    createOutstanding(event, response);
+    responseIDMap_.emplace(request->getID(), ResponseInfo(event->getID()));
 
     memMsgQueue_.insert(std::make_pair(timestamp_, request));
 }
@@ -1040,53 +1039,55 @@ void Scratchpad::handleRemoteWrite(MemEvent * event) {
  */
 void Scratchpad::handleRemoteGetResponse(MemEvent * response, SST::Event::id_type requestID) {
 
-    MoveEvent * request = static_cast<MoveEvent*>(outstandingEventList_.find(requestID)->second.request);
+    MoveEvent * request = static_cast<MoveEvent*>(getOutstanding(requestID)->request);
 
     uint32_t bytesLeft = request->getSize();
     Addr addr = request->getDstAddr();
     Addr baseAddr = request->getDstBaseAddr();
-    uint32_t payloadOffset = 0;
+    std::vector<uint8_t>::iterator payloadIt = response->getPayload().begin();
 
     while (bytesLeft != 0) {
         // Create write
         uint32_t size = (baseAddr + scratchLineSize_) - addr;
         if (size > bytesLeft) size = bytesLeft;
-        std::vector<uint8_t> data((response->getPayload()).begin() + payloadOffset, (response->getPayload()).begin() + payloadOffset + size);
+        std::vector<uint8_t> data(payloadIt, payloadIt + size);
         MemEvent * write = new MemEvent(getName(), addr, baseAddr, Command::PutM, data);
         write->MemEventBase::copyMetadata(request);
         write->setVirtualAddress(request->getDstVirtualAddress());
         write->setInstructionPointer(request->getInstructionPointer());
         write->setFlag(MemEvent::F_NORESPONSE);
 
-        if (mshr_.find(baseAddr)->second.front().id == requestID) {
+        std::unordered_map<Addr,std::list<MSHREntry> >::iterator mshrIt = mshr_.find(baseAddr);
+        if (mshrIt == mshr_.end()) {
+            dbg.fatal(CALL_INFO, -1, "ERROR: remoteGetResponse but no matching entry in mshr for address 0x%" PRIx64 "\n", baseAddr);
+        }
+
+        if (mshrIt->second.front().id == requestID) {
             doScratchWrite(write);
-            mshr_.find(baseAddr)->second.front().needData = false;
+            mshrIt->second.front().needData = false;
 
             if (is_debug_addr(baseAddr))
                 dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Update   0x%-16" PRIx64 " %s\n",
-                        getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.find(baseAddr)->second.front().getString().c_str());
+                        getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshrIt->second.front().getString().c_str());
 
-            if (!mshr_.find(baseAddr)->second.front().needAck) {
-                updateGet(requestID);
+            if (!mshrIt->second.front().needAck) {
+                updateGet(requestID, baseAddr);
                 updateMSHR(baseAddr);
             }
         } else {
             // Find it
-            if (mshr_.find(baseAddr) == mshr_.end()) {
-                dbg.fatal(CALL_INFO, -1, "ERROR: remoteGetResponse but no matching entry in mshr for address 0x%" PRIx64 "\n", baseAddr);
-            }
-            for (std::list<MSHREntry>::iterator it = mshr_.find(baseAddr)->second.begin(); it != mshr_.find(baseAddr)->second.end(); it++) {
+            for (std::list<MSHREntry>::iterator it = mshrIt->second.begin(); it != mshrIt->second.end(); it++) {
                 if (it->id == requestID) {
                     it->scratch = write;
                     it->needData = false;
 
                     if (is_debug_addr(baseAddr))
                         dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Update   0x%-16" PRIx64 " %s\n",
-                                getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.find(baseAddr)->second.front().getString().c_str());
+                                getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshrIt->second.front().getString().c_str());
                 }
             }
         }
-        payloadOffset += size;
+        payloadIt += size;
         bytesLeft -= size;
         baseAddr += scratchLineSize_;
         addr += size;
@@ -1096,7 +1097,7 @@ void Scratchpad::handleRemoteGetResponse(MemEvent * response, SST::Event::id_typ
 
 void Scratchpad::handleRemoteReadResponse(MemEvent * response, SST::Event::id_type requestID) {
     // Update response with payload and finish request
-    MemEvent * fwdResponse = static_cast<MemEvent*>(outstandingEventList_.find(requestID)->second.response);
+    MemEvent * fwdResponse = static_cast<MemEvent*>(getOutstanding(requestID)->response);
     fwdResponse->setPayload(response->getPayload());
 
     finishRequest(requestID);
@@ -1106,43 +1107,46 @@ void Scratchpad::handleRemoteReadResponse(MemEvent * response, SST::Event::id_ty
 
 // Update MSHR
 void Scratchpad::updateMSHR(Addr baseAddr) {
+    std::unordered_map<Addr,std::list<MSHREntry> >::iterator mshrIt = mshr_.find(baseAddr);
+    std::list<MSHREntry>& entries = mshrIt->second;
+
     // Remove top event
-    mshr_.find(baseAddr)->second.pop_front();
+    entries.pop_front();
 
     // Start next event
-    while (!mshr_.find(baseAddr)->second.empty()) {
-        MSHREntry * entry = &(mshr_.find(baseAddr)->second.front());
+    while (!entries.empty()) {
+        MSHREntry * entry = &(entries.front());
 
         if (entry->cmd == Command::GetS) {
             std::vector<uint8_t> readData = doScratchRead(entry->scratch);
-            static_cast<MemEvent*>(outstandingEventList_.find(entry->id)->second.response)->setPayload(readData);
+            static_cast<MemEvent*>(getOutstanding(entry->id)->response)->setPayload(readData);
 
             if (is_debug_addr(baseAddr))
                 dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Update   0x%-16" PRIx64 " %s\n",
                         getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, entry->getString().c_str());
 
-            if (caching_ && (outstandingEventList_.find(entry->id)->second.request->queryFlag(MemEvent::F_NONCACHEABLE))) {
+            if (caching_ && (getOutstanding(entry->id)->request->queryFlag(MemEvent::F_NONCACHEABLE))) {
                 cacheStatus_.at(baseAddr/scratchLineSize_) = true;
             }
             break;
         } else if (entry->cmd == Command::GetX || entry->cmd == Command::Write) {
             doScratchWrite(entry->scratch);
             finishRequest(entry->id);
-            mshr_.find(baseAddr)->second.pop_front();
+            entries.pop_front();
 
             if (is_debug_addr(baseAddr))
                 dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Remove   0x%-16" PRIx64 "\n",
                         getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr);
 
         } else if (entry->cmd == Command::Get) {
-            entry->needAck = startGet(baseAddr, static_cast<MoveEvent*>(outstandingEventList_.find(entry->id)->second.request));
+            entry->needAck = startGet(baseAddr, static_cast<MoveEvent*>(getOutstanding(entry->id)->request));
             if (!entry->needData) {
                 doScratchWrite(entry->scratch);
                 entry->scratch = nullptr;
             }
             if (!entry->needAck && !entry->needData) {
-                updateGet(entry->id);
-                mshr_.find(baseAddr)->second.pop_front();
+                updateGet(entry->id, baseAddr);
+                entries.pop_front();
 
                 if (is_debug_addr(baseAddr))
                     dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Remove   0x%-16" PRIx64 "\n",
@@ -1155,7 +1159,7 @@ void Scratchpad::updateMSHR(Addr baseAddr) {
                 break; // Still waiting on something
             }
         } else if (entry->cmd == Command::Put) {
-            entry->needAck = startPut(baseAddr, static_cast<MoveEvent*>(outstandingEventList_.find(entry->id)->second.request));
+            entry->needAck = startPut(baseAddr, static_cast<MoveEvent*>(getOutstanding(entry->id)->request));
             entry->needData = !entry->needAck;
 
             if (is_debug_addr(baseAddr))
@@ -1169,7 +1173,7 @@ void Scratchpad::updateMSHR(Addr baseAddr) {
     }
 
     // Clear mshr entry if list is empty
-    if (mshr_.find(baseAddr)->second.empty()) {
+    if (entries.empty()) {
         mshr_.erase(baseAddr);
 
         if (is_debug_addr(baseAddr))
@@ -1255,56 +1259,89 @@ bool Scratchpad::startPut(Addr baseAddr, MoveEvent * put) {
         read->MemEventBase::copyMetadata(put);
         read->setVirtualAddress(put->getSrcVirtualAddress());
         read->setInstructionPointer(put->getInstructionPointer());
-        responseIDMap_.insert(std::make_pair(read->getID(), put->getID()));
-        responseIDAddrMap_.insert(std::make_pair(read->getID(), baseAddr));
+        responseIDMap_.emplace(read->getID(), ResponseInfo(put->getID(), baseAddr));
 
         std::vector<uint8_t> data = doScratchRead(read);
 
-        std::vector<uint8_t> payload = outstandingEventList_.find(put->getID())->second.remoteWrite->getPayload();
+        // Copy directly into the remote write's payload
+        std::vector<uint8_t>& payload = getOutstanding(put->getID())->remoteWrite->getPayload();
         uint32_t offset = addr - put->getSrcAddr();
-        for (uint32_t i = 0; i < size; i++) {
-            payload[i+offset] = data[i];
-        }
-        outstandingEventList_.find(put->getID())->second.remoteWrite->setPayload(payload);
+        std::copy(data.begin(), data.begin() + size, payload.begin() + offset);
         return false;
     }
 }
 
-void Scratchpad::updatePut(SST::Event::id_type putID) {
-    uint32_t count = outstandingEventList_.find(putID)->second.decrementCount();
-    if (count == 0) {
-        MoveEvent * put = static_cast<MoveEvent*>(outstandingEventList_.find(putID)->second.request);
+void Scratchpad::updatePut(SST::Event::id_type putID, Addr baseAddr) {
+    OutstandingEvent * outstanding = getOutstanding(putID);
+    if (!outstanding->clearLine((baseAddr - outstanding->firstLine) / scratchLineSize_)) {
+        dbg.fatal(CALL_INFO, -1, "%s, Error: Put line 0x%" PRIx64 " completed but was not outstanding. Time = %" PRIu64 "\n",
+                getName().c_str(), baseAddr, timestamp_);
+    }
+    if (outstanding->getCount() == 0) {
+        MoveEvent * put = static_cast<MoveEvent*>(outstanding->request);
         dbg.debug(_L10_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Put            0x%-16" PRIx64 " 0x%-16" PRIx64 " Scratch Done (<%" PRIu64 ", %" PRIu32 ">, 0x%" PRIx64 ")\n",
                 getCurrentSimCycle(), timestamp_, getName().c_str(),
                 put->getSrcBaseAddr(),
                 put->getDstBaseAddr(),
-                outstandingEventList_.find(putID)->second.remoteWrite->getID().first,
-                outstandingEventList_.find(putID)->second.remoteWrite->getID().second,
-                outstandingEventList_.find(putID)->second.remoteWrite->getBaseAddr());
-//        dbg.debug(_L5_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Finish        0x%-16" PRIx64 " <%" PRIu64 ", %" PRIu32 ">\n",
-//                getCurrentSimCycle(), timestamp_, getName().c_str(), outstandingEventList_.find(putID)->second.remoteWrite->getBaseAddr(), baseAddr, responseID.first, responseID.second);
-        memMsgQueue_.insert(std::make_pair(timestamp_, outstandingEventList_.find(putID)->second.remoteWrite));
-        sendResponse(outstandingEventList_.find(putID)->second.response);
-        delete outstandingEventList_.find(putID)->second.request;
-        outstandingEventList_.erase(putID);
+                outstanding->remoteWrite->getID().first,
+                outstanding->remoteWrite->getID().second,
+                outstanding->remoteWrite->getBaseAddr());
+        memMsgQueue_.insert(std::make_pair(timestamp_, outstanding->remoteWrite));
+        sendResponse(outstanding->response);
+        delete outstanding->request;
+        releaseOutstanding(putID);
     }
 
 }
 
-void Scratchpad::updateGet(SST::Event::id_type getID) {
-    uint32_t count = outstandingEventList_.find(getID)->second.decrementCount();
-    if (count == 0) {
-        sendResponse(outstandingEventList_.find(getID)->second.response);
-        delete outstandingEventList_.find(getID)->second.request;
-        outstandingEventList_.erase(getID);
+void Scratchpad::updateGet(SST::Event::id_type getID, Addr baseAddr) {
+    OutstandingEvent * outstanding = getOutstanding(getID);
+    if (!outstanding->clearLine((baseAddr - outstanding->firstLine) / scratchLineSize_)) {
+        dbg.fatal(CALL_INFO, -1, "%s, Error: Get line 0x%" PRIx64 " completed but was not outstanding. Time = %" PRIu64 "\n",
+                getName().c_str(), baseAddr, timestamp_);
+    }
+    if (outstanding->getCount() == 0) {
+        sendResponse(outstanding->response);
+        delete outstanding->request;
+        releaseOutstanding(getID);
     }
 }
 
 void Scratchpad::finishRequest(SST::Event::id_type requestID) {
-    if (outstandingEventList_.find(requestID)->second.response != nullptr)
-        sendResponse(outstandingEventList_.find(requestID)->second.response);
-    delete outstandingEventList_.find(requestID)->second.request;
-    outstandingEventList_.erase(requestID);
+    OutstandingEvent * outstanding = getOutstanding(requestID);
+    if (outstanding->response != nullptr)
+        sendResponse(outstanding->response);
+    delete outstanding->request;
+    releaseOutstanding(requestID);
+}
+
+/*
+ * Outstanding event tracking
+ * Entries are kept in a hash table keyed by request ID and
+ * recycled through a free pool, so bulk moves do not allocate
+ * tracking state (or a new line mask) per request.
+ */
+Scratchpad::OutstandingEvent* Scratchpad::createOutstanding(MemEventBase * request, MemEventBase * response, MemEvent * write) {
+    OutstandingEvent * outstanding;
+    if (outstandingPool_.empty()) {
+        outstanding = new OutstandingEvent();
+    } else {
+        outstanding = outstandingPool_.back();
+        outstandingPool_.pop_back();
+    }
+    outstanding->reset(request, response, write);
+    outstandingEventList_.emplace(request->getID(), outstanding);
+    return outstanding;
+}
+
+Scratchpad::OutstandingEvent* Scratchpad::getOutstanding(SST::Event::id_type id) {
+    return outstandingEventList_.find(id)->second;
+}
+
+void Scratchpad::releaseOutstanding(SST::Event::id_type id) {
+    std::unordered_map<SST::Event::id_type,OutstandingEvent*,EventIDHash>::iterator it = outstandingEventList_.find(id);
+    outstandingPool_.push_back(it->second);
+    outstandingEventList_.erase(it);
 }
 
 uint32_t Scratchpad::deriveSize(Addr addr, Addr baseAddr, Addr requestAddr, uint32_t requestSize) {
@@ -24,6 +24,7 @@
 #include <sst/core/output.h>
 #include <map>
 #include <list>
+#include <unordered_map>
 
 #include "sst/elements/memHierarchy/membackend/backing.h"
 #include "sst/elements/memHierarchy/moveEvent.h"
@@ -95,6 +96,10 @@ private:
     ~Scratchpad() {
         if (backing_)
             delete backing_;
+        for (auto it = outstandingEventList_.begin(); it != outstandingEventList_.end(); it++)
+            delete it->second;
+        for (auto it = outstandingPool_.begin(); it != outstandingPool_.end(); it++)
+            delete *it;
     }
 
     // Parameters - scratchpad
@@ -147,8 +152,8 @@ private:
     bool startGet(Addr baseAddr, MoveEvent * get);
     bool startPut(Addr baseAddr, MoveEvent * put);
 
-    void updateGet(SST::Event::id_type id);
-    void updatePut(SST::Event::id_type id);
+    void updateGet(SST::Event::id_type id, Addr baseAddr);
+    void updatePut(SST::Event::id_type id, Addr baseAddr);
     void finishRequest(SST::Event::id_type id);
 
     uint32_t deriveSize(Addr addr, Addr baseAddr, Addr requestAddr, uint32_t requestSize);
@@ -164,13 +169,37 @@ private:
             MemEvent * remoteWrite;     // For Put requests, collect scratch read responses here
             uint32_t count;             // Number of lines we are waiting on - when 0, the request is complete
                                         // i.e., for a read or write, just 1, for a get or put, the size/lineSize
-
-            OutstandingEvent(MemEventBase * request, MemEventBase * response) : request(request), response(response), remoteWrite(nullptr), count(0) { }
-            OutstandingEvent(MemEventBase * request, MemEventBase * response, MemEvent * write) : request(request), response(response), remoteWrite(write), count(0) { }
+            Addr firstLine;             // For Get/Put, base address of the first scratch line the move touches
+            std::vector<uint64_t> lineMask; // For Get/Put, one bit per scratch line, set while that line is outstanding
+
+            OutstandingEvent() : request(nullptr), response(nullptr), remoteWrite(nullptr), count(0), firstLine(0) { }
+
+            void reset(MemEventBase * req, MemEventBase * resp, MemEvent * write = nullptr) {
+                request = req;
+                response = resp;
+                remoteWrite = write;
+                count = 0;
+                firstLine = 0;
+                lineMask.clear(); // Keeps capacity so pooled entries do not reallocate
+            }
 
             uint32_t decrementCount() { count--; return count; }
             void incrementCount() { count++; }
             uint32_t getCount() { return count; }
+
+            // Bulk move tracking - mark a line outstanding / complete
+            void setLine(uint64_t index) {
+                if (lineMask.size() <= (index >> 6)) lineMask.resize((index >> 6) + 1, 0);
+                lineMask[index >> 6] |= (1ULL << (index & 63));
+                count++;
+            }
+            bool clearLine(uint64_t index) {
+                if (lineMask.size() <= (index >> 6) || !(lineMask[index >> 6] & (1ULL << (index & 63))))
+                    return false;
+                lineMask[index >> 6] &= ~(1ULL << (index & 63));
+                count--;
+                return true;
+            }
     };
     // MSHR entry
     // MSHR consists of a base address and queue of these
@@ -226,10 +255,22 @@ private:
         }
     } eventDI;
 
-    std::map<SST::Event::id_type,SST::Event::id_type> responseIDMap_;   // Map a forwarded request ID to a original request ID
-    std::map<SST::Event::id_type,Addr> responseIDAddrMap_;              // Map an outstanding scratch request ID to the request's baseAddr
-    std::map<SST::Event::id_type,OutstandingEvent> outstandingEventList_; // List of all outstanding events
-    std::map<Addr,std::list<MSHREntry> > mshr_; // MSHR for scratch accesses
+    // Forwarded request -> original request ID and, for scratch accesses, the request's baseAddr
+    struct ResponseInfo {
+        SST::Event::id_type requestID;
+        Addr baseAddr;
+        ResponseInfo(SST::Event::id_type id, Addr addr = 0) : requestID(id), baseAddr(addr) { }
+    };
+
+    // Outstanding event tracking
+    OutstandingEvent* createOutstanding(MemEventBase * request, MemEventBase * response, MemEvent * write = nullptr);
+    OutstandingEvent* getOutstanding(SST::Event::id_type id);
+    void releaseOutstanding(SST::Event::id_type id);
+
+    std::unordered_map<SST::Event::id_type,ResponseInfo,EventIDHash> responseIDMap_;           // Map a forwarded request ID to a original request ID
+    std::unordered_map<SST::Event::id_type,OutstandingEvent*,EventIDHash> outstandingEventList_; // List of all outstanding events
+    std::vector<OutstandingEvent*> outstandingPool_;    // Free outstanding entries, reused to avoid allocating per request
+    std::unordered_map<Addr,std::list<MSHREntry> > mshr_; // MSHR for scratch accesses
 
 
     // Outgoing message queues - map send timestamp to event
@@ -243,7 +284,7 @@ private:
     bool caching_;  // Whether or not caching is possible
     bool directory_; // Whether or not a directory is managing the caches - if so we cannot assume on a writeback that the data is not cached
     std::vector<bool> cacheStatus_; // One entry per scratchpad line, whether line may be cached
-    std::map<SST::Event::id_type, uint64_t> cacheCounters_; // Map of a Get or Put ID to the number of cache acks/data responses we are waiting for
+    std::unordered_map<SST::Event::id_type, uint64_t, EventIDHash> cacheCounters_; // Map of a Get or Put ID to the number of cache acks/data responses we are waiting for
 
     // Statistics
     Statistic<uint64_t>* stat_ScratchReadReceived;
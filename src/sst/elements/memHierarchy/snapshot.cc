@@ -0,0 +1,160 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "snapshot.h"
+
+using namespace SST::MemHierarchy;
+
+static const char SNAPSHOT_MAGIC[8] = { 'M', 'H', 'S', 'N', 'A', 'P', 0, 0 };
+static const uint64_t SNAPSHOT_VERSION = 2;
+
+SnapshotMode SST::MemHierarchy::getSnapshotMode(Params &params, Output* out, const std::string &name, std::string &fileName) {
+    std::string mode = params.find<std::string>("checkpoint", "");
+    if (mode.empty())
+        return SnapshotMode::NONE;
+
+    std::string dir = params.find<std::string>("checkpointDir", "");
+    if (dir.empty())
+        out->fatal(CALL_INFO, -1, "%s, Invalid param: checkpointDir - must be set when checkpoint is '%s'\n", name.c_str(), mode.c_str());
+    fileName = dir + "/" + name;
+
+    if (mode == "load")
+        return SnapshotMode::LOAD;
+    if (mode == "save")
+        return SnapshotMode::SAVE;
+    out->fatal(CALL_INFO, -1, "%s, Invalid param: checkpoint - must be 'save' or 'load'. You specified '%s'\n", name.c_str(), mode.c_str());
+    return SnapshotMode::NONE;
+}
+
+SnapshotWriter::SnapshotWriter(Output* out, std::string fileName, std::string kind) : out_(out), fileName_(fileName) {
+    buffer_.insert(buffer_.end(), SNAPSHOT_MAGIC, SNAPSHOT_MAGIC + sizeof(SNAPSHOT_MAGIC));
+    put(SNAPSHOT_VERSION);
+    putString(kind);
+}
+
+void SnapshotWriter::put(uint64_t value) {
+    while (value >= 0x80) {
+        buffer_.push_back((uint8_t) (value | 0x80));
+        value >>= 7;
+    }
+    buffer_.push_back((uint8_t) value);
+}
+
+void SnapshotWriter::putString(const std::string& str) {
+    put(str.size());
+    buffer_.insert(buffer_.end(), str.begin(), str.end());
+}
+
+void SnapshotWriter::putBytes(const std::vector<uint8_t>& data) {
+    put(data.size());
+    buffer_.insert(buffer_.end(), data.begin(), data.end());
+}
+
+void SnapshotWriter::close() {
+    FILE* fp = fopen(fileName_.c_str(), "wb");
+    if (fp == nullptr)
+        out_->fatal(CALL_INFO, -1, "Error: unable to open snapshot file '%s' for writing\n", fileName_.c_str());
+
+    if (fwrite(buffer_.data(), 1, buffer_.size(), fp) != buffer_.size())
+        out_->fatal(CALL_INFO, -1, "Error: failed writing snapshot file '%s'\n", fileName_.c_str());
+
+    fclose(fp);
+}
+
+SnapshotReader::SnapshotReader(Output* out, std::string fileName, std::string kind) : out_(out), fileName_(fileName), pos_(0) {
+    FILE* fp = fopen(fileName_.c_str(), "rb");
+    if (fp == nullptr)
+        out_->fatal(CALL_INFO, -1, "Error: unable to open snapshot file '%s'\n", fileName_.c_str());
+
+    uint8_t chunk[4096];
+    size_t count;
+    while ((count = fread(chunk, 1, sizeof(chunk), fp)) > 0)
+        buffer_.insert(buffer_.end(), chunk, chunk + count);
+    fclose(fp);
+
+    if (buffer_.size() < sizeof(SNAPSHOT_MAGIC) || memcmp(buffer_.data(), SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0)
+        out_->fatal(CALL_INFO, -1, "Error: '%s' is not a memHierarchy snapshot\n", fileName_.c_str());
+    pos_ = sizeof(SNAPSHOT_MAGIC);
+
+    uint64_t version = get();
+    if (version != SNAPSHOT_VERSION)
+        out_->fatal(CALL_INFO, -1, "Error: snapshot '%s' has version %" PRIu64 ", expected %" PRIu64 "\n",
+                fileName_.c_str(), version, SNAPSHOT_VERSION);
+
+    std::string savedKind = getString();
+    if (savedKind != kind)
+        out_->fatal(CALL_INFO, -1, "Error: snapshot '%s' was saved by a '%s' but is being restored into a '%s'\n",
+                fileName_.c_str(), savedKind.c_str(), kind.c_str());
+}
+
+uint64_t SnapshotReader::get() {
+    uint64_t value = 0;
+    int shift = 0;
+
+    while (pos_ < buffer_.size() && shift < 64) {
+        uint8_t b = buffer_[pos_++];
+        value |= ((uint64_t) (b & 0x7F)) << shift;
+        if (0 == (b & 0x80))
+            return value;
+        shift += 7;
+    }
+
+    out_->fatal(CALL_INFO, -1, "Error: snapshot '%s' is truncated or corrupt\n", fileName_.c_str());
+    return 0;
+}
+
+std::string SnapshotReader::getString() {
+    uint64_t size = get();
+    if (size > buffer_.size() - pos_)
+        out_->fatal(CALL_INFO, -1, "Error: snapshot '%s' is truncated or corrupt\n", fileName_.c_str());
+
+    std::string str((const char*) &buffer_[pos_], size);
+    pos_ += size;
+    return str;
+}
+
+void SnapshotReader::getBytes(std::vector<uint8_t>& data) {
+    uint64_t size = get();
+    if (size > buffer_.size() - pos_)
+        out_->fatal(CALL_INFO, -1, "Error: snapshot '%s' is truncated or corrupt\n", fileName_.c_str());
+
+    data.assign(buffer_.begin() + pos_, buffer_.begin() + pos_ + size);
+    pos_ += size;
+}
+
+void SnapshotReader::expect(const char* field, uint64_t configured) {
+    uint64_t saved = get();
+    if (saved != configured)
+        out_->fatal(CALL_INFO, -1, "Error: snapshot '%s' does not match this configuration: %s was %" PRIu64 " when saved but is %" PRIu64 " now\n",
+                fileName_.c_str(), field, saved, configured);
+}
+
+void SnapshotReader::expect(const char* field, const std::string& configured) {
+    std::string saved = getString();
+    if (saved != configured)
+        out_->fatal(CALL_INFO, -1, "Error: snapshot '%s' does not match this configuration: %s was '%s' when saved but is '%s' now\n",
+                fileName_.c_str(), field, saved.c_str(), configured.c_str());
+}
+
+void SnapshotReader::close() {
+    if (pos_ != buffer_.size())
+        out_->fatal(CALL_INFO, -1, "Error: snapshot '%s' has %zu unread bytes, it was not saved by this configuration\n",
+                fileName_.c_str(), buffer_.size() - pos_);
+}
@@ -0,0 +1,98 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_SNAPSHOT_H
+#define MEMHIERARCHY_SNAPSHOT_H
+
+#include <string>
+#include <vector>
+
+#include <sst/core/output.h>
+#include <sst/core/params.h>
+
+#include "sst/elements/memHierarchy/memTypes.h"
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Warm-start snapshots of tag arrays, coherence state and replacement state.
+ *
+ * A snapshot file starts with a magic number, a format version and the kind of
+ * structure that wrote it (e.g., the coherence manager type). The rest is a
+ * stream of LEB128 varints, length-prefixed strings and raw bytes; each
+ * structure writes its geometry first so that a restore can check it with
+ * expect() and stop on the first mismatch. Only stable states are saved, so a
+ * component must be quiescent when its snapshot is written.
+ */
+
+class SnapshotWriter {
+public:
+    SnapshotWriter(Output* out, std::string fileName, std::string kind);
+
+    void put(uint64_t value);
+    void putString(const std::string& str);
+    void putBytes(const std::vector<uint8_t>& data);
+
+    /* Write the snapshot to the file */
+    void close();
+
+    const std::string& getFileName() { return fileName_; }
+
+private:
+    Output* out_;
+    std::string fileName_;
+    std::vector<uint8_t> buffer_;
+};
+
+class SnapshotReader {
+public:
+    SnapshotReader(Output* out, std::string fileName, std::string kind);
+
+    uint64_t get();
+    std::string getString();
+    void getBytes(std::vector<uint8_t>& data);
+
+    /* Read a geometry field and fail if it does not match the configured value */
+    void expect(const char* field, uint64_t configured);
+    void expect(const char* field, const std::string& configured);
+
+    /* Fail if the snapshot has data left over, i.e., it was written by a different configuration */
+    void close();
+
+    const std::string& getFileName() { return fileName_; }
+
+private:
+    Output* out_;
+    std::string fileName_;
+    std::vector<uint8_t> buffer_;
+    size_t pos_;
+};
+
+/*
+ * The 'checkpoint' ('save' or 'load') and 'checkpointDir' parameters, as used by MemController.
+ * Each component's snapshot is the file checkpointDir/<component name>.
+ */
+enum class SnapshotMode { NONE, LOAD, SAVE };
+
+SnapshotMode getSnapshotMode(Params &params, Output* out, const std::string &name, std::string &fileName);
+
+/* States that may appear in a snapshot */
+inline bool isSnapshotState(State state) {
+    return state == I || state == S || state == E || state == O || state == M;
+}
+
+}}
+
+#endif // MEMHIERARCHY_SNAPSHOT_H
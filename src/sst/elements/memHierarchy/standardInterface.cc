@@ -21,6 +21,8 @@
 #include <sst/core/component.h>
 #include <sst/core/link.h>
 
+#include <algorithm>
+
 #include "sst/elements/memHierarchy/memEventBase.h"
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/moveEvent.h"
@@ -43,6 +45,7 @@ StandardInterface::StandardInterface(SST::ComponentId_t id, Params &params, Time
 
     rqstr_ = "";
     initDone_ = false;
+    hasNoncacheable_ = false;
 
     converter_ = new StandardInterface::MemEventConverter(this);
     converter_->output = debug;
@@ -85,6 +88,46 @@ StandardInterface::StandardInterface(SST::ComponentId_t id, Params &params, Time
         reg.end = noncache[i+1];
         noncacheableRegions.insert(std::make_pair(reg.start, reg));
     }
+    buildNoncacheableIndex();
+}
+
+void StandardInterface::addNoncacheableRegion(const MemRegion& reg) {
+    noncacheableRegions.insert(std::make_pair(reg.start, reg));
+    buildNoncacheableIndex();
+}
+
+/* Regions are only added during construction and init() so the index is rebuilt from scratch each time */
+void StandardInterface::buildNoncacheableIndex() {
+    noncacheableIntervals_.clear();
+    noncacheableInterleaved_.clear();
+
+    for (std::multimap<Addr, MemRegion>::iterator it = noncacheableRegions.begin(); it != noncacheableRegions.end(); it++) {
+        const MemRegion& reg = it->second;
+        if (reg.interleaveSize != 0) {
+            noncacheableInterleaved_.push_back(reg);
+        } else if (!noncacheableIntervals_.empty() && (noncacheableIntervals_.back().second == std::numeric_limits<Addr>::max() 
+                    || reg.start <= noncacheableIntervals_.back().second + 1)) {
+            /* Multimap is ordered by start so overlapping/adjacent regions merge with the previous interval */
+            noncacheableIntervals_.back().second = std::max(noncacheableIntervals_.back().second, reg.end);
+        } else {
+            noncacheableIntervals_.push_back(std::make_pair(reg.start, reg.end));
+        }
+    }
+    hasNoncacheable_ = !noncacheableRegions.empty();
+}
+
+bool StandardInterface::isNoncacheable(Addr addr) const {
+    /* Find last interval with start <= addr */
+    std::vector<std::pair<Addr,Addr>>::const_iterator it = std::upper_bound(noncacheableIntervals_.begin(), noncacheableIntervals_.end(), addr,
+            [](Addr a, const std::pair<Addr,Addr>& interval) { return a < interval.first; });
+    if (it != noncacheableIntervals_.begin() && addr <= (it - 1)->second)
+        return true;
+
+    for (std::vector<MemRegion>::const_iterator reg = noncacheableInterleaved_.begin(); reg != noncacheableInterleaved_.end(); reg++) {
+        if (reg->start > addr) break;
+        if (reg->contains(addr)) return true;
+    }
+    return false;
 }
 
 void StandardInterface::setMemoryMappedAddressRegion(Addr start, Addr size) {
@@ -137,7 +180,7 @@ void StandardInterface::init(unsigned int phase) {
                     std::vector<std::pair<MemRegion,bool>> regions = memEventE->getRegions();
                     for (auto it = regions.begin(); it != regions.end(); it++) {
                         if (!it->second) {
-                            noncacheableRegions.insert(std::make_pair(it->first.start, it->first));
+                            addNoncacheableRegion(it->first);
                         }
                     }
                 }
@@ -203,7 +246,7 @@ void StandardInterface::send(StandardMem::Request* req) {
 #endif
 
     if (req->needsResponse())
-        requests_[me->getID()] = std::make_pair(req,me->getCmd());   /* Save this request so we can use it when a response is returned */
+        requests_.insert(me->getID(), OutstandingRequest{req, me->getCmd()});   /* Save this request so we can use it when a response is returned */
     else
         delete req;
 #ifdef __SST_DEBUG_OUTPUT__
@@ -229,16 +272,15 @@ void StandardInterface::receive(SST::Event* ev) {
     /* Handle responses to requests we sent */
     if (isResponse) {
         MemEventBase::id_type origID = me->getResponseToID();
-        std::map<MemEventBase::id_type,std::pair<StandardMem::Request*,Command>>::iterator reqit = requests_.find(origID);
-        if (reqit == requests_.end()) {
+        OutstandingRequest orig;
+        if (!requests_.take(origID, orig)) {
             output.fatal(CALL_INFO, -1, "%s, Error: Received response but cannot locate matching request. Response: %s\n",
                 getName().c_str(), me->getVerboseString(dlevel).c_str());
         }
-        StandardMem::Request* origReq = reqit->second.first;
-        Command origCmd = reqit->second.second;
+        StandardMem::Request* origReq = orig.req;
+        Command origCmd = orig.cmd;
         if (origCmd == Command::GetS || origCmd == Command::GetSX)
             cmd = Command::GetSResp;
-        requests_.erase(reqit);
         response = me;
         switch (cmd) {
             case Command::GetSResp:
@@ -308,7 +350,7 @@ void StandardInterface::receive(SST::Event* ev) {
                     getName().c_str(), CommandString[(int)cmd], me->getVerboseString(dlevel).c_str());
         };
         if (deliverReq->needsResponse()) /* Endpoint will need to send a response to this */
-            responses_[deliverReq->getID()] = me;
+            responses_.insert(deliverReq->getID(), me);
         else 
             delete me;
     }
@@ -330,16 +372,10 @@ SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::Read* req
 
     if (req->getNoncacheable()) {
         noncacheable = true;
-    } else if (!((iface->noncacheableRegions).empty())) {
+    } else if (iface->hasNoncacheable_) {
         // Check if addr lies in noncacheable regions. 
         // For simplicity we are not dealing with the case where the address range splits a noncacheable + cacheable region
-        std::multimap<Addr, MemRegion>::iterator ep = (iface->noncacheableRegions).upper_bound(req->pAddr);
-        for (std::multimap<Addr, MemRegion>::iterator it = (iface->noncacheableRegions).begin(); it != ep; it++) {
-            if (it->second.contains(req->pAddr)) {
-                noncacheable = true;
-                break;
-            }
-        }
+        noncacheable = iface->isNoncacheable(req->pAddr);
     }
 
     Addr bAddr = (iface->lineSize_ == 0 || noncacheable) ? req->pAddr : req->pAddr & iface->baseAddrMask_; // Line address
@@ -364,16 +400,10 @@ SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::Write* re
     
     if (req->getNoncacheable()) {
         noncacheable = true;
-    } else if (!((iface->noncacheableRegions).empty())) {
+    } else if (iface->hasNoncacheable_) {
         // Check if addr lies in noncacheable regions. 
         // For simplicity we are not dealing with the case where the address range splits a noncacheable + cacheable region
-        std::multimap<Addr, MemRegion>::iterator ep = (iface->noncacheableRegions).upper_bound(req->pAddr);
-        for (std::multimap<Addr, MemRegion>::iterator it = (iface->noncacheableRegions).begin(); it != ep; it++) {
-            if (it->second.contains(req->pAddr)) {
-                noncacheable = true;
-                break;
-            }
-        }
+        noncacheable = iface->isNoncacheable(req->pAddr);
     }
     
     Addr bAddr = (iface->lineSize_ == 0 || noncacheable) ? req->pAddr : req->pAddr & iface->baseAddrMask_;
@@ -533,11 +563,10 @@ Event* StandardInterface::MemEventConverter::convert(StandardMem::CustomReq* req
 }
 
 SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::ReadResp* resp) { 
-    std::map<StandardMem::Request::id_t, MemEventBase*>::iterator it = iface->responses_.find(resp->getID());
-    if (it == iface->responses_.end())
+    MemEventBase* meb = nullptr;
+    if (!iface->responses_.take(resp->getID(), meb))
         iface->output.fatal(CALL_INFO, -1, "%s, Error: Handling a ReadResp but no matching Read found\n", iface->getName().c_str());
-    MemEvent* mereq = static_cast<MemEvent*>(it->second); // Matching memEvent req
-    iface->responses_.erase(it);
+    MemEvent* mereq = static_cast<MemEvent*>(meb); // Matching memEvent req
     MemEvent* meresp = mereq->makeResponse();
     meresp->setPayload(resp->data);
     if (!resp->getSuccess()) {
@@ -546,11 +575,10 @@ SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::ReadResp*
     return meresp;
 }
 SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::WriteResp* resp) {
-    std::map<StandardMem::Request::id_t, MemEventBase*>::iterator it = iface->responses_.find(resp->getID());
-    if (it == iface->responses_.end())
+    MemEventBase* meb = nullptr;
+    if (!iface->responses_.take(resp->getID(), meb))
         iface->output.fatal(CALL_INFO, -1, "%s, Error: Handling a WriteResp but no matching Write found\n", iface->getName().c_str());
-    MemEvent* mereq = static_cast<MemEvent*>(it->second); // Matching memEvent req
-    iface->responses_.erase(it);
+    MemEvent* mereq = static_cast<MemEvent*>(meb); // Matching memEvent req
     MemEvent* meresp = mereq->makeResponse();
     if (!resp->getSuccess()) {
         meresp->setFail();
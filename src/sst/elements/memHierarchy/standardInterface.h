@@ -22,6 +22,7 @@
 #include <utility>
 #include <map>
 #include <queue>
+#include <vector>
 
 #include <sst/core/sst_types.h>
 #include <sst/core/link.h>
@@ -29,6 +30,7 @@
 #include <sst/core/output.h>
 
 #include "sst/elements/memHierarchy/memLinkBase.h"
+#include "sst/elements/memHierarchy/idTable.h"
 
 namespace SST {
 
@@ -119,8 +121,23 @@ protected:
     Addr        baseAddrMask_;
     Addr        lineSize_;
     std::string rqstr_;
-    std::map<MemEventBase::id_type, std::pair<StandardMem::Request*,Command>> requests_;   /* Map requests sent by the endpoint */
-    std::map<StandardMem::Request::id_t, MemEventBase*> responses_;     /* Map requests received by the endpoint */
+
+    /* Request sent by the endpoint that is waiting for a response */
+    struct OutstandingRequest {
+        StandardMem::Request* req;
+        Command cmd;
+    };
+    struct RequestIDHash {
+        size_t operator()(StandardMem::Request::id_t id) const {
+            uint64_t key = id;
+            key ^= key >> 33;
+            key *= 0xff51afd7ed558ccdULL;
+            key ^= key >> 33;
+            return (size_t)key;
+        }
+    };
+    IDTable<MemEventBase::id_type, OutstandingRequest, EventIDHash> requests_;     /* Map requests sent by the endpoint */
+    IDTable<StandardMem::Request::id_t, MemEventBase*, RequestIDHash> responses_;  /* Map requests received by the endpoint */
     SST::MemHierarchy::MemLinkBase*  link_;
     bool cacheDst_; // Whether we've got a cache below us to handle certain conversions or we need to 
 
@@ -196,6 +213,17 @@ private:
 
     /* Record noncacheable regions (e.g., MMIO device addresses) */
     std::multimap<Addr, MemRegion> noncacheableRegions;
+
+    /* Lookup index over noncacheableRegions, rebuilt whenever a region is added.
+     * Non-interleaved regions are merged into sorted, disjoint [start,end] intervals
+     * and searched by binary search; interleaved regions are checked individually. */
+    std::vector<std::pair<Addr,Addr>> noncacheableIntervals_;
+    std::vector<MemRegion> noncacheableInterleaved_;
+    bool hasNoncacheable_;
+
+    void addNoncacheableRegion(const MemRegion& reg);
+    void buildNoncacheableIndex();
+    bool isNoncacheable(Addr addr) const;
    
     /** Perform some sanity checks to assist with debugging
      * These are only called if SST Core is configured with --enable-debug
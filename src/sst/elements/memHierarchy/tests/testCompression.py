@@ -0,0 +1,96 @@
+import sys
+import sst
+from mhlib import componentlist
+
+# Compressed L2 over a compressed memory with a backing store
+# Even fully compressed, the L2 holds half of memory, so lines are written back and read again
+# Model option: compression algorithm, 'bdi' (default), 'fpc' or 'zero'
+# The CPU writes the address into the first bytes of each line and leaves the rest zero,
+# so written lines compress under bdi and fpc and lines that were never written compress under all three
+
+algorithm = sys.argv[1] if len(sys.argv) > 1 else "bdi"
+
+# Define the simulation components
+verbose = 2
+
+DEBUG_L1 = 0
+DEBUG_L2 = 0
+DEBUG_MEM = 0
+DEBUG_LEVEL = 10
+
+cpu = sst.Component("core", "memHierarchy.standardCPU")
+cpu.addParams({
+    "memFreq" : 2,
+    "memSize" : "16KiB",
+    "clock" : "2GHz",
+    "rngseed" : 5,
+    "maxOutstanding" : 16,
+    "opCount" : 20000,
+    "reqsPerIssue" : 2,
+    "write_freq" : 40,
+    "read_freq" : 60,
+})
+iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+l1cache = sst.Component("l1cache", "memHierarchy.Cache")
+l1cache.addParams({
+    "access_latency_cycles" : "2",
+    "cache_frequency" : "2 Ghz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : "4",
+    "cache_line_size" : "64",
+    "debug" : DEBUG_L1,
+    "debug_level" : DEBUG_LEVEL,
+    "verbose" : verbose,
+    "L1" : "1",
+    "cache_size" : "2KiB"
+})
+
+l2cache = sst.Component("l2cache", "memHierarchy.Cache")
+l2cache.addParams({
+    "access_latency_cycles" : "6",
+    "cache_frequency" : "2 Ghz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : "4",
+    "cache_line_size" : "64",
+    "compression" : algorithm,
+    "compressed_lines_per_way" : 2,
+    "debug" : DEBUG_L2,
+    "debug_level" : DEBUG_LEVEL,
+    "verbose" : verbose,
+    "cache_size" : "4KiB"
+})
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "debug" : DEBUG_MEM,
+    "debug_level" : DEBUG_LEVEL,
+    "clock" : "1GHz",
+    "verbose" : verbose,
+    "addr_range_end" : 16*1024-1,
+    "backing" : "malloc",
+    "compression" : algorithm,
+})
+
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : "50ns",
+    "mem_size" : "16KiB"
+})
+
+# Enable statistics
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+for a in componentlist:
+    sst.enableAllStatisticsForComponentType(a)
+
+
+# Define the simulation links
+link_cpu_l1 = sst.Link("link_cpu_l1")
+link_cpu_l1.connect( (iface, "port", "1000ps"), (l1cache, "high_network_0", "1000ps") )
+link_l1_l2 = sst.Link("link_l1_l2")
+link_l1_l2.connect( (l1cache, "low_network_0", "1000ps"), (l2cache, "high_network_0", "1000ps") )
+link_l2_mem = sst.Link("link_l2_mem")
+link_l2_mem.connect( (l2cache, "low_network_0", "50ps"), (memctrl, "direct_link", "50ps") )
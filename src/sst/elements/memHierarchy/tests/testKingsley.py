@@ -1,9 +1,13 @@
 import os
+import sys
 import sst
 from mhlib import componentlist
 
 quiet = True
 
+# Optional model option: number of events the NICs may aggregate into one packet
+aggregate_events = int(sys.argv[1]) if len(sys.argv) > 1 else 1
+
 memCapacity = 4 # In GB
 memPageSize = 4 # in KB
 memNumPages = memCapacity * 1024 * 1024 // memPageSize
@@ -104,6 +108,7 @@ l2_nic_params = {
     "group" : 1,
     "debug" : debugNIC,
     "debug_level" : debugLev,
+    "aggregate_events" : aggregate_events,
 }
 
 ctrl_net_params = {
@@ -134,6 +139,7 @@ dc_nic_params = {
     "group" : 2,
     "debug" : debugNIC,
     "debug_level" : debugLev,
+    "aggregate_events" : aggregate_events,
 }
 
 ##### TimingDRAM #####
@@ -168,6 +174,7 @@ ddr_nic_params = {
     "group" : 3,
     "debug" : debugNIC,
     "debug_level" : debugLev,
+    "aggregate_events" : aggregate_events,
 }
 
 
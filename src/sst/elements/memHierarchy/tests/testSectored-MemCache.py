@@ -0,0 +1,161 @@
+import sst
+from mhlib import componentlist
+
+# Sectored MemCacheController: four 64B sectors share each tag
+# core -> L1 -> L2 -> network -> directory -> memory cache -> memory
+# The memory cache holds a quarter of the memory the core touches, so
+# blocks are evicted with several sectors, some clean and some dirty
+
+# Define the simulation components
+verbose = 2
+
+DEBUG_L1 = 0
+DEBUG_L2 = 0
+DEBUG_DIR = 0
+DEBUG_MEMCACHE = 0
+DEBUG_MEM = 0
+DEBUG_LEVEL = 10
+
+mem_size = 64*1024
+
+cpu = sst.Component("core", "memHierarchy.standardCPU")
+cpu.addParams({
+    "memFreq" : 2,
+    "memSize" : "64KiB",
+    "clock" : "2GHz",
+    "rngseed" : 23,
+    "maxOutstanding" : 16,
+    "opCount" : 20000,
+    "reqsPerIssue" : 2,
+    "write_freq" : 40,
+    "read_freq" : 60,
+})
+iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+l1cache = sst.Component("l1cache", "memHierarchy.Cache")
+l1cache.addParams({
+    "access_latency_cycles" : "2",
+    "cache_frequency" : "2 Ghz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : "4",
+    "cache_line_size" : "64",
+    "debug" : DEBUG_L1,
+    "debug_level" : DEBUG_LEVEL,
+    "verbose" : verbose,
+    "L1" : "1",
+    "cache_size" : "2KiB"
+})
+
+l2cache = sst.Component("l2cache", "memHierarchy.Cache")
+l2cache.addParams({
+    "access_latency_cycles" : "6",
+    "cache_frequency" : "2 Ghz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : "4",
+    "cache_line_size" : "64",
+    "debug" : DEBUG_L2,
+    "debug_level" : DEBUG_LEVEL,
+    "verbose" : verbose,
+    "cache_size" : "4KiB"
+})
+l2tol1 = l2cache.setSubComponent("cpulink", "memHierarchy.MemLink")
+l2nic = l2cache.setSubComponent("memlink", "memHierarchy.MemNIC")
+l2nic.addParams({
+    "group" : 1,
+    "network_bw" : "25GB/s",
+})
+
+chiprtr = sst.Component("chiprtr", "merlin.hr_router")
+chiprtr.addParams({
+    "xbar_bw" : "25GB/s",
+    "link_bw" : "25GB/s",
+    "input_buf_size" : "1KB",
+    "num_ports" : "4",
+    "flit_size" : "72B",
+    "output_buf_size" : "1KB",
+    "id" : "0",
+})
+chiprtr.setSubComponent("topology","merlin.singlerouter")
+
+dirctrl = sst.Component("dirctrl", "memHierarchy.DirectoryController")
+dirctrl.addParams({
+    "coherence_protocol" : "MESI",
+    "debug" : DEBUG_DIR,
+    "debug_level" : DEBUG_LEVEL,
+    "verbose" : verbose,
+    "entry_cache_size" : "1024",
+    "addr_range_start" : "0x0",
+    "addr_range_end" : mem_size - 1,
+})
+dirnic = dirctrl.setSubComponent("cpulink", "memHierarchy.MemNIC")
+dirnic.addParams({
+    "group" : 2,
+    "network_bw" : "25GB/s",
+})
+
+memcache = sst.Component("memcache", "memHierarchy.MemCacheController")
+memcache.addParams({
+    "clock" : "1GHz",
+    "cache_line_size" : 64,
+    "sector_count" : 4,
+    "backing" : "none",
+    "max_requests_per_cycle" : 4,
+    "debug" : DEBUG_MEMCACHE,
+    "debug_level" : DEBUG_LEVEL,
+    "verbose" : verbose,
+})
+memcachebk = memcache.setSubComponent("backend", "memHierarchy.simpleMem")
+memcachebk.addParams({
+    "access_time" : "10ns",
+    "mem_size" : "16KiB",
+})
+memcachenic = memcache.setSubComponent("cpulink", "memHierarchy.MemNIC")
+memcachenic.addParams({
+    "group" : 3,
+    "network_bw" : "25GB/s",
+})
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1GHz",
+    "backing" : "none",
+    "debug" : DEBUG_MEM,
+    "debug_level" : DEBUG_LEVEL,
+    "verbose" : verbose,
+    "addr_range_start" : 0,
+    "addr_range_end" : mem_size - 1,
+})
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : "50ns",
+    "mem_size" : "64KiB",
+})
+memnic = memctrl.setSubComponent("cpulink", "memHierarchy.MemNIC")
+memnic.addParams({
+    "group" : 4,
+    "network_bw" : "25GB/s",
+})
+
+# Enable statistics
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+for a in componentlist:
+    sst.enableAllStatisticsForComponentType(a)
+sst.enableAllStatisticsForComponentType("memHierarchy.MemCacheController")
+
+
+# Define the simulation links
+link_cpu_l1 = sst.Link("link_cpu_l1")
+link_cpu_l1.connect( (iface, "port", "1000ps"), (l1cache, "high_network_0", "1000ps") )
+link_l1_l2 = sst.Link("link_l1_l2")
+link_l1_l2.connect( (l1cache, "low_network_0", "1000ps"), (l2tol1, "port", "1000ps") )
+link_l2_net = sst.Link("link_l2_net")
+link_l2_net.connect( (l2nic, "port", "100ps"), (chiprtr, "port0", "100ps") )
+link_dir_net = sst.Link("link_dir_net")
+link_dir_net.connect( (dirnic, "port", "100ps"), (chiprtr, "port1", "100ps") )
+link_memcache_net = sst.Link("link_memcache_net")
+link_memcache_net.connect( (memcachenic, "port", "100ps"), (chiprtr, "port2", "100ps") )
+link_mem_net = sst.Link("link_mem_net")
+link_mem_net.connect( (memnic, "port", "100ps"), (chiprtr, "port3", "100ps") )
@@ -0,0 +1,89 @@
+import sst
+from mhlib import componentlist
+
+# Sectored L1 and L2: four 64B sectors share each tag
+# A small memory gives the random traffic enough reuse that blocks hold several
+# sectors, some clean and some dirty, when they are evicted
+
+# Define the simulation components
+verbose = 2
+
+DEBUG_L1 = 0
+DEBUG_L2 = 0
+DEBUG_MEM = 0
+DEBUG_LEVEL = 10
+
+cpu = sst.Component("core", "memHierarchy.standardCPU")
+cpu.addParams({
+    "memFreq" : 2,
+    "memSize" : "16KiB",
+    "clock" : "2GHz",
+    "rngseed" : 11,
+    "maxOutstanding" : 16,
+    "opCount" : 20000,
+    "reqsPerIssue" : 2,
+    "write_freq" : 40,
+    "read_freq" : 60,
+})
+iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+l1cache = sst.Component("l1cache", "memHierarchy.Cache")
+l1cache.addParams({
+    "access_latency_cycles" : "2",
+    "cache_frequency" : "2 Ghz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : "4",
+    "cache_line_size" : "64",
+    "sector_count" : "4",
+    "debug" : DEBUG_L1,
+    "debug_level" : DEBUG_LEVEL,
+    "verbose" : verbose,
+    "L1" : "1",
+    "cache_size" : "4KiB"
+})
+
+l2cache = sst.Component("l2cache", "memHierarchy.Cache")
+l2cache.addParams({
+    "access_latency_cycles" : "6",
+    "cache_frequency" : "2 Ghz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : "4",
+    "cache_line_size" : "64",
+    "sector_count" : "4",
+    "debug" : DEBUG_L2,
+    "debug_level" : DEBUG_LEVEL,
+    "verbose" : verbose,
+    "cache_size" : "8KiB"
+})
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "debug" : DEBUG_MEM,
+    "debug_level" : DEBUG_LEVEL,
+    "clock" : "1GHz",
+    "verbose" : verbose,
+    "addr_range_end" : 16*1024-1,
+})
+
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : "50ns",
+    "mem_size" : "16KiB"
+})
+
+# Enable statistics
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+for a in componentlist:
+    sst.enableAllStatisticsForComponentType(a)
+
+
+# Define the simulation links
+link_cpu_l1 = sst.Link("link_cpu_l1")
+link_cpu_l1.connect( (iface, "port", "1000ps"), (l1cache, "high_network_0", "1000ps") )
+link_l1_l2 = sst.Link("link_l1_l2")
+link_l1_l2.connect( (l1cache, "low_network_0", "1000ps"), (l2cache, "high_network_0", "1000ps") )
+link_l2_mem = sst.Link("link_l2_mem")
+link_l2_mem.connect( (l2cache, "low_network_0", "50ps"), (memctrl, "direct_link", "50ps") )
@@ -0,0 +1,107 @@
+import sys
+import sst
+from mhlib import componentlist
+
+# Warm-start snapshots
+# Model options: <save|load> <checkpointDir> [l2 associativity]
+# A 'save' run writes each cache's and the memory's state to checkpointDir when it finishes,
+# a 'load' run restores it before the first request. The core replays the same requests in
+# both runs, so a load run should hit where the save run missed. Changing the L2 associativity
+# between the runs makes the L2 snapshot unusable and the load must fail.
+
+if len(sys.argv) < 3:
+    print("Usage: sst testSnapshot.py --model-options=\"<save|load> <checkpointDir> [l2 associativity]\"")
+    sst.exit()
+
+checkpoint = sys.argv[1]
+checkpointDir = sys.argv[2]
+l2_assoc = sys.argv[3] if len(sys.argv) > 3 else "8"
+
+# Define the simulation components
+verbose = 2
+
+DEBUG_L1 = 0
+DEBUG_L2 = 0
+DEBUG_MEM = 0
+DEBUG_LEVEL = 10
+
+snapshot_params = {
+    "checkpoint" : checkpoint,
+    "checkpointDir" : checkpointDir,
+}
+
+cpu = sst.Component("core", "memHierarchy.standardCPU")
+cpu.addParams({
+    "memFreq" : 2,
+    "memSize" : "16KiB",
+    "clock" : "2GHz",
+    "rngseed" : 7,
+    "maxOutstanding" : 8,
+    "opCount" : 5000,
+    "write_freq" : 40,
+    "read_freq" : 60,
+})
+iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+l1cache = sst.Component("l1cache", "memHierarchy.Cache")
+l1cache.addParams({
+    "access_latency_cycles" : "2",
+    "cache_frequency" : "2 Ghz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : "4",
+    "cache_line_size" : "64",
+    "debug" : DEBUG_L1,
+    "debug_level" : DEBUG_LEVEL,
+    "verbose" : verbose,
+    "L1" : "1",
+    "cache_size" : "4KiB"
+})
+l1cache.addParams(snapshot_params)
+
+l2cache = sst.Component("l2cache", "memHierarchy.Cache")
+l2cache.addParams({
+    "access_latency_cycles" : "6",
+    "cache_frequency" : "2 Ghz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : l2_assoc,
+    "cache_line_size" : "64",
+    "debug" : DEBUG_L2,
+    "debug_level" : DEBUG_LEVEL,
+    "verbose" : verbose,
+    "cache_size" : "32KiB"
+})
+l2cache.addParams(snapshot_params)
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "debug" : DEBUG_MEM,
+    "debug_level" : DEBUG_LEVEL,
+    "clock" : "1GHz",
+    "verbose" : verbose,
+    "backing" : "malloc",
+    "addr_range_end" : 16*1024-1,
+})
+memctrl.addParams(snapshot_params)
+
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : "50ns",
+    "mem_size" : "16KiB"
+})
+
+# Enable statistics
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+for a in componentlist:
+    sst.enableAllStatisticsForComponentType(a)
+
+
+# Define the simulation links
+link_cpu_l1 = sst.Link("link_cpu_l1")
+link_cpu_l1.connect( (iface, "port", "1000ps"), (l1cache, "high_network_0", "1000ps") )
+link_l1_l2 = sst.Link("link_l1_l2")
+link_l1_l2.connect( (l1cache, "low_network_0", "1000ps"), (l2cache, "high_network_0", "1000ps") )
+link_l2_mem = sst.Link("link_l2_mem")
+link_l2_mem.connect( (l2cache, "low_network_0", "50ps"), (memctrl, "direct_link", "50ps") )
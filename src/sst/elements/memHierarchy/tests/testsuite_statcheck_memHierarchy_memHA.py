@@ -0,0 +1,221 @@
+# -*- coding: utf-8 -*-
+
+from sst_unittest import *
+from sst_unittest_support import *
+import os.path
+import re
+import shutil
+
+
+################################################################################
+# NOTES:
+# memHierarchy tests that check statistics against expected relations
+# (e.g., a warm start hits more than a cold one) rather than diffing the
+# output against a reference file. They are not part of the default suite
+# because they have not yet been run against an SST build; once they have,
+# they should get reference files and move to
+# testsuite_default_memHierarchy_memHA.py.
+################################################################################
+
+class testcase_memHierarchy_memHA_statcheck(SSTTestCase):
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+
+    def test_memHA_Kingsley_aggregate(self):
+        # 16 events do not fit in the 32B control buffers so packets are also capped by buffer space
+        self.memHA_StatCheck_Template("Kingsley", self._check_kingsley_aggregate, other_args='--model-options="16"', outname="Kingsley_aggregate")
+
+    def test_memHA_Sectored(self):
+        self.memHA_StatCheck_Template("Sectored", self._check_sectored_caches)
+
+    def test_memHA_Sectored_MemCache(self):
+        self.memHA_StatCheck_Template("Sectored_MemCache", self._check_sectored_memcache)
+
+    def test_memHA_Snapshot(self):
+        snapdir = self._snapshot_dir("Snapshot")
+        cold = self.memHA_StatCheck_Template("Snapshot", other_args='--model-options="save {0}"'.format(snapdir), outname="Snapshot_save")
+        warm = self.memHA_StatCheck_Template("Snapshot", other_args='--model-options="load {0}"'.format(snapdir), outname="Snapshot_load")
+
+        # The load run replays the save run's requests into the caches the save run left behind
+        for cache in ["l1cache", "l2cache"]:
+            cold_hits = self._stat(cold, cache + ".CacheHits")
+            warm_hits = self._stat(warm, cache + ".CacheHits")
+            cold_misses = self._stat(cold, cache + ".CacheMisses")
+            warm_misses = self._stat(warm, cache + ".CacheMisses")
+            self.assertTrue(warm_hits > cold_hits, "{0} did not start warm: {1} hits after load, {2} cold".format(cache, warm_hits, cold_hits))
+            self.assertTrue(warm_misses < cold_misses, "{0} did not start warm: {1} misses after load, {2} cold".format(cache, warm_misses, cold_misses))
+
+    def test_memHA_Compression_bdi(self):
+        self.memHA_StatCheck_Template("Compression", lambda stats: self._check_compression(stats, 1), other_args='--model-options="bdi"', outname="Compression_bdi")
+
+    def test_memHA_Compression_fpc(self):
+        self.memHA_StatCheck_Template("Compression", lambda stats: self._check_compression(stats, 5), other_args='--model-options="fpc"', outname="Compression_fpc")
+
+    def test_memHA_Compression_zero(self):
+        self.memHA_StatCheck_Template("Compression", lambda stats: self._check_compression(stats, 0), other_args='--model-options="zero"', outname="Compression_zero")
+
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, "memHA: test_memHA_Snapshot_geometry skipped if ranks > 1, fatal return codes differ under MPI")
+    def test_memHA_Snapshot_geometry(self):
+        snapdir = self._snapshot_dir("Snapshot_geometry")
+        self.memHA_StatCheck_Template("Snapshot", other_args='--model-options="save {0}"'.format(snapdir), outname="Snapshot_geometry_save")
+
+        # Restoring into an L2 with a different associativity must fail before simulating
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+        sdlfile = "{0}/testSnapshot.py".format(test_path)
+        outfile = "{0}/test_memHA_Snapshot_geometry_load.out".format(outdir)
+        errfile = "{0}/test_memHA_Snapshot_geometry_load.err".format(outdir)
+        self.run_sst(sdlfile, outfile, errfile, set_cwd=test_path, other_args='--model-options="load {0} 4"'.format(snapdir),
+                     expected_rc=255, timeout_sec=60)
+
+        with open(outfile, 'r') as fp:
+            output = fp.read()
+        with open(errfile, 'r') as fp:
+            output += fp.read()
+        self.assertTrue("does not match this configuration: associativity" in output,
+                        "Loading a snapshot into a different L2 geometry did not report the mismatch")
+
+#####
+
+    # Run 'testcase' and check its statistics with 'check' instead of diffing them against a reference file.
+    # 'check' is called with the map returned by _read_stats. The map is also returned so that callers can compare runs.
+    def memHA_StatCheck_Template(self, testcase, check=None, other_args="", outname=None, testtimeout=240):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        testcasename_sdl = testcase.replace("_", "-")
+
+        testDataFileName = "test_memHA_{0}".format(outname if outname else testcase)
+        sdlfile = "{0}/test{1}.py".format(test_path, testcasename_sdl)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+
+        log_debug("testcase = {0}".format(testcase))
+        log_debug("sdl file = {0}".format(sdlfile))
+
+        self.run_sst(sdlfile, outfile, errfile, set_cwd=test_path, other_args=other_args,
+                     timeout_sec=testtimeout, mpi_out_files=mpioutfiles)
+
+        stats = self._read_stats(outfile)
+        if check:
+            check(stats)
+        return stats
+
+    # Empty directory for the snapshots of 'testcase'
+    def _snapshot_dir(self, testcase):
+        snapdir = "{0}/test_memHA_{1}_checkpoint".format(self.get_test_output_tmp_dir(), testcase)
+        if os.path.isdir(snapdir):
+            shutil.rmtree(snapdir)
+        os.makedirs(snapdir)
+        return snapdir
+
+    # Statistic value, failing the test if 'name' was not reported
+    def _stat(self, stats, name, field=0):
+        self.assertTrue(name in stats, "Statistic {0} is missing from the output".format(name))
+        return stats[name][field]
+
+    # Kingsley with aggregating NICs against the unaggregated reference. The cores must issue exactly the same requests
+    # and the memories must see the same traffic, allowing for the prefetcher reacting to the changed timing.
+    # The NICs must send fewer packets than the reference, which sends one packet per event.
+    def _check_kingsley_aggregate(self, stats):
+        ref = self._read_stats("{0}/refFiles/test_memHA_Kingsley.out".format(self.get_testsuite_dir()))
+        for name in ref:
+            if name.startswith("thread_") and name.split(".")[1] in ["read_reqs", "write_reqs", "total_bytes_read", "total_bytes_write"]:
+                self.assertEqual(self._stat(stats, name), ref[name][0], "{0} differs from the unaggregated reference".format(name))
+
+        for cmd in ["GetS", "GetX", "PutM"]:
+            ref_count = sum(ref[name][0] for name in ref if name.startswith("ddr_") and name.endswith(".requests_received_" + cmd))
+            count = sum(stats[name][0] for name in stats if name.startswith("ddr_") and name.endswith(".requests_received_" + cmd))
+            self.assertTrue(abs(count - ref_count) <= 0.1 * ref_count,
+                "Memories received {0} {1} requests, unaggregated reference received {2}".format(count, cmd, ref_count))
+
+        ref_packets = sum(ref[name][2] for name in ref if name.endswith(".packet_latency"))
+        packets = sum(stats[name][2] for name in stats if name.endswith(".packet_latency"))
+        self.assertTrue(0 < packets < ref_packets, "NICs sent {0} packets, unaggregated reference sent {1}".format(packets, ref_packets))
+
+    # Statistic of the compressor in 'comp'. Its statistics are inserted into the owner, so match on the owner's name.
+    def _compressor_stat(self, stats, comp, name, field=0):
+        names = [n for n in stats if n.endswith("." + name) and (n.split(".")[0] == comp or n.startswith(comp + ":"))]
+        self.assertTrue(len(names) == 1, "Expected one {0} statistic for {1}, found {2}".format(name, comp, names))
+        return stats[names[0]][field]
+
+    # Compressed L2 over a compressed memory. 'latency' is the algorithm's default decompression latency.
+    # The L2 must hold compressed lines and pay the latency on some reads.
+    # The memory must compress each line written back exactly once and nothing it reads, and look up
+    # the stored size on every read, paying the latency only for lines that were written back compressed.
+    def _check_compression(self, stats, latency):
+        self.assertTrue(self._compressor_stat(stats, "l2cache", "compression_ratio", 4) > 1, "l2cache compressed no lines")
+        self.assertTrue(self._compressor_stat(stats, "l2cache", "decompression_latency", 2) > 0, "l2cache decompressed no lines")
+        self.assertEqual(self._compressor_stat(stats, "l2cache", "decompression_latency", 4), latency)
+
+        putm = self._stat(stats, "memory.requests_received_PutM")
+        reads = self._stat(stats, "memory.requests_received_GetS") + self._stat(stats, "memory.requests_received_GetX")
+        self.assertTrue(putm > 0, "memory received no writebacks")
+        self.assertEqual(self._compressor_stat(stats, "memory", "compression_ratio", 2), putm,
+            "memory must compress each writeback and no reads")
+        self.assertEqual(self._compressor_stat(stats, "memory", "compressed_size", 2), putm,
+            "memory must compress each writeback and no reads")
+        self.assertEqual(self._compressor_stat(stats, "memory", "decompression_latency", 2), reads,
+            "memory must look up the compressed size of each read")
+        self.assertTrue(self._compressor_stat(stats, "memory", "decompression_latency", 4) <= latency)
+        if latency:
+            self.assertTrue(self._compressor_stat(stats, "memory", "decompression_latency", 0) > 0, "memory never read a compressed line")
+
+    # Sectored L1 and L2 over a small memory. Each cache must see misses to invalid sectors of resident blocks,
+    # evict blocks that hold more than one sector, and write back only the dirty sectors of those blocks.
+    def _check_sectored_caches(self, stats):
+        for cache in ["l1cache", "l2cache"]:
+            misses = self._stat(stats, cache + ".CacheMisses")
+            sector_miss = self._stat(stats, cache + ".sector_miss")
+            sector_evict = self._stat(stats, cache + ".sector_evict")
+            sector_wb = self._stat(stats, cache + ".sector_writeback")
+
+            self.assertTrue(sector_miss > 0, "{0} had no sector misses".format(cache))
+            # Each miss that was not a sector miss allocated at most one block, so more evicted sectors
+            # than that means evicted blocks held more than one sector on average
+            self.assertTrue(sector_evict > misses - sector_miss,
+                            "{0} evicted {1} sectors from at most {2} blocks".format(cache, sector_evict, misses - sector_miss))
+            self.assertTrue(0 < sector_wb < sector_evict,
+                            "{0} wrote back {1} of {2} evicted sectors".format(cache, sector_wb, sector_evict))
+
+        # The L2 is the only source of writebacks to memory and sends one per dirty sector
+        self.assertEqual(self._stat(stats, "memory.requests_received_PutM"), self._stat(stats, "l2cache.sector_writeback"))
+
+    # Sectored MemCacheController in front of a memory. It must see sector misses, evict multi-sector blocks,
+    # and send memory one writeback per dirty sector rather than one per evicted sector
+    def _check_sectored_memcache(self, stats):
+        self.assertTrue(self._stat(stats, "memcache.SectorMisses") > 0, "memcache had no sector misses")
+        self.assertTrue(self._stat(stats, "memcache.SectorsEvicted", 4) > 1, "memcache never evicted a block with more than one sector")
+
+        evicted = self._stat(stats, "memcache.SectorsEvicted")
+        writebacks = self._stat(stats, "memcache.SectorWritebacks")
+        self.assertTrue(0 < writebacks < evicted, "memcache wrote back {0} of {1} evicted sectors".format(writebacks, evicted))
+        self.assertEqual(self._stat(stats, "memory.requests_received_PutM"), writebacks)
+
+    # Return the statistics in 'outfile' as a map of "component.statistic" to [sum, sumSQ, count, min, max]
+    # Floating point statistics are parsed as well as integer ones
+    def _read_stats(self, outfile):
+        cons_accum = re.compile(r' ([\w.:]+) : Accumulator : Sum.\w+ = ([-+\w.]+); SumSQ.\w+ = ([-+\w.]+); Count.\w+ = (\d+); Min.\w+ = ([-+\w.]+); Max.\w+ = ([-+\w.]+);')
+        stats = {}
+        with open(outfile, 'r') as fp:
+            for line in fp:
+                m = cons_accum.match(line)
+                if m == None:
+                    continue
+                values = []
+                for v in m.groups()[1:]:
+                    try:
+                        values.append(int(v))
+                    except ValueError:
+                        values.append(float(v))
+                stats[m.group(1)] = values
+        return stats
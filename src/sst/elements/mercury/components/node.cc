@@ -76,6 +76,13 @@ Node::setup()
   if (nic_) nic_->setup();
 }
 
+void
+Node::finish()
+{
+  SST::Component::finish();
+  os_->finish();
+}
+
 void
 Node::handle(Request* req)
 {
@@ -118,8 +118,10 @@ OperatingSystem::OperatingSystem(SST::ComponentId_t id, SST::Params& params, Nod
   compute_sched_ = SST::Hg::create<ComputeScheduler>(
         "hg", params.find<std::string>("compute_scheduler", "simple"),
         params, this, node_ ? node_->ncores() : 1, node_ ? node_->nsockets() : 1);
+  compute_model_ = new RooflineCompute(params, this);
 
   StackAlloc::init(params);
+  stack_high_water_ = registerStatistic<uint64_t>("stack_high_water");
   initThreading(params);
 }
 
@@ -139,6 +141,7 @@ OperatingSystem::~OperatingSystem()
     delete des_context_;
   }
   if (compute_sched_) delete compute_sched_;
+  if (compute_model_) delete compute_model_;
 }
 
 void
@@ -148,6 +151,12 @@ OperatingSystem::setup() {
     selfEventLink_->send(r);
 }
 
+void
+OperatingSystem::finish() {
+  //stacks come from one pool per process, so every OS reports the same value
+  stack_high_water_->addData(StackAlloc::highWater());
+}
+
 void
 OperatingSystem::initThreading(SST::Params& params)
 {
@@ -32,6 +32,7 @@
 #include <mercury/operating_system/process/mutex.h>
 #include <mercury/operating_system/process/tls.h>
 #include <mercury/operating_system/process/compute_scheduler.h>
+#include <mercury/operating_system/process/roofline_compute.h>
 #include <mercury/operating_system/libraries/library.h>
 #include <mercury/hardware/network/network_message.h>
 
@@ -61,12 +62,26 @@ public:
     SST::Hg::OperatingSystem
   )
 
+  SST_ELI_DOCUMENT_PARAMS(
+    {"peak_flops", "Floating point operations per second of one core for detailed compute", "1e9"},
+    {"peak_intops", "Integer operations per second of one core for detailed compute, defaults to peak_flops"},
+    {"mem_bandwidth", "Memory bandwidth of the node, shared by all threads doing detailed compute", "10GB/s"},
+    {"thread_mem_bandwidth", "Largest memory bandwidth one core can draw, defaults to mem_bandwidth"},
+    {"cache_reuse", "Fraction of the bytes in a detailed compute that are served from cache", "0"},
+  )
+
+  SST_ELI_DOCUMENT_STATISTICS(
+    {"stack_high_water", "Largest number of user-thread stacks in use at once in this SST process", "stacks", 1},
+  )
+
   OperatingSystem(SST::ComponentId_t id, SST::Params& params, Node* parent);
 
   virtual ~OperatingSystem();
 
   void setup() override;
 
+  void finish() override;
+
   void handleEvent(SST::Event *ev);
 
   bool clockTic(SST::Cycle_t) {
@@ -164,6 +179,8 @@ public:
   AppLauncher* app_launcher_;
   std::map<uint32_t, Thread*> running_threads_;
   ComputeScheduler* compute_sched_;
+  RooflineCompute* compute_model_;
+  Statistic<uint64_t>* stack_high_water_;
 
   std::unordered_map<std::string, Library*> libs_;
   std::unordered_map<Library*, int> lib_refcounts_;
@@ -239,6 +256,14 @@ public:
     compute_sched_->releaseCores(ncore,thr);
   }
 
+  /**
+   * @brief computeDetailed Block the active thread for the roofline time
+   * of the given work, see RooflineCompute
+   */
+  void computeDetailed(uint64_t flops, uint64_t intops, uint64_t bytes, int nthread) {
+    compute_model_->compute(active_thread_, flops, intops, bytes, nthread);
+  }
+
 //  NodeId rankToNode(int rank) {
 //    return NodeId( rank_mapper_->mapRank(rank) );
 //  }
@@ -535,23 +535,19 @@ App::compute(TimeDelta time)
 //          num_loops, nflops_per_loop, nintops_per_loop, bytes_per_loop);
 //}
 
-//void
-//App::computeDetailed(uint64_t flops, uint64_t nintops, uint64_t bytes, int nthread)
-//{
-//  static const uint64_t overflow = 18006744072479883520ull;
-//  if (flops > overflow || bytes > overflow){
-//    spkt_abort_printf("flops/byte counts for compute overflowed");
-//  }
-//  if ((flops+nintops) < min_op_cutoff_){
-//    return;
-//  }
-
-//  debug_printf(sprockit::dbg::app_compute,
-//               "Rank %d for app %d: detailed compute for flops=%" PRIu64 " intops=%" PRIu64 " bytes=%" PRIu64,
-//               sid_.task_, sid_.app_, flops, nintops, bytes);
+void
+App::computeDetailed(uint64_t flops, uint64_t nintops, uint64_t bytes, int nthread)
+{
+  static const uint64_t overflow = 18006744072479883520ull;
+  if (flops > overflow || bytes > overflow){
+    sst_hg_abort_printf("flops/byte counts for compute overflowed");
+  }
+  if ((flops+nintops) < min_op_cutoff_){
+    return;
+  }
 
-//  computeLib()->computeDetailed(flops, nintops, bytes, nthread);
-//}
+  os_->computeDetailed(flops, nintops, bytes, nthread);
+}
 
 //void
 //App::computeBlockRead(uint64_t bytes)
@@ -0,0 +1,132 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <queue>
+
+namespace SST {
+namespace Hg {
+
+/**
+ * @brief The WaitList class
+ * Intrusive FIFO of waiters. The nodes are owned by the waiters (usually on
+ * the stack of a blocked thread), so pushing and removing never allocates
+ * and removing a waiter that is not at the front is O(1).
+ */
+template <class T>
+class WaitList
+{
+ public:
+  struct Node {
+    T* waiter;
+    Node* prev;
+    Node* next;
+
+    explicit Node(T* w) : waiter(w), prev(nullptr), next(nullptr) {}
+  };
+
+  WaitList() : head_(nullptr), tail_(nullptr) {}
+
+  bool empty() const {
+    return head_ == nullptr;
+  }
+
+  T* front() const {
+    return head_->waiter;
+  }
+
+  void push_back(Node* n){
+    n->next = nullptr;
+    n->prev = tail_;
+    if (tail_) tail_->next = n;
+    else head_ = n;
+    tail_ = n;
+  }
+
+  void remove(Node* n){
+    if (n->prev) n->prev->next = n->next;
+    else head_ = n->next;
+    if (n->next) n->next->prev = n->prev;
+    else tail_ = n->prev;
+    n->prev = n->next = nullptr;
+  }
+
+ private:
+  Node* head_;
+  Node* tail_;
+};
+
+/**
+ * @brief The IndexedQueues class
+ * Item queues and wait lists for a set of completion queues with dense,
+ * small integer IDs. Slots are created on first use and never move, so a
+ * blocked thread can keep a reference to its wait list while new CQs are added.
+ */
+template <class Item, class T>
+class IndexedQueues
+{
+ public:
+  struct Slot {
+    std::queue<Item*> items;
+    WaitList<T> waiters;
+  };
+
+  IndexedQueues() : num_items_(0) {}
+
+  Slot& slot(int cq){
+    if (size_t(cq) >= slots_.size()){
+      slots_.resize(cq + 1);
+    }
+    return slots_[cq];
+  }
+
+  bool empty(int cq) const {
+    return size_t(cq) >= slots_.size() || slots_[cq].items.empty();
+  }
+
+  void push(int cq, Item* it){
+    slot(cq).items.push(it);
+    ++num_items_;
+  }
+
+  Item* pop(int cq){
+    auto& q = slots_[cq].items;
+    Item* it = q.front();
+    q.pop();
+    --num_items_;
+    return it;
+  }
+
+  /** Pop from the lowest numbered non-empty queue, nullptr if all are empty */
+  Item* popAny(){
+    if (num_items_ == 0) return nullptr;
+    for (size_t cq=0; cq < slots_.size(); ++cq){
+      if (!slots_[cq].items.empty()){
+        return pop(cq);
+      }
+    }
+    return nullptr;
+  }
+
+ private:
+  std::deque<Slot> slots_;
+  size_t num_items_;
+};
+
+} // end namespace Hg
+} // end namespace SST
@@ -49,19 +49,20 @@ namespace SST {
 namespace Hg {
 
 void
-ProgressQueue::block(std::list<Thread*>& q, double timeout){
-  Thread* thr = os->activeThread();
-  q.push_back(thr);
+ProgressQueue::block(ThreadWaitList& q, double timeout){
+  //the node lives on this thread's stack until we are done waiting
+  ThreadWaitList::Node node(os->activeThread());
+  q.push_back(&node);
   if (timeout > 0){
     os->blockTimeout(TimeDelta(timeout));
   } else {
     os->block();
   }
-  q.remove(thr);
+  q.remove(&node);
 }
 
 void
-ProgressQueue::unblock(std::list<Thread*>& q){
+ProgressQueue::unblock(ThreadWaitList& q){
 #if SST_HG_SANITY_CHECK
   if (q.empty()){
     spkt_abort_printf("trying to unblock CQ, but there are no pending threads");
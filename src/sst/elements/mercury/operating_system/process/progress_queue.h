@@ -49,12 +49,15 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <list>
 #include <mercury/common/errors.h>
 #include <mercury/common/timestamp.h>
+#include <mercury/operating_system/process/indexed_queues.h>
 #include <mercury/operating_system/process/thread_fwd.h>
 #include <mercury/components/operating_system_fwd.h>
 
 namespace SST {
 namespace Hg {
 
+using ThreadWaitList = WaitList<Thread>;
+
 struct ProgressQueue {
   OperatingSystem* os;
 
@@ -62,15 +65,15 @@ struct ProgressQueue {
   {
   }
 
-  void block(std::list<Thread*>& q, double timeout);
-  void unblock(std::list<Thread*>& q);
+  void block(ThreadWaitList& q, double timeout);
+  void unblock(ThreadWaitList& q);
 
 };
 
 template <class Item>
 struct SingleProgressQueue : public ProgressQueue {
   std::queue<Item*> items;
-  std::list<Thread*> pending_threads;
+  ThreadWaitList pending_threads;
 
   SingleProgressQueue(OperatingSystem* os) :
     ProgressQueue(os)
@@ -131,7 +134,7 @@ struct PollingQueue : public ProgressQueue {
  private:
   SST::Hg::Timestamp last_check_;
   int num_empty_calls_;
-  std::list<Thread*> pending_threads_;
+  ThreadWaitList pending_threads_;
 };
 
 template <class Item>
@@ -185,22 +188,17 @@ struct PollingProgressQueue : public PollingQueue {
 
 template <class Item>
 struct MultiProgressQueue : public ProgressQueue {
-  std::list<Thread*> any_threads;
-  std::map<int,std::queue<Item*>> queues;
-  std::map<int,std::list<Thread*>> pending_threads;
-  OperatingSystem* os;
+  ThreadWaitList any_threads;
+  IndexedQueues<Item,Thread> queues;
 
   MultiProgressQueue(OperatingSystem* os) : ProgressQueue(os)
   {
   }
 
   Item* find_any(bool blocking = true, double timeout = -1){
-    for (auto& pair : queues){
-      if (!pair.second.empty()){
-        auto it = pair.second.front();
-        pair.second.pop();
-        return it;
-      }
+    Item* it = queues.popAny();
+    if (it){
+      return it;
     }
     if (blocking){
       block(any_threads, timeout);
@@ -208,33 +206,25 @@ struct MultiProgressQueue : public ProgressQueue {
       return nullptr;
     }
 
-    for (auto& pair : queues){
-      if (!pair.second.empty()){
-        auto it = pair.second.front();
-        pair.second.pop();
-        return it;
-      }
-    }
-
+    it = queues.popAny();
 #if SST_HG_SANITY_CHECK
-    if (timeout <= 0){
+    if (!it && timeout <= 0){
       spkt_abort_printf("unblocked on CQ without timeout, but there are no messages");
     }
 #endif
-    return nullptr;
+    return it;
   }
 
   Item* find(int cq, bool blocking = true, double timeout = -1){
-    if (queues[cq].empty()){
+    if (queues.empty(cq)){
       if (blocking){
-        block(pending_threads[cq], timeout);
+        block(queues.slot(cq).waiters, timeout);
       } else {
         return nullptr;
       }
     }
 
-
-    if (queues[cq].empty()){
+    if (queues.empty(cq)){
 #if SST_HG_SANITY_CHECK
       if (timeout <= 0){
         spkt_abort_printf("unblocked on CQ with no timeout, but there are no items");
@@ -242,16 +232,15 @@ struct MultiProgressQueue : public ProgressQueue {
 #endif
       return nullptr;
     } else {
-      auto it = queues[cq].front();
-      queues[cq].pop();
-      return it;
+      return queues.pop(cq);
     }
   }
 
   void incoming(int cq, Item* it){
-    queues[cq].push(it);
-    if (!pending_threads[cq].empty()){
-      unblock(pending_threads[cq]);
+    queues.push(cq, it);
+    auto& waiters = queues.slot(cq).waiters;
+    if (!waiters.empty()){
+      unblock(waiters);
     } else if (!any_threads.empty()){
       unblock(any_threads);
     } else {
@@ -0,0 +1,165 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst/core/unitAlgebra.h>
+#include <mercury/components/operating_system.h>
+#include <mercury/operating_system/process/roofline_compute.h>
+#include <mercury/operating_system/process/thread.h>
+#include <mercury/common/errors.h>
+
+#include <algorithm>
+
+namespace SST {
+namespace Hg {
+
+extern template class  HgBase<SST::Component>;
+extern template class  HgBase<SST::SubComponent>;
+
+class RooflineDoneEvent : public ExecutionEvent
+{
+ public:
+  RooflineDoneEvent(RooflineCompute* model, uint64_t id, uint64_t token) :
+    model_(model), id_(id), token_(token)
+  {
+  }
+
+  void execute() override {
+    model_->complete(id_, token_);
+  }
+
+ protected:
+  RooflineCompute* model_;
+  uint64_t id_;
+  uint64_t token_;
+};
+
+static double
+bandwidthParam(SST::Params& params, const std::string& name, const std::string& deflt)
+{
+  UnitAlgebra bw = params.find<UnitAlgebra>(name, deflt);
+  if (bw.hasUnits("b/s")){
+    bw /= UnitAlgebra("8b/B");
+  } else if (!bw.hasUnits("B/s")){
+    sst_hg_abort_printf("%s must be given in b/s or B/s: %s",
+                        name.c_str(), bw.toStringBestSI().c_str());
+  }
+  return bw.getDoubleValue();
+}
+
+RooflineCompute::RooflineCompute(SST::Params& params, OperatingSystem* os) :
+  os_(os),
+  active_threads_(0),
+  next_id_(0),
+  next_token_(0),
+  last_update_(0)
+{
+  flop_rate_ = params.find<double>("peak_flops", 1e9);
+  intop_rate_ = params.find<double>("peak_intops", flop_rate_);
+  mem_bw_ = bandwidthParam(params, "mem_bandwidth", "10GB/s");
+  thread_mem_bw_ = mem_bw_;
+  if (params.contains("thread_mem_bandwidth")){
+    thread_mem_bw_ = bandwidthParam(params, "thread_mem_bandwidth", "10GB/s");
+  }
+  cache_reuse_ = params.find<double>("cache_reuse", 0.0);
+  if (flop_rate_ <= 0 || intop_rate_ <= 0 || mem_bw_ <= 0 || thread_mem_bw_ <= 0){
+    sst_hg_abort_printf("roofline compute rates must be positive");
+  }
+  if (cache_reuse_ < 0 || cache_reuse_ >= 1){
+    sst_hg_abort_printf("cache_reuse must be in [0,1): got %f", cache_reuse_);
+  }
+}
+
+void
+RooflineCompute::compute(Thread* thr, uint64_t flops, uint64_t intops,
+                         uint64_t bytes, int nthread)
+{
+  nthread = std::max(1, std::min(nthread, os_->ncores()));
+  os_->reserveCores(nthread, thr);
+
+  double ops_time = (flops / flop_rate_ + intops / intop_rate_) / nthread;
+  double mem_bytes = bytes * (1.0 - cache_reuse_);
+  if (mem_bytes == 0){
+    //nothing shared, no need to disturb the other computes
+    if (ops_time > 0){
+      os_->blockTimeout(TimeDelta(ops_time));
+    }
+    os_->releaseCores(nthread, thr);
+    return;
+  }
+
+  advance();
+  ActiveCompute& comp = active_[next_id_++];
+  comp.thr = thr;
+  comp.nthread = nthread;
+  comp.ops_time = ops_time;
+  comp.mem_bytes = mem_bytes;
+  comp.remaining = 1.0;
+  comp.duration = 0;
+  active_threads_ += nthread;
+  rebalance();
+
+  //complete() erases the entry before waking us up
+  os_->block();
+  os_->releaseCores(nthread, thr);
+}
+
+void
+RooflineCompute::complete(uint64_t id, uint64_t token)
+{
+  auto iter = active_.find(id);
+  if (iter == active_.end() || iter->second.token != token){
+    return; //rescheduled since this was sent
+  }
+
+  Thread* thr = iter->second.thr;
+  advance();
+  active_threads_ -= iter->second.nthread;
+  active_.erase(iter);
+  rebalance();
+  os_->unblock(thr);
+}
+
+void
+RooflineCompute::advance()
+{
+  double now = os_->now().sec();
+  double elapsed = now - last_update_;
+  last_update_ = now;
+  if (elapsed <= 0) return;
+
+  for (auto& pair : active_){
+    ActiveCompute& comp = pair.second;
+    if (comp.duration > 0){
+      comp.remaining = std::max(0.0, comp.remaining - elapsed / comp.duration);
+    }
+  }
+}
+
+void
+RooflineCompute::rebalance()
+{
+  for (auto& pair : active_){
+    ActiveCompute& comp = pair.second;
+    double share = mem_bw_ * comp.nthread / active_threads_;
+    double bw = std::min(share, thread_mem_bw_ * comp.nthread);
+    comp.duration = std::max(comp.ops_time, comp.mem_bytes / bw);
+    comp.token = next_token_++;
+    os_->sendDelayedExecutionEvent(TimeDelta(comp.remaining * comp.duration),
+                                   new RooflineDoneEvent(this, pair.first, comp.token));
+  }
+}
+
+} // end namespace Hg
+} // end namespace SST
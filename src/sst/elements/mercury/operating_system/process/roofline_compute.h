@@ -0,0 +1,85 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#pragma once
+
+#include <sst/core/params.h>
+#include <mercury/common/events.h>
+#include <mercury/components/operating_system_fwd.h>
+#include <mercury/operating_system/process/thread_fwd.h>
+
+#include <cstdint>
+#include <map>
+
+namespace SST {
+namespace Hg {
+
+/**
+ * @brief The RooflineCompute class
+ * Models detailed compute (flops, intops, bytes) on a node as the max of
+ * the core-bound time and the memory-bound time. Cores come from the
+ * compute scheduler, memory bandwidth is shared by all threads that are
+ * computing at the same time. Shares are only recomputed when a compute
+ * starts or finishes, the remaining work of each compute is carried over.
+ */
+class RooflineCompute
+{
+ public:
+  RooflineCompute(SST::Params& params, OperatingSystem* os);
+
+  /**
+   * @brief compute Block the calling thread for the modeled duration
+   * @param thr     The active thread, must not be the DES thread
+   * @param nthread Number of cores to reserve for the compute
+   */
+  void compute(Thread* thr, uint64_t flops, uint64_t intops,
+               uint64_t bytes, int nthread);
+
+  void complete(uint64_t id, uint64_t token);
+
+ private:
+  struct ActiveCompute {
+    Thread* thr;
+    int nthread;
+    double ops_time;
+    double mem_bytes;
+    //fraction of the compute still to do
+    double remaining;
+    //duration of the full compute at the current bandwidth share
+    double duration;
+    //matches only the most recently scheduled completion
+    uint64_t token;
+  };
+
+  void advance();
+
+  void rebalance();
+
+  OperatingSystem* os_;
+  double flop_rate_;
+  double intop_rate_;
+  double mem_bw_;
+  double thread_mem_bw_;
+  double cache_reuse_;
+
+  std::map<uint64_t, ActiveCompute> active_;
+  int active_threads_;
+  uint64_t next_id_;
+  uint64_t next_token_;
+  double last_update_;
+};
+
+} // end namespace Hg
+} // end namespace SST
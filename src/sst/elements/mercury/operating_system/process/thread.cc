@@ -22,6 +22,7 @@
 #include <mercury/operating_system/process/thread.h>
 #include <mercury/operating_system/process/thread_info.h>
 #include <mercury/operating_system/process/app.h>
+#include <mercury/operating_system/threading/stack_alloc.h>
 //#include <sstmac/software/libraries/library.h>
 //#include <sstmac/software/libraries/compute/compute_event.h>
 //#include <sstmac/software/api/api.h>
@@ -159,6 +160,7 @@ Thread::Thread(SST::Params& params, SoftwareId sid, OperatingSystem* os) :
   last_bt_collect_nfxn_(0),
   bt_nfxn_(0),
   timed_out_(false),
+  stack_(nullptr),
   tls_storage_(nullptr),
   thread_id_(Thread::main_thread),
   context_(nullptr),
@@ -276,11 +278,12 @@ Thread::now()
 Thread::~Thread()
 {
   active_cores_.clear();
- // if (stack_) StackAlloc::free(stack_);
   if (context_) {
     context_->destroyContext();
     delete context_;
   }
+  //threads are only deleted from the DES thread, never while running on this stack
+  if (stack_) StackAlloc::free(stack_);
   if (tls_storage_) delete[] tls_storage_;
   //if (host_timer_) delete host_timer_;
 }
@@ -315,13 +318,13 @@ Thread::~Thread()
 //  active.parent_id = context.id;
 //}
 
-//void
-//Thread::computeDetailed(uint64_t flops, uint64_t nintops, uint64_t bytes, int nthread)
-//{
-//  omp_context& active = omp_contexts_.back();
-//  int used_nthread = nthread == use_omp_num_threads ? active.num_threads : nthread;
-//  parentApp()->computeDetailed(flops, nintops, bytes, used_nthread);
-//}
+void
+Thread::computeDetailed(uint64_t flops, uint64_t nintops, uint64_t bytes, int nthread)
+{
+  //omp contexts are not tracked yet, so the default is a single thread
+  int used_nthread = nthread == use_omp_num_threads ? 1 : nthread;
+  parentApp()->computeDetailed(flops, nintops, bytes, used_nthread);
+}
 
 //void
 //Thread::collectStats(
@@ -22,6 +22,7 @@
 #include <mercury/operating_system/threading/stack_alloc_chunk.h>
 #include <mercury/operating_system/threading/thread_lock.h>
 
+#include <sys/mman.h>
 #include <unistd.h>
 
 namespace SST {
@@ -30,7 +31,12 @@ namespace Hg {
 StackAlloc::chunk_set StackAlloc::chunks_;
 size_t StackAlloc::suggested_chunk_ = 0;
 size_t StackAlloc::stacksize_ = 0;
-bool StackAlloc::protect_stacks_ = false;
+size_t StackAlloc::guard_pages_ = 0;
+StackAlloc::release_t StackAlloc::release_ = StackAlloc::release_dontneed;
+size_t StackAlloc::in_use_ = 0;
+size_t StackAlloc::high_water_ = 0;
+
+static thread_lock stack_lock_;
 
 extern "C" {
 int sst_hg_global_stacksize = 0;
@@ -43,17 +49,49 @@ StackAlloc::init(SST::Params& params)
     return; //we are good
   }
 
+  size_t page = sysconf(_SC_PAGESIZE);
   sst_hg_global_stacksize = params.find<SST::UnitAlgebra>("stack_size", "131072B").getRoundedValue();
-  //must be a multiple of 4096
-  int stack_rem = sst_hg_global_stacksize % 4096;
+  //must be a multiple of the page size
+  int stack_rem = sst_hg_global_stacksize % page;
   if (stack_rem != 0){
-    sst_hg_global_stacksize += (4096 - stack_rem);
+    sst_hg_global_stacksize += (page - stack_rem);
   }
-  std::string chunk = Hg::sprintf("%dB", 8*sst_hg_global_stacksize);
+  //address space is cheap, so reserve plenty of stacks per chunk
+  std::string chunk = Hg::sprintf("%lluB", 64ULL*sst_hg_global_stacksize);
   suggested_chunk_ = params.find<SST::UnitAlgebra>("stack_chunk_size", chunk).getRoundedValue();
   stacksize_ = sst_hg_global_stacksize;
 
-  protect_stacks_ = params.find<bool>("protect_stacks", false);
+  //protect_stacks is the old name for turning on guard pages
+  bool protect = params.find<bool>("protect_stacks", false);
+  guard_pages_ = params.find<size_t>("stack_guard_pages", 1);
+  if (protect && guard_pages_ == 0){
+    guard_pages_ = 1;
+  }
+
+  if (stacksize_ <= (guard_pages_ + 2) * page){
+    sst_hg_abort_printf("stack_size %d must leave room for the TLS page and %d guard pages",
+                        int(stacksize_), int(guard_pages_));
+  }
+  if (suggested_chunk_ < 2 * stacksize_){
+    //leave room for aligning the first stack
+    suggested_chunk_ = 2 * stacksize_;
+  }
+
+  std::string release = params.find<std::string>("stack_release", "dontneed");
+  if (release == "none"){
+    release_ = release_none;
+  } else if (release == "dontneed"){
+    release_ = release_dontneed;
+  } else if (release == "free"){
+#ifdef MADV_FREE
+    release_ = release_free;
+#else
+    release_ = release_dontneed;
+#endif
+  } else {
+    sst_hg_abort_printf("invalid stack_release %s: must be none, dontneed, or free",
+                        release.c_str());
+  }
 }
 
 void
@@ -68,43 +106,59 @@ StackAlloc::chunk_set::clear()
   available.clear();
 }
 
-//
-// Get a stack memory region.
-//
 void*
 StackAlloc::alloc()
 {
-  static thread_lock lock;
-  lock.lock();
+  stack_lock_.lock();
   if (stacksize_ == 0) {
     sst_hg_throw_printf(ValueError, "stackalloc::stacksize was not initialized");
   }
 
-  if(chunks_.available.empty()){
-    // grab a new chunk.
-    chunk* new_chunk = new chunk(stacksize_, suggested_chunk_, protect_stacks_);
-    chunks_.allocations.push_back(new_chunk);
-    void* buf = new_chunk->getNextStack();
-    while (buf != nullptr){
-      chunks_.available.push_back(buf);
+  void* buf = nullptr;
+  if (!chunks_.available.empty()){
+    buf = chunks_.available.back();
+    chunks_.available.pop_back();
+  } else {
+    if (!chunks_.allocations.empty()){
+      buf = chunks_.allocations.back()->getNextStack();
+    }
+    if (buf == nullptr){
+      // grab a new chunk.
+      chunk* new_chunk = new chunk(stacksize_, suggested_chunk_, guard_pages_);
+      chunks_.allocations.push_back(new_chunk);
       buf = new_chunk->getNextStack();
     }
   }
-  void *buf = chunks_.available.back();
-  chunks_.available.pop_back();
-  lock.unlock();
+
+  ++in_use_;
+  if (in_use_ > high_water_){
+    high_water_ = in_use_;
+  }
+  stack_lock_.unlock();
   return buf;
 }
 
-//
-// Return the given memory region.
-//
 void StackAlloc::free(void* buf)
 {
-  static thread_lock lock; 
-  lock.lock();
+  // Keep the address range for reuse but give the pages back.  The
+  // guard pages stay protected.
+  switch (release_){
+    case release_none:
+      break;
+    case release_dontneed:
+      madvise(buf, stacksize_, MADV_DONTNEED);
+      break;
+    case release_free:
+#ifdef MADV_FREE
+      madvise(buf, stacksize_, MADV_FREE);
+#endif
+      break;
+  }
+
+  stack_lock_.lock();
   chunks_.available.push_back(buf);
-  lock.unlock();
+  --in_use_;
+  stack_lock_.unlock();
 }
 
 
@@ -26,11 +26,19 @@ namespace Hg {
 /**
  * A management type to handle dividing mmap-ed memory for use
  * as ucontext stack(s).  This is basically a very simple malloc
- * which allocates uniform-size chunks (with the NX bit unset)
- * and sets guard pages on each side of the allocated stacks.
+ * which allocates uniform-size chunks (with the NX bit unset).
  *
- * This allocator does not return memory to the system until it is
- * deleted, but regions can be allocated and free-d repeatedly.
+ * Address space is reserved a chunk at a time but a stack is only made
+ * accessible when it is first handed out.  Each stack can have guard
+ * pages just above the thread-local storage page at its base so that
+ * an overflow faults instead of corrupting TLS.
+ *
+ * The address range of a stack is never returned to the system, but
+ * when a stack is freed its pages are released with madvise so that
+ * resident memory tracks the number of live threads rather than the
+ * peak.  Every stack has the same size since thread-local storage is
+ * located by rounding the stack pointer down to a multiple of the
+ * stack size.
  */
 class StackAlloc
 {
@@ -44,14 +52,27 @@ class StackAlloc
     }
     void clear();
   };
+
+  enum release_t {
+    release_none,
+    release_dontneed,
+    release_free
+  };
+
  private:
   static chunk_set chunks_;
   /// Each chunk is of this suggested size.
   static size_t suggested_chunk_;
   /// Each stack request is of this size:
   static size_t stacksize_;
-  /// Optionally added a protected stack between each stack we return
-  static bool protect_stacks_;
+  /// Number of inaccessible pages above the TLS page of each stack
+  static size_t guard_pages_;
+  /// How the pages of a freed stack are given back to the system
+  static release_t release_;
+  /// Number of stacks currently handed out
+  static size_t in_use_;
+  /// Largest number of stacks handed out at once
+  static size_t high_water_;
 
  public:
   static size_t stacksize() {
@@ -66,6 +87,18 @@ class StackAlloc
     return suggested_chunk_;
   }
 
+  static size_t guardPages() {
+    return guard_pages_;
+  }
+
+  static size_t inUse() {
+    return in_use_;
+  }
+
+  static size_t highWater() {
+    return high_water_;
+  }
+
   static void init(SST::Params& params);
 
   static void* alloc();
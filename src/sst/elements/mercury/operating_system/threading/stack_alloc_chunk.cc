@@ -29,16 +29,19 @@ namespace Hg {
 //
 // Make a new chunk.
 //
-StackAlloc::chunk::chunk(size_t stacksize, size_t suggested_chunk_size, bool protect) :
+StackAlloc::chunk::chunk(size_t stacksize, size_t suggested_chunk_size, size_t guard_pages) :
   addr_(nullptr),
-  protect_(protect),
-  size_((protect_) ? 2 * suggested_chunk_size : suggested_chunk_size),
+  size_(suggested_chunk_size),
   stacksize_(stacksize),
-  step_size_((protect_) ? 2 * stacksize_ : stacksize_)
+  guard_pages_(guard_pages)
 {
-  // Now allocate our chunk.
+  // Only reserve the address space here.  Pages become accessible (and
+  // count against memory) as stacks are handed out and touched.
   int mmap_flags = MAP_PRIVATE | MAP_ANON;
-  addr_ = (char*)mmap(0, size_, PROT_READ | PROT_WRITE,
+#ifdef MAP_NORESERVE
+  mmap_flags |= MAP_NORESERVE;
+#endif
+  addr_ = (char*)mmap(0, size_, PROT_NONE,
                       mmap_flags, -1, 0);
   if(addr_ == MAP_FAILED) {
     cerrn << "Failed to mmap a region of size " << size_ << ": "
@@ -51,30 +54,29 @@ StackAlloc::chunk::chunk(size_t stacksize, size_t suggested_chunk_size, bool pro
   if (stack_mod != 0){ //this aligns us on boundaries
     next_stack_offset_ = stacksize_ - stack_mod;
   }
-
-  // If protected we need to mprotect the first stack and advance our offset to
-  // the end of the second stack
-  if(protect_){
-    // Start protection on the first stack
-    auto protected_offset_ = next_stack_offset_;
-    next_stack_offset_ += stacksize_; // Second stack is first usable stack
-
-    while(protected_offset_ + step_size_ < size_){
-      void *protected_address = addr_ + protected_offset_;
-      mprotect(protected_address, stacksize_, PROT_NONE);
-      protected_offset_ += step_size_;
-    }
-  }
 }
 
 void* 
 StackAlloc::chunk::getNextStack() {
-  if(next_stack_offset_ + step_size_ >= size_) {
+  if(next_stack_offset_ + stacksize_ > size_) {
     return nullptr;
   } 
 
-  void* rv = addr_ + next_stack_offset_;
-  next_stack_offset_ += step_size_;
+  char* rv = addr_ + next_stack_offset_;
+  next_stack_offset_ += stacksize_;
+
+  if (mprotect(rv, stacksize_, PROT_READ | PROT_WRITE) != 0){
+    cerrn << "Failed to mprotect a stack of size " << stacksize_ << ": "
+              << strerror(errno) << "\n";
+    SST::Hg::abort("stackalloc::chunk: failed to enable stack.");
+  }
+
+  // The first page holds thread-local storage, so the guard goes just
+  // above it where a downward-growing stack runs out
+  if (guard_pages_ > 0){
+    size_t page = sysconf(_SC_PAGESIZE);
+    mprotect(rv + page, guard_pages_ * page, PROT_NONE);
+  }
   return rv;
 }
 
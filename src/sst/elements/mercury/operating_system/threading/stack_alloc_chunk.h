@@ -25,26 +25,26 @@ namespace SST {
 namespace Hg {
 
 /**
- * A chunk of allocated memory to be divided into fixed-size stacks.
+ * A chunk of reserved address space to be divided into fixed-size stacks.
+ * The chunk is mapped without access and each stack is made accessible
+ * when it is handed out.
  */
 class StackAlloc::chunk
 {
   /// The base address of my memory region.
   char *addr_;
-  /// If true we mmap twice the requested space and mprotect every other stack
-  bool protect_;
   /// The total size of my allocation.
   size_t size_;
-  /// The target size of each open (unprotected) stack region.
+  /// The size of each stack region.
   size_t stacksize_;
-  /// When unprotected step_size = stacksize, otherwise 2x stacksize
-  size_t step_size_;
+  /// Number of inaccessible pages above the TLS page of each stack
+  size_t guard_pages_;
   /// Offset for next stack (used in get_next_stack).
   size_t next_stack_offset_ = 0;
 
  public:
   /// Make a new chunk.
-  chunk(size_t stacksize, size_t suggested_chunk_size, bool protect);
+  chunk(size_t stacksize, size_t suggested_chunk_size, size_t guard_pages);
 
   ~chunk();
 
@@ -61,7 +61,8 @@ class HgOS(TemplateBase):
 
     def __init__(self):
         TemplateBase.__init__(self)
-        self._declareParams("params",["verbose",])
+        self._declareParams("params",["verbose","peak_flops","peak_intops","mem_bandwidth",
+                                      "thread_mem_bandwidth","cache_reuse"])
         self._declareParamsWithUserPrefix("params","app1",["name","exe","apis"],"app1.")
         self._subscribeToPlatformParamSet("operating_system")        
 
@@ -0,0 +1,135 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+// Stand-alone benchmark for the completion queue structures used by
+// MultiProgressQueue. It needs no SST core and can be built with
+//   c++ -O2 -std=c++17 -I<sst-elements>/src/sst/elements progress_queue_bench.cc
+//
+// A node has many threads waiting on different completion queues. Each
+// round one message arrives on a random CQ, the first waiter on it wakes
+// up, consumes the message and goes back to waiting. The old layout
+// (std::map of std::list) is timed against IndexedQueues/WaitList.
+
+#include <mercury/operating_system/process/indexed_queues.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <list>
+#include <map>
+#include <queue>
+#include <random>
+#include <vector>
+
+struct Thread {
+  int id;
+};
+
+struct Message {
+  int cq;
+};
+
+struct MapListQueues {
+  std::map<int,std::queue<Message*>> queues;
+  std::map<int,std::list<Thread*>> pending_threads;
+
+  void wait(int cq, Thread* thr, SST::Hg::WaitList<Thread>::Node*){
+    pending_threads[cq].push_back(thr);
+  }
+
+  Thread* incoming(int cq, Message* m){
+    queues[cq].push(m);
+    return pending_threads[cq].front();
+  }
+
+  Message* wake(int cq, Thread* thr, SST::Hg::WaitList<Thread>::Node*){
+    pending_threads[cq].remove(thr);
+    Message* m = queues[cq].front();
+    queues[cq].pop();
+    return m;
+  }
+};
+
+struct IndexedCqs {
+  SST::Hg::IndexedQueues<Message,Thread> queues;
+
+  void wait(int cq, Thread*, SST::Hg::WaitList<Thread>::Node* node){
+    queues.slot(cq).waiters.push_back(node);
+  }
+
+  Thread* incoming(int cq, Message* m){
+    queues.push(cq, m);
+    return queues.slot(cq).waiters.front();
+  }
+
+  Message* wake(int cq, Thread*, SST::Hg::WaitList<Thread>::Node* node){
+    queues.slot(cq).waiters.remove(node);
+    return queues.pop(cq);
+  }
+};
+
+template <class Queues>
+double
+run(int nthreads, int ncqs, int nrounds, uint64_t& checksum)
+{
+  Queues q;
+  std::vector<Thread> threads(nthreads);
+  std::vector<int> thread_cq(nthreads);
+  std::vector<SST::Hg::WaitList<Thread>::Node> nodes;
+  nodes.reserve(nthreads);
+  for (int i=0; i < nthreads; ++i){
+    threads[i].id = i;
+    thread_cq[i] = i % ncqs;
+    nodes.emplace_back(&threads[i]);
+    q.wait(thread_cq[i], &threads[i], &nodes[i]);
+  }
+
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> pick(0, ncqs - 1);
+  Message msg;
+  auto start = std::chrono::steady_clock::now();
+  for (int r=0; r < nrounds; ++r){
+    int cq = pick(gen);
+    msg.cq = cq;
+    Thread* thr = q.incoming(cq, &msg);
+    Message* m = q.wake(cq, thr, &nodes[thr->id]);
+    checksum += thr->id + m->cq;
+    //go back to waiting on the same CQ
+    q.wait(cq, thr, &nodes[thr->id]);
+  }
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(stop - start).count();
+}
+
+int main(int argc, char** argv)
+{
+  int nthreads = argc > 1 ? atoi(argv[1]) : 4096;
+  int ncqs = argc > 2 ? atoi(argv[2]) : 16;
+  int nrounds = argc > 3 ? atoi(argv[3]) : 1000000;
+
+  uint64_t old_sum = 0, new_sum = 0;
+  double old_t = run<MapListQueues>(nthreads, ncqs, nrounds, old_sum);
+  double new_t = run<IndexedCqs>(nthreads, ncqs, nrounds, new_sum);
+  if (old_sum != new_sum){
+    fprintf(stderr, "wakeup order differs: %llu != %llu\n",
+            (unsigned long long) old_sum, (unsigned long long) new_sum);
+    return 1;
+  }
+
+  printf("threads=%d cqs=%d rounds=%d\n", nthreads, ncqs, nrounds);
+  printf("map/list : %8.3f ns/wakeup\n", old_t * 1e9 / nrounds);
+  printf("indexed  : %8.3f ns/wakeup\n", new_t * 1e9 / nrounds);
+  return 0;
+}
@@ -0,0 +1,43 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#define ssthg_app_name roofline_test
+#include <mercury/common/skeleton.h>
+#include <mercury/components/operating_system.h>
+#include <mercury/operating_system/process/thread.h>
+#include <cstdint>
+#include <cstdio>
+
+using SST::Hg::OperatingSystem;
+
+// Times one detailed compute on a single core. The expected durations
+// for the parameters in roofline_test.py are checked by the testsuite.
+static void
+kernel(const char* name, uint64_t flops, uint64_t bytes)
+{
+  double start = OperatingSystem::currentOs()->now().sec();
+  OperatingSystem::currentThread()->computeDetailed(flops, 0, bytes, 1);
+  double elapsed = OperatingSystem::currentOs()->now().sec() - start;
+  printf("%s kernel: flops=%llu bytes=%llu time=%.9f s\n", name,
+         (unsigned long long)flops, (unsigned long long)bytes, elapsed);
+}
+
+int main(int argc, char** argv) {
+  //2 s of flops, 0.01 s of memory traffic
+  kernel("compute-bound", 2000000000ull, 100000000ull);
+  //0.1 s of flops, 3 s of memory traffic
+  kernel("bandwidth-bound", 100000000ull, 30000000000ull);
+  return 0;
+}
@@ -0,0 +1,21 @@
+import sst
+import sst.hg
+
+node0 = sst.Component("Node0", "hg.node")
+node1 = sst.Component("Node1", "hg.node")
+os0 = node0.setSubComponent("os_slot", "hg.operating_system")
+os1 = node1.setSubComponent("os_slot", "hg.operating_system")
+
+link0 = sst.Link("link0")
+link0.connect( (node0,"network","1ns"), (node1,"network","1ns") )
+
+# The testsuite computes the expected kernel times from these
+roofline = { "peak_flops" : "1e9",
+             "mem_bandwidth" : "10GB/s" }
+
+os0.addParams(roofline)
+os1.addParams(roofline)
+os0.addParams({ "app1.name" : "roofline_test"})
+os1.addParams({ "app1.name" : "roofline_test"})
+os0.addParams({ "app1.exe" : "roofline_test.so"})
+os1.addParams({ "app1.exe" : "roofline_test.so"})
@@ -1,5 +1,6 @@
 # -*- coding: utf-8 -*-
 import os
+import re
 import subprocess
 
 from sst_unittest import *
@@ -20,16 +21,62 @@ class testcase_hg(SSTTestCase):
 #####
 
     def test_testme(self):
-        testdir = self.get_testsuite_dir()
+        self.add_element_lib_path()
+        self.simple_components_template("ostest")
+
+    def test_roofline(self):
+        self.add_element_lib_path()
+        self.roofline_template("roofline_test", peak_flops=1e9, mem_bandwidth=10e9)
+
+#####
+
+    # The skeleton apps are loaded from the element library directory
+    def add_element_lib_path(self):
         libdir = sstsimulator_conf_get_value_str("SST_ELEMENT_LIBRARY","SST_ELEMENT_LIBRARY_LIBDIR")
         path = os.environ.get("SST_LIB_PATH")
         if path is None or path == "":
             os.environ["SST_LIB_PATH"] = libdir
         else:
             os.environ["SST_LIB_PATH"] = path + ":" + libdir
-        self.simple_components_template("ostest")
 
-#####
+    # Each kernel printed by the app must take the roofline time,
+    # max(flops / peak_flops, bytes / mem_bandwidth), on both nodes
+    def roofline_template(self, testcase, peak_flops, mem_bandwidth):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        sdlfile = "{0}/{1}.py".format(test_path, testcase)
+        outfile = "{0}/{1}.out".format(outdir, testcase)
+        errfile = "{0}/{1}.err".format(outdir, testcase)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testcase)
+
+        self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles)
+
+        if os_test_file(errfile, "-s"):
+            log_testing_note("hg test {0} has a Non-Empty Error File {1}".format(testcase, errfile))
+
+        kernel_re = re.compile(r"^(\S+) kernel: flops=(\d+) bytes=(\d+) time=([0-9.eE+-]+) s")
+        kernels = {}
+        with open(outfile, 'r') as f:
+            for line in f:
+                m = kernel_re.match(line)
+                if m:
+                    kernels.setdefault(m.group(1), []).append(m)
+
+        self.assertEqual(sorted(kernels.keys()), ["bandwidth-bound", "compute-bound"],
+                         "Output file {0} does not report both kernels".format(outfile))
+        for name, matches in kernels.items():
+            self.assertEqual(len(matches), 2, "Expected the {0} kernel once per node in {1}".format(name, outfile))
+            for m in matches:
+                flop_time = int(m.group(2)) / peak_flops
+                mem_time = int(m.group(3)) / mem_bandwidth
+                if name == "compute-bound":
+                    self.assertGreater(flop_time, mem_time)
+                else:
+                    self.assertGreater(mem_time, flop_time)
+                expected = max(flop_time, mem_time)
+                self.assertAlmostEqual(float(m.group(4)), expected, delta=expected * 1e-6,
+                                       msg="{0} kernel took {1} s, roofline time is {2} s".format(name, m.group(4), expected))
 
     def simple_components_template(self, testcase, striptotail=0):
         # Get the path to the test files
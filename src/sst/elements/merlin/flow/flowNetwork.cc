@@ -0,0 +1,638 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+#include <sst_config.h>
+#include "flow/flowNetwork.h"
+
+#include <sst/core/params.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "merlin.h"
+
+using namespace SST::Merlin;
+using namespace SST::Interfaces;
+
+// Amount of a packet (in bits) that can be left over from floating
+// point round off and still count as fully transmitted
+static const double residual_bits = 1e-6;
+
+static UnitAlgebra getParamUA(Params& params, const std::string& name, const std::string& default_val)
+{
+    UnitAlgebra ua(params.find<std::string>(name, default_val));
+    // If units were in Bytes, convert to bits
+    if ( ua.hasUnits("B") || ua.hasUnits("B/s") ) {
+        ua *= UnitAlgebra("8b/B");
+    }
+    return ua;
+}
+
+FlowNetwork::FlowNetwork(ComponentId_t cid, Params& params) :
+    Component(cid),
+    last_update(0),
+    next_wakeup(std::numeric_limits<SimTime_t>::max()),
+    output(getSimulationOutput())
+{
+    num_ports = params.find<int>("num_ports",-1);
+    if ( num_ports <= 0 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flownet requires num_ports to be specified\n");
+    }
+
+    num_vns = params.find<int>("num_vns",-1);
+
+    if ( params.find<std::string>("link_bw") == "" ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flownet requires link_bw to be specified\n");
+    }
+    link_bw = getParamUA(params, "link_bw", "");
+    if ( !link_bw.hasUnits("b/s") ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flownet: link_bw must be specified in either b/s or B/s: %s\n",
+                           link_bw.toStringBestSI().c_str());
+    }
+    if ( link_bw.getDoubleValue() <= 0 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flownet: link_bw must be greater than zero\n");
+    }
+
+    flit_size = getParamUA(params, "flit_size", "8B");
+    if ( !flit_size.hasUnits("b") ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flownet: flit_size must be specified in either b or B: %s\n",
+                           flit_size.toStringBestSI().c_str());
+    }
+
+    UnitAlgebra input_buf_size = getParamUA(params, "input_buf_size", "16kB");
+    if ( !input_buf_size.hasUnits("b") ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flownet: input_buf_size must be specified in either b or B: %s\n",
+                           input_buf_size.toStringBestSI().c_str());
+    }
+    input_buf_flits = (input_buf_size / flit_size).getRoundedValue();
+    if ( input_buf_flits <= 0 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flownet: input_buf_size must be at least one flit\n");
+    }
+
+    UnitAlgebra fabric_bw = getParamUA(params, "fabric_bw", "0b/s");
+    if ( !fabric_bw.hasUnits("b/s") ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flownet: fabric_bw must be specified in either b/s or B/s: %s\n",
+                           fabric_bw.toStringBestSI().c_str());
+    }
+    // Rates are kept in bits per ps
+    fabric_rate = fabric_bw.getDoubleValue() / 1e12;
+
+    UnitAlgebra latency(params.find<std::string>("latency","100ns"));
+    if ( !latency.hasUnits("s") ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flownet: latency must be specified in units of time: %s\n",
+                           latency.toStringBestSI().c_str());
+    }
+    latency_ps = llround(latency.getDoubleValue() * 1e12);
+
+    UnitAlgebra hop_latency(params.find<std::string>("hop_latency","0ns"));
+    if ( !hop_latency.hasUnits("s") ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flownet: hop_latency must be specified in units of time: %s\n",
+                           hop_latency.toStringBestSI().c_str());
+    }
+    hop_latency_ps = llround(hop_latency.getDoubleValue() * 1e12);
+
+    // Router graph of the topology being modeled
+    num_routers = params.find<int>("num_routers",0);
+    num_router_links = 0;
+    if ( num_routers < 0 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flownet: num_routers must not be negative\n");
+    }
+    if ( num_routers > 0 ) {
+        params.find_array<int>("endpoint_router", endpoint_router);
+        if ( endpoint_router.size() != (size_t)num_ports ) {
+            merlin_abort.fatal(CALL_INFO, -1, "flownet: endpoint_router has %zu entries, expected one per port (%d)\n",
+                               endpoint_router.size(), num_ports);
+        }
+        for ( int i = 0; i < num_ports; ++i ) {
+            if ( endpoint_router[i] < 0 || endpoint_router[i] >= num_routers ) {
+                merlin_abort.fatal(CALL_INFO, -1, "flownet: endpoint %d is attached to invalid router %d\n",
+                                   i, endpoint_router[i]);
+            }
+        }
+
+        std::vector<int> links;
+        params.find_array<int>("router_links", links);
+        if ( links.size() % 2 != 0 ) {
+            merlin_abort.fatal(CALL_INFO, -1, "flownet: router_links must hold pairs of routers\n");
+        }
+        router_adj.resize(num_routers);
+        router_dist.resize(num_routers);
+        for ( size_t i = 0; i < links.size(); i += 2 ) {
+            int a = links[i];
+            int b = links[i+1];
+            if ( a < 0 || a >= num_routers || b < 0 || b >= num_routers || a == b ) {
+                merlin_abort.fatal(CALL_INFO, -1, "flownet: invalid router link %d-%d\n", a, b);
+            }
+            // One resource per direction
+            router_adj[a].push_back(std::make_pair(b, num_router_links++));
+            router_adj[b].push_back(std::make_pair(a, num_router_links++));
+        }
+    }
+
+    ps_tc = getTimeConverter("1ps");
+
+    ports.resize(num_ports);
+    for ( int i = 0; i < num_ports; ++i ) {
+        std::string port_name("port");
+        port_name += std::to_string(i);
+        ports[i] = configureLink(port_name, "1ps", new Event::Handler<FlowNetwork,int>(this,&FlowNetwork::handle_input,i));
+        if ( ports[i] == nullptr ) {
+            merlin_abort.fatal(CALL_INFO, -1, "flownet: %s is not connected\n", port_name.c_str());
+        }
+    }
+    timer_link = configureSelfLink("flow_timer", "1ps", new Event::Handler<FlowNetwork>(this,&FlowNetwork::handle_timer));
+
+    link_rate = link_bw.getDoubleValue() / 1e12;
+    port_rate.resize(num_ports, link_rate);
+    port_vns.resize(num_ports, 0);
+    credits_sent.resize(num_ports, false);
+    eject_credits.resize(num_ports);
+    eject_wait.resize(num_ports);
+
+    int num_resources = 2 * num_ports + 1 + num_router_links;
+    res_remaining.resize(num_resources, 0);
+    res_count.resize(num_resources, 0);
+
+    packets_delivered = registerStatistic<uint64_t>("packets_delivered");
+    flows_started = registerStatistic<uint64_t>("flows_started");
+    rate_updates = registerStatistic<uint64_t>("rate_updates");
+    ejection_stalls = registerStatistic<uint64_t>("ejection_stalls");
+}
+
+FlowNetwork::~FlowNetwork()
+{
+    for ( auto& entry : flows ) {
+        for ( auto ev : entry.second.packets ) delete ev;
+    }
+    for ( auto& port : eject_wait ) {
+        for ( auto& vn : port ) {
+            for ( auto& pending : vn ) delete pending.ev;
+        }
+    }
+}
+
+RtrInitEvent*
+FlowNetwork::checkInitEvent(Event* ev, RtrInitEvent::Commands command, int port)
+{
+    RtrInitEvent* init_ev = dynamic_cast<RtrInitEvent*>(ev);
+    if ( init_ev == nullptr || init_ev->command != command ) {
+        merlin_abort.fatal(CALL_INFO, 1, "flownet: error during initialization on port %d.  "
+                           "Only endpoints using the merlin link protocol can be connected to flownet.\n", port);
+    }
+    return init_ev;
+}
+
+void
+FlowNetwork::init(unsigned int phase)
+{
+    Event* ev;
+    RtrInitEvent* init_ev;
+
+    switch ( phase ) {
+    case 0:
+        // Look like the host port of a router to each endpoint
+        for ( int i = 0; i < num_ports; ++i ) {
+            init_ev = new RtrInitEvent();
+            init_ev->command = RtrInitEvent::REPORT_BW;
+            init_ev->ua_value = link_bw;
+            ports[i]->sendUntimedData(init_ev);
+
+            init_ev = new RtrInitEvent();
+            init_ev->command = RtrInitEvent::REPORT_FLIT_SIZE;
+            init_ev->ua_value = flit_size;
+            ports[i]->sendUntimedData(init_ev);
+
+            init_ev = new RtrInitEvent();
+            init_ev->command = RtrInitEvent::REPORT_ID;
+            init_ev->int_value = i;
+            ports[i]->sendUntimedData(init_ev);
+        }
+        break;
+    case 1:
+        for ( int i = 0; i < num_ports; ++i ) {
+            // Each injection/ejection link runs at the min of the two
+            // link speeds
+            ev = ports[i]->recvUntimedData();
+            init_ev = checkInitEvent(ev, RtrInitEvent::REPORT_BW, i);
+            UnitAlgebra bw = init_ev->ua_value;
+            if ( bw < link_bw ) port_rate[i] = bw.getDoubleValue() / 1e12;
+            if ( port_rate[i] <= 0 ) {
+                merlin_abort.fatal(CALL_INFO, 1, "flownet: endpoint on port %d reported a link bandwidth of %s\n",
+                                   i, bw.toStringBestSI().c_str());
+            }
+            delete ev;
+
+            ev = ports[i]->recvUntimedData();
+            init_ev = checkInitEvent(ev, RtrInitEvent::REQUEST_VNS, i);
+            int req_vns = init_ev->int_value;
+            delete ev;
+
+            port_vns[i] = num_vns == -1 ? req_vns : num_vns;
+            eject_credits[i].resize(port_vns[i], 0);
+            eject_wait[i].resize(port_vns[i]);
+
+            // Report the number of VNs, then an identity VN mapping
+            init_ev = new RtrInitEvent();
+            init_ev->command = RtrInitEvent::REQUEST_VNS;
+            init_ev->int_value = port_vns[i];
+            ports[i]->sendUntimedData(init_ev);
+
+            for ( int j = 0; j < req_vns; ++j ) {
+                init_ev = new RtrInitEvent();
+                init_ev->command = RtrInitEvent::REQUEST_VNS;
+                init_ev->int_value = j;
+                ports[i]->sendUntimedData(init_ev);
+            }
+        }
+        break;
+    default:
+        for ( int i = 0; i < num_ports; ++i ) {
+            // Endpoints get a fixed amount of credit per VN, which is
+            // returned once a packet has been delivered
+            if ( !credits_sent[i] ) {
+                for ( int j = 0; j < port_vns[i]; ++j ) {
+                    ports[i]->sendUntimedData(new credit_event(j,input_buf_flits));
+                }
+                credits_sent[i] = true;
+            }
+
+            while ( ( ev = ports[i]->recvUntimedData() ) != nullptr ) {
+                BaseRtrEvent* bev = static_cast<BaseRtrEvent*>(ev);
+                if ( bev->getType() == BaseRtrEvent::PACKET ) {
+                    routeUntimed(i, static_cast<RtrEvent*>(ev));
+                }
+                else if ( bev->getType() == BaseRtrEvent::CREDIT ) {
+                    // Input buffer space of the endpoint
+                    returnEjectCredits(i, static_cast<credit_event*>(ev));
+                }
+                else {
+                    delete ev;
+                }
+            }
+        }
+        break;
+    }
+}
+
+void
+FlowNetwork::complete(unsigned int phase)
+{
+    Event* ev;
+    for ( int i = 0; i < num_ports; ++i ) {
+        while ( ( ev = ports[i]->recvUntimedData() ) != nullptr ) {
+            BaseRtrEvent* bev = static_cast<BaseRtrEvent*>(ev);
+            if ( bev->getType() == BaseRtrEvent::PACKET ) {
+                routeUntimed(i, static_cast<RtrEvent*>(ev));
+            }
+            else if ( bev->getType() == BaseRtrEvent::CREDIT ) {
+                returnEjectCredits(i, static_cast<credit_event*>(ev));
+            }
+            else {
+                delete ev;
+            }
+        }
+    }
+}
+
+void
+FlowNetwork::setup()
+{
+    last_update = getCurrentSimTime(ps_tc);
+}
+
+void
+FlowNetwork::finish()
+{
+}
+
+void
+FlowNetwork::routeUntimed(int src, RtrEvent* ev)
+{
+    if ( ev->getDest() == UNTIMED_BROADCAST_ADDR ) {
+        for ( int i = 0; i < num_ports; ++i ) {
+            if ( i != src ) ports[i]->sendUntimedData(ev->clone());
+        }
+        delete ev;
+        return;
+    }
+
+    if ( ev->getDest() < 0 || ev->getDest() >= (SimpleNetwork::nid_t)num_ports ) {
+        merlin_abort.fatal(CALL_INFO, 1, "flownet: untimed packet from port %d has invalid destination %" PRI_NID "\n",
+                           src, ev->getDest());
+    }
+    ports[ev->getDest()]->sendUntimedData(ev);
+}
+
+void
+FlowNetwork::handle_input(Event* ev, int port)
+{
+    BaseRtrEvent* bev = static_cast<BaseRtrEvent*>(ev);
+    if ( bev->getType() == BaseRtrEvent::PACKET ) {
+        addPacket(port, static_cast<RtrEvent*>(ev));
+    }
+    else if ( bev->getType() == BaseRtrEvent::CREDIT ) {
+        returnEjectCredits(port, static_cast<credit_event*>(ev));
+    }
+    else {
+        // Congestion control messages have no meaning in the flow
+        // model
+        delete ev;
+    }
+}
+
+void
+FlowNetwork::addPacket(int src, RtrEvent* ev)
+{
+    SimpleNetwork::nid_t dst = ev->getDest();
+    if ( dst < 0 || dst >= (SimpleNetwork::nid_t)num_ports ) {
+        merlin_abort.fatal(CALL_INFO, 1, "flownet: packet from port %d has invalid destination %" PRI_NID "\n",
+                           src, dst);
+    }
+
+    uint64_t key = (uint64_t)src * num_ports + dst;
+    Flow& flow = flows[key];
+    if ( flow.src == -1 ) {
+        flow.src = src;
+        flow.dst = dst;
+        routeFlow(flow);
+    }
+
+    flow.packets.push_back(ev);
+    if ( flow.active ) return;
+
+    // A new flow changes the bandwidth share of every flow it shares
+    // a resource with.  Bring everything up to date before
+    // recomputing rates.
+    SimTime_t now = getCurrentSimTime(ps_tc);
+    advance(now);
+
+    flow.active = true;
+    flow.head_remaining = std::max(ev->getSizeInBits(), 1);
+    active_flows.push_back(&flow);
+    flows_started->addData(1);
+
+    computeRates();
+    scheduleWakeup(now);
+}
+
+void
+FlowNetwork::routeFlow(Flow& flow)
+{
+    flow.resources.push_back(flow.src);
+
+    if ( num_routers > 0 ) {
+        int rtr = endpoint_router[flow.src];
+        int dst_rtr = endpoint_router[flow.dst];
+        const std::vector<int>& dist = distanceTo(dst_rtr);
+        if ( dist[rtr] < 0 ) {
+            merlin_abort.fatal(CALL_INFO, 1, "flownet: no path from router %d to router %d\n", rtr, dst_rtr);
+        }
+
+        // Follow a minimal path.  Where several links lead one hop
+        // closer, pick one from the flow's endpoints so that flows
+        // between different pairs spread over them.
+        uint64_t spread = (uint64_t)flow.src * 0x9E3779B1u + (uint64_t)flow.dst;
+        while ( rtr != dst_rtr ) {
+            int choices = 0;
+            for ( auto& next : router_adj[rtr] ) {
+                if ( dist[next.first] == dist[rtr] - 1 ) choices++;
+            }
+            int pick = (spread + flow.hops) % choices;
+            for ( auto& next : router_adj[rtr] ) {
+                if ( dist[next.first] != dist[rtr] - 1 ) continue;
+                if ( pick-- == 0 ) {
+                    flow.resources.push_back(2 * num_ports + 1 + next.second);
+                    rtr = next.first;
+                    break;
+                }
+            }
+            flow.hops++;
+        }
+    }
+
+    flow.resources.push_back(num_ports + flow.dst);
+    if ( fabric_rate > 0 && flow.src != flow.dst ) {
+        flow.resources.push_back(2 * num_ports);
+    }
+}
+
+const std::vector<int>&
+FlowNetwork::distanceTo(int router)
+{
+    std::vector<int>& dist = router_dist[router];
+    if ( !dist.empty() ) return dist;
+
+    // Links are bidirectional, so a breadth first search from the
+    // destination gives the distance from every router to it
+    dist.resize(num_routers, -1);
+    std::deque<int> search;
+    dist[router] = 0;
+    search.push_back(router);
+    while ( !search.empty() ) {
+        int rtr = search.front();
+        search.pop_front();
+        for ( auto& next : router_adj[rtr] ) {
+            if ( dist[next.first] != -1 ) continue;
+            dist[next.first] = dist[rtr] + 1;
+            search.push_back(next.first);
+        }
+    }
+    return dist;
+}
+
+bool
+FlowNetwork::advance(SimTime_t now)
+{
+    double elapsed = now - last_update;
+    last_update = now;
+
+    bool changed = false;
+    for ( auto flow : active_flows ) {
+        flow->head_remaining -= flow->rate * elapsed;
+        while ( flow->head_remaining <= residual_bits ) {
+            RtrEvent* ev = flow->packets.front();
+            flow->packets.pop_front();
+            eject(flow->src, flow->dst, flow->hops, ev);
+
+            if ( flow->packets.empty() ) {
+                flow->active = false;
+                flow->rate = 0;
+                changed = true;
+                break;
+            }
+            // Any progress past the end of the last packet carries
+            // over to the next one
+            flow->head_remaining += std::max(flow->packets.front()->getSizeInBits(), 1);
+        }
+    }
+
+    if ( changed ) {
+        size_t count = 0;
+        for ( size_t i = 0; i < active_flows.size(); ++i ) {
+            if ( active_flows[i]->active ) active_flows[count++] = active_flows[i];
+        }
+        active_flows.resize(count);
+    }
+    return changed;
+}
+
+void
+FlowNetwork::eject(int src, int dst, int hops, RtrEvent* ev)
+{
+    int vn = ev->getRouteVN();
+    if ( vn < 0 || vn >= port_vns[dst] ) {
+        merlin_abort.fatal(CALL_INFO, 1, "flownet: packet from port %d to port %d uses VN %d, but port %d has %d VNs\n",
+                           src, dst, vn, dst, port_vns[dst]);
+    }
+
+    // Packets to the same destination VN are delivered in order
+    std::deque<PendingEject>& wait = eject_wait[dst][vn];
+    if ( wait.empty() && eject_credits[dst][vn] >= ev->getSizeInFlits() ) {
+        deliver(src, dst, hops, ev);
+        return;
+    }
+
+    PendingEject pending = { src, hops, ev };
+    wait.push_back(pending);
+    ejection_stalls->addData(1);
+}
+
+void
+FlowNetwork::deliver(int src, int dst, int hops, RtrEvent* ev)
+{
+    int vn = ev->getRouteVN();
+    int flits = ev->getSizeInFlits();
+    eject_credits[dst][vn] -= flits;
+    ports[dst]->send(latency_ps + hops * hop_latency_ps, ev);
+    // The packet no longer occupies the network, so return the
+    // buffer space to the source
+    ports[src]->send(0, new credit_event(vn, flits));
+    packets_delivered->addData(1);
+}
+
+void
+FlowNetwork::returnEjectCredits(int port, credit_event* ce)
+{
+    int vn = ce->vc;
+    if ( vn < 0 || vn >= port_vns[port] ) {
+        merlin_abort.fatal(CALL_INFO, 1, "flownet: credits for invalid VN %d received on port %d\n", vn, port);
+    }
+    eject_credits[port][vn] += ce->credits;
+    delete ce;
+
+    std::deque<PendingEject>& wait = eject_wait[port][vn];
+    while ( !wait.empty() && eject_credits[port][vn] >= wait.front().ev->getSizeInFlits() ) {
+        PendingEject pending = wait.front();
+        wait.pop_front();
+        deliver(pending.src, port, pending.hops, pending.ev);
+    }
+}
+
+void
+FlowNetwork::computeRates()
+{
+    rate_updates->addData(1);
+
+    // Max-min fair allocation by progressive filling: raise the rate
+    // of all unfrozen flows equally until some resource saturates,
+    // then freeze every flow that uses it.  res_count is zero for all
+    // resources between calls.
+    res_touched.clear();
+    for ( auto flow : active_flows ) {
+        flow->frozen = false;
+        flow->rate = 0;
+        for ( auto res : flow->resources ) {
+            if ( res_count[res] == 0 ) {
+                res_remaining[res] = resourceCapacity(res);
+                res_touched.push_back(res);
+            }
+            res_count[res]++;
+        }
+    }
+
+    size_t unfrozen = active_flows.size();
+    while ( unfrozen > 0 ) {
+        double share = std::numeric_limits<double>::max();
+        for ( auto res : res_touched ) {
+            if ( res_count[res] > 0 ) share = std::min(share, res_remaining[res] / res_count[res]);
+        }
+
+        for ( auto res : res_touched ) {
+            if ( res_count[res] > 0 ) res_remaining[res] -= share * res_count[res];
+        }
+
+        for ( auto flow : active_flows ) {
+            if ( flow->frozen ) continue;
+            flow->rate += share;
+        }
+
+        for ( auto flow : active_flows ) {
+            if ( flow->frozen ) continue;
+            bool saturated = false;
+            for ( auto res : flow->resources ) {
+                if ( res_remaining[res] <= resourceCapacity(res) * 1e-9 ) saturated = true;
+            }
+            if ( saturated ) {
+                flow->frozen = true;
+                unfrozen--;
+                for ( auto res : flow->resources ) {
+                    res_count[res]--;
+                }
+            }
+        }
+    }
+}
+
+void
+FlowNetwork::scheduleWakeup(SimTime_t now)
+{
+    if ( active_flows.empty() ) {
+        next_wakeup = std::numeric_limits<SimTime_t>::max();
+        return;
+    }
+
+    // Wake up when the first head packet finishes transmission.
+    // Flows that did not get any bandwidth make no progress until the
+    // rates are recomputed, so they never determine the wakeup.
+    double min_time = std::numeric_limits<double>::max();
+    for ( auto flow : active_flows ) {
+        if ( flow->rate <= 0 ) continue;
+        double time = flow->head_remaining / flow->rate;
+        if ( time < min_time ) min_time = time;
+    }
+    if ( min_time >= (double)(std::numeric_limits<SimTime_t>::max() / 2) ) {
+        next_wakeup = std::numeric_limits<SimTime_t>::max();
+        return;
+    }
+
+    SimTime_t delay = std::max((SimTime_t)std::ceil(min_time), (SimTime_t)1);
+    SimTime_t wakeup = now + delay;
+    if ( wakeup == next_wakeup ) return;
+
+    // Any previously scheduled wakeup is now stale and will be ignored
+    next_wakeup = wakeup;
+    timer_link->send(delay, nullptr);
+}
+
+void
+FlowNetwork::handle_timer(Event* ev)
+{
+    SimTime_t now = getCurrentSimTime(ps_tc);
+    if ( now != next_wakeup ) return;
+    next_wakeup = std::numeric_limits<SimTime_t>::max();
+
+    if ( advance(now) ) computeRates();
+    scheduleWakeup(now);
+}
@@ -0,0 +1,204 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_FLOW_FLOWNETWORK_H
+#define COMPONENTS_MERLIN_FLOW_FLOWNETWORK_H
+
+#include <sst/core/component.h>
+#include <sst/core/event.h>
+#include <sst/core/link.h>
+#include <sst/core/output.h>
+#include <sst/core/timeConverter.h>
+#include <sst/core/unitAlgebra.h>
+
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+#include "sst/elements/merlin/router.h"
+
+namespace SST {
+namespace Merlin {
+
+/*
+ * Flow-level network model.
+ *
+ * All endpoints connect directly to this component, which speaks the
+ * same link protocol as a router host port, so existing LinkControl
+ * based endpoints work unchanged.  Packets between a source and
+ * destination are aggregated into a flow.  Each flow follows a
+ * minimal path through the router graph of the topology being
+ * modeled and active flows share the injection link of the source,
+ * every router-to-router link on their path, the ejection link of the
+ * destination and (optionally) a fabric-wide capacity using max-min
+ * fair allocation.  Rates are only recomputed when a flow starts or
+ * finishes.  A packet is handed to its destination once the flow has
+ * transmitted all of its bits and the destination has buffer space
+ * for it, plus a fixed latency and a per-hop latency.  The source
+ * gets its credits back only when the packet is delivered, so the
+ * data a source can have in the network is bounded by input_buf_size.
+ */
+class FlowNetwork : public Component {
+
+public:
+
+    SST_ELI_REGISTER_COMPONENT(
+        FlowNetwork,
+        "merlin",
+        "flownet",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Flow-level network model using max-min fair bandwidth sharing",
+        COMPONENT_CATEGORY_NETWORK)
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"num_ports",          "Number of endpoints connected to the network."},
+        {"link_bw",            "Bandwidth of the injection and ejection links specified in either b/s or B/s (can include SI prefix)."},
+        {"fabric_bw",          "Aggregate bandwidth available to traffic between different endpoints specified in either b/s or B/s.  0 means the fabric is not a bottleneck.", "0b/s"},
+        {"flit_size",          "Flit size specified in either b or B (can include SI prefix).", "8B"},
+        {"input_buf_size",     "Amount of data each endpoint can have in the network per VN, specified in b or B (can include SI prefix).", "16kB"},
+        {"latency",            "Fixed latency added to every packet once it has been transmitted.", "100ns"},
+        {"hop_latency",        "Latency added to every packet for each router-to-router link on its path.", "0ns"},
+        {"num_vns",            "Number of VNs.  If -1, each endpoint gets the number of VNs it requests.", "-1"},
+        {"num_routers",        "Number of routers in the modeled topology.  0 means no router graph is given and flows only contend for injection, ejection and fabric bandwidth.", "0"},
+        {"endpoint_router",    "Array with the router each endpoint is attached to.  Required if num_routers is not 0.", ""},
+        {"router_links",       "Array of router pairs, one pair per bidirectional router-to-router link.  Each direction runs at link_bw.", ""}
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        { "packets_delivered",  "Number of packets delivered to endpoints", "packets", 1},
+        { "flows_started",      "Number of times a flow between two endpoints became active", "flows", 1},
+        { "rate_updates",       "Number of times flow rates were recomputed", "updates", 1},
+        { "ejection_stalls",    "Number of packets that had to wait for buffer space at their destination", "packets", 1}
+    )
+
+    SST_ELI_DOCUMENT_PORTS(
+        {"port%(num_ports)d",  "Ports which connect to endpoints.", { "merlin.RtrEvent", "merlin.credit_event" } }
+    )
+
+    FlowNetwork(ComponentId_t cid, Params& params);
+    ~FlowNetwork();
+
+    void init(unsigned int phase);
+    void complete(unsigned int phase);
+    void setup();
+    void finish();
+
+private:
+
+    struct Flow {
+        int src;
+        int dst;
+        std::deque<RtrEvent*> packets;
+        // Bits of the front packet that have not been transmitted yet
+        double head_remaining;
+        // Current rate in bits per ps
+        double rate;
+        bool active;
+        bool frozen;
+        // Injection, path links, ejection and fabric resources
+        std::vector<int> resources;
+        int hops;
+
+        Flow() : src(-1), dst(-1), head_remaining(0), rate(0), active(false), frozen(false), hops(0) {}
+    };
+
+    // Packet that has been transmitted but is waiting for buffer
+    // space at its destination
+    struct PendingEject {
+        int src;
+        int hops;
+        RtrEvent* ev;
+    };
+
+    int num_ports;
+    int num_vns;
+    std::vector<Link*> ports;
+    Link* timer_link;
+    TimeConverter* ps_tc;
+
+    UnitAlgebra link_bw;
+    UnitAlgebra flit_size;
+    int input_buf_flits;
+    SimTime_t latency_ps;
+    SimTime_t hop_latency_ps;
+
+    // Router graph.  router_adj holds (neighbor, directed link) pairs
+    // and router_dist[r] the hop count from every router to r,
+    // computed the first time r is a destination
+    int num_routers;
+    std::vector<int> endpoint_router;
+    std::vector<std::vector<std::pair<int,int> > > router_adj;
+    std::vector<std::vector<int> > router_dist;
+    int num_router_links;
+
+    // Capacities in bits per ps.  Resources are numbered injection
+    // (0..num_ports-1), ejection (num_ports..2*num_ports-1), fabric
+    // (2*num_ports) and directed router links (2*num_ports+1..)
+    std::vector<double> port_rate;
+    double fabric_rate;
+    double link_rate;
+    std::vector<double> res_remaining;
+    std::vector<int> res_count;
+    std::vector<int> res_touched;
+
+    std::unordered_map<uint64_t,Flow> flows;
+    std::vector<Flow*> active_flows;
+
+    SimTime_t last_update;
+    SimTime_t next_wakeup;
+
+    std::vector<int> port_vns;
+    std::vector<bool> credits_sent;
+
+    // Buffer space, in flits, each endpoint has advertised per VN and
+    // the packets waiting for it
+    std::vector<std::vector<int> > eject_credits;
+    std::vector<std::vector<std::deque<PendingEject> > > eject_wait;
+
+    Statistic<uint64_t>* packets_delivered;
+    Statistic<uint64_t>* flows_started;
+    Statistic<uint64_t>* rate_updates;
+    Statistic<uint64_t>* ejection_stalls;
+
+    Output& output;
+
+    void handle_input(Event* ev, int port);
+    void handle_timer(Event* ev);
+
+    void routeUntimed(int src, RtrEvent* ev);
+    void addPacket(int src, RtrEvent* ev);
+    void routeFlow(Flow& flow);
+    const std::vector<int>& distanceTo(int router);
+    bool advance(SimTime_t now);
+    void computeRates();
+    void scheduleWakeup(SimTime_t now);
+    void eject(int src, int dst, int hops, RtrEvent* ev);
+    void deliver(int src, int dst, int hops, RtrEvent* ev);
+    void returnEjectCredits(int port, credit_event* ce);
+    RtrInitEvent* checkInitEvent(Event* ev, RtrInitEvent::Commands command, int port);
+
+    double resourceCapacity(int res) const {
+        if ( res < num_ports ) return port_rate[res];
+        if ( res < 2 * num_ports ) return port_rate[res - num_ports];
+        if ( res == 2 * num_ports ) return fabric_rate;
+        return link_rate;
+    }
+};
+
+}
+}
+
+#endif // COMPONENTS_MERLIN_FLOW_FLOWNETWORK_H
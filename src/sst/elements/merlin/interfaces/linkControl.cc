@@ -20,6 +20,8 @@
 
 #include <sst/core/output.h>
 
+#include <algorithm>
+
 #include "merlin.h"
 
 namespace SST {
@@ -32,7 +34,7 @@ LinkControl::LinkControl(ComponentId_t cid, Params &params, int vns) :
     rtr_link(nullptr), output_timing(nullptr), congestion_timing(nullptr),
     req_vns(vns), used_vns(0), total_vns(0), vn_out_map(nullptr),
     vn_remap_out(nullptr), output_queues(nullptr), router_credits(nullptr),
-    router_return_credits(nullptr), input_queues(nullptr),
+    router_return_credits(nullptr), router_queued_events(nullptr), credit_return_threshold(1), input_queues(nullptr),
     id(-1), logical_nid(-1), use_nid_map(false), job_id(0),
     curr_out_vn(0), waiting(true), have_packets(false), start_block(0),
     idle_start(0), is_idle(true),
@@ -66,6 +68,11 @@ LinkControl::LinkControl(ComponentId_t cid, Params &params, int vns) :
     }
     if ( outbuf_size.hasUnits("B") ) outbuf_size *= UnitAlgebra("8b/B");
 
+    credit_return_threshold = params.find<int>("credit_return_threshold",1);
+    if ( credit_return_threshold < 1 ) {
+        merlin_abort.fatal(CALL_INFO,-1,"credit_return_threshold must be at least 1\n");
+    }
+
     // Configure the links
     // For now give it a fake timebase.  Will give it the real timebase during init
 
@@ -159,6 +166,7 @@ LinkControl::~LinkControl()
     delete [] output_queues;
     delete [] router_credits;
     delete [] router_return_credits;
+    delete [] router_queued_events;
     delete [] input_queues;
 }
 
@@ -279,12 +287,20 @@ void LinkControl::init(unsigned int phase)
         // Initialize the output tracking arrays that are size
         // total_vns
         router_return_credits = new int[total_vns];
+        router_queued_events = new int[total_vns];
         router_credits = new int[total_vns];
         for ( int i = 0; i < total_vns; ++i ) {
             router_return_credits[i] = 0;
+            router_queued_events[i] = 0;
             router_credits[i] = 0;
         }
 
+        // Flit size is now known.  Holding back more than half the
+        // buffer would throttle the router at saturation, so cap the
+        // coalescing window there
+        credit_return_threshold = std::min(credit_return_threshold,
+                                           std::max(1, (int)(inbuf_size / flit_size_ua).getRoundedValue() / 2));
+
 
         int* vn_count = new int[total_vns];
         for ( int i = 0; i < total_vns; ++i ) vn_count[i] = 0;
@@ -483,17 +499,26 @@ SST::Interfaces::SimpleNetwork::Request* LinkControl::recv(int vn) {
     RtrEvent* event = input_queues[vn].front();
     input_queues[vn].pop();
 
-    // Figure out how many credits to return
+    // Figure out how many credits to return.  Credits belong to the
+    // network VN the event arrived on, which several logical VNs may
+    // share
     int flits = event->getSizeInFlits();
-    router_return_credits[vn] += flits;
+    int route_vn = event->getRouteVN();
+    router_return_credits[route_vn] += flits;
+    router_queued_events[route_vn]--;
 
     // For now, we're just going to send the credits back to the
     // other side.  The required BW to do this will not be taken
     // into account.
     // rtr_link->send(1,new credit_event(event->request->vn,in_ret_credits[event->request->vn]));
     // in_ret_credits[event->request->vn] = 0;
-    rtr_link->send(1,new credit_event(event->getRouteVN(),router_return_credits[vn]));
-    router_return_credits[vn] = 0;
+    // Credits are coalesced until the threshold is reached or no
+    // more events from that network VN are queued, so the router is
+    // never left waiting on credits we are holding.
+    if ( router_return_credits[route_vn] >= credit_return_threshold || router_queued_events[route_vn] == 0 ) {
+        rtr_link->send(1,new credit_event(route_vn,router_return_credits[route_vn]));
+        router_return_credits[route_vn] = 0;
+    }
 
     if ( event->getTraceType() != SimpleNetwork::Request::NONE ) {
         output.output("TRACE(%d): %" PRIu64 " ns: recv called on LinkControl in NIC: %s\n",event->getTraceID(),
@@ -601,6 +626,7 @@ void LinkControl::handle_input(Event* ev)
         // event->request->vn = orig_vn;
 
         input_queues[vn].push(event);
+        router_queued_events[event->getRouteVN()]++;
         if (is_idle) {
             idle_time->addData(getCurrentSimCycle() - idle_start);
             is_idle = false;
@@ -69,6 +69,8 @@ public:
         {"use_nid_remap",      "If true, will remap logical nids in job to physical ids", "false" },
         {"nid_map_name",       "Base name of shared region where my NID map will be located.  If empty, no NID map will be used.",""},
         {"vn_remap",           "Remap VNs onto/off of the network.  If empty, no vn remapping is done", "" },
+        {"credit_return_threshold", "Number of flits of credit to accumulate per network VN before sending a credit event.  Credits are always "
+         "returned when no more events from that network VN are queued.  Values larger than half the input buffer are reduced to half the input buffer.", "1" },
 
     )
 
@@ -144,6 +146,11 @@ private:
     // Holds the credits to return to the router for my input buffers.
     // Size is total_vns.
     int* router_return_credits;
+    // Events received on each network VN that are still in the input
+    // queues.  Size is total_vns.
+    int* router_queued_events;
+    // Minimum credits to coalesce into a single credit_event
+    int credit_return_threshold;
 
     // Input queues.  Size is req_vn
     network_queue_t* input_queues;
@@ -17,6 +17,8 @@
 #include "portControl.h"
 #include "merlin.h"
 
+#include <algorithm>
+
 #include "output_arb_basic.h"
 #include "output_arb_qos_multi.h"
 
@@ -135,9 +137,13 @@ PortControl::recv(int vc)
 
 	// For now, we're just going to send the credits back to the
 	// other side.  The required BW to do this will not be taken
-	// into account.
-	port_link->send(1,new credit_event(vc_return,port_ret_credits[vc_return]));
-	port_ret_credits[vc_return] = 0;
+	// into account.  Credits are coalesced until the threshold is
+	// reached or the VC drains, so the sender can never be left
+	// waiting on credits we are holding.
+    if ( port_ret_credits[vc_return] >= credit_return_threshold || input_buf[vc].empty() ) {
+        port_link->send(1,new credit_event(vc_return,port_ret_credits[vc_return]));
+        port_ret_credits[vc_return] = 0;
+    }
 
 #if TRACK
     if ( rtr_id == TRACK_ID && port_number == TRACK_PORT ) {
@@ -237,6 +243,7 @@ PortControl::PortControl(ComponentId_t cid, Params& params,  Router* rif, int rt
     output_buf_count(NULL),
     port_ret_credits(NULL),
     port_out_credits(NULL),
+    credit_return_threshold(1),
     idle_start(0),
 	sai_win_start(0),
 	sai_port_disabled(false),
@@ -289,6 +296,12 @@ PortControl::PortControl(ComponentId_t cid, Params& params,  Router* rif, int rt
         flit_size *= UnitAlgebra("8b");
     }
 
+    // Credit return coalescing; clamped to the input buffer size in initVCs()
+    credit_return_threshold = params.find<int>("credit_return_threshold",1);
+    if ( credit_return_threshold < 1 ) {
+        merlin_abort.fatal(CALL_INFO,-1,"PortControl: credit_return_threshold must be at least 1\n");
+    }
+
     std::string output_latency_timebase = params.find<std::string>("output_latency","0ns");
 
 
@@ -528,6 +541,10 @@ PortControl::initVCs(int vns, int* vcs_per_vn, internal_router_event** vc_heads_
     ibs /= flit_size;
     obs /= flit_size;
 
+    // Holding back more than half the buffer would throttle the
+    // sender at saturation, so cap the coalescing window there
+    credit_return_threshold = std::min(credit_return_threshold, std::max(1, (int)ibs.getRoundedValue() / 2));
+
     for ( int i = 0; i < num_vcs; i++ ) {
         port_ret_credits[i] = ibs.getRoundedValue();
         xbar_in_credits[i] = obs.getRoundedValue();
@@ -74,7 +74,9 @@ public:
         {"enable_congestion_management", "Turn on congestion management","false"},
         {"cm_outstanding_threshold", "Threshold for the amount of data outstanding to a host before congestion management can trigger","2*output_buf_size"},
         {"cm_pktsize_threshold", "Minimum size of a packet to be considered part of a stream with regards to congestion management","128B"},
-        {"cm_incast_threshold", "Numbr of hosts sending to an enpoint needed to trigger congestion management","6"}
+        {"cm_incast_threshold", "Numbr of hosts sending to an enpoint needed to trigger congestion management","6"},
+        {"credit_return_threshold", "Number of flits of credit to accumulate per VC before sending a credit event.  Credits are always "
+         "returned when a VC drains.  Values larger than half the input buffer are reduced to half the input buffer.","1"}
     )
 
     // SST_ELI_DOCUMENT_STATISTICS(
@@ -185,6 +187,8 @@ private:
 
     int* port_ret_credits;
     int* port_out_credits;
+    // Minimum credits to coalesce into a single credit_event
+    int credit_return_threshold;
 
     // Represents the start of when a port was idle
     // If the buffer was empty we instantiate this to the current time
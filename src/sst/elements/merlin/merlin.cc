@@ -89,6 +89,10 @@ char pymerlin_topo_polarstar[] = {
 #include "topology/pymerlin-topo-polarstar.inc"
     0x00};
 
+char pymerlin_topo_flow[] = {
+#include "topology/pymerlin-topo-flow.inc"
+    0x00};
+
 
 class MerlinPyModule : public SSTElementPythonModule {
 public:
@@ -107,6 +111,7 @@ public:
         primary_module->addSubModule("topology",pymerlin_topo_mesh,"topology/pymerlin-topo-mesh.py");
         primary_module->addSubModule("topology",pymerlin_topo_polarfly,"topology/pymerlin-topo-polarfly.py");
         primary_module->addSubModule("topology",pymerlin_topo_polarstar,"topology/pymerlin-topo-polarstar.py");
+        primary_module->addSubModule("topology",pymerlin_topo_flow,"topology/pymerlin-topo-flow.py");
     }
 
     SST_ELI_REGISTER_PYTHON_MODULE(
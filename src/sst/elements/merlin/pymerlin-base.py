@@ -599,7 +599,7 @@ class TemplateBase(_AttributeManager):
 class Topology(TemplateBase):
     def __init__(self):
         TemplateBase.__init__(self)
-        self._declareClassVariables(["network_name","endPointLinks","built","router"])
+        self._declareClassVariables(["network_name","endPointLinks","built","router","_build_observer"])
 
         self.network_name = ""
         self._setCallbackOnWrite("network_name",self._network_name_callback)
@@ -645,7 +645,25 @@ class Topology(TemplateBase):
     def findRouterById(self,rtr_id):
         return sst.findComponentByName(self.getRouterNameForId(rtr_id))
     def _instanceRouter(self,radix,rtr_id):
+        if self._build_observer:
+            return self._build_observer.router(rtr_id)
         return self.router.instanceRouter(self.getRouterNameForId(rtr_id), radix, rtr_id)
+    # Topologies create all of their links through _createLink() so
+    # that observeBuild() can capture them
+    def _createLink(self,name,*args):
+        if self._build_observer:
+            return self._build_observer.link(name)
+        return sst.Link(name,*args)
+    # Runs _build_impl() with routers and links created by observer
+    # (observer.router(rtr_id) and observer.link(name)) instead of
+    # being added to the simulation, so that the wiring of the
+    # topology can be read without building it.  See topoFlow.
+    def observeBuild(self, observer, endpoint):
+        self._build_observer = observer
+        try:
+            self._build_impl(endpoint)
+        finally:
+            self._build_observer = None
 
 class NetworkInterface(TemplateBase):
     def __init__(self):
@@ -829,7 +847,7 @@ class hr_router(RouterTemplate):
                                       "xbar_arb","network_inspectors","oql_track_port","oql_track_remote","num_vns","vn_remap","vn_remap_shm"])
 
         self._declareParams("params",["qos_settings"],"portcontrol.arbitration.")
-        self._declareParams("params",["output_arb", "enable_congestion_management", "cm_outstanding_threshold", "cm_incast_threshold"],"portcontrol.")
+        self._declareParams("params",["output_arb", "enable_congestion_management", "cm_outstanding_threshold", "cm_incast_threshold", "credit_return_threshold"],"portcontrol.")
 
         self._setCallbackOnWrite("qos_settings",self._qos_callback)
 
@@ -26,7 +26,7 @@ class hr_router(RouterTemplate):
                                       "xbar_arb","network_inspectors","oql_track_port","oql_track_remote","num_vns","vn_remap","vn_remap_shm"])
 
         self._declareParams("params",["qos_settings"],"portcontrol.arbitration.")
-        self._declareParams("params",["output_arb"],"portcontrol.")
+        self._declareParams("params",["output_arb","credit_return_threshold"],"portcontrol.")
 
         self._setCallbackOnWrite("qos_settings",self._qos_callback)
         self._subscribeToPlatformParamSet("router")
@@ -0,0 +1,73 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2024 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2024, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import sst
+from sst.merlin.base import *
+from sst.merlin.endpoint import *
+from sst.merlin.interface import *
+from sst.merlin.topology import *
+
+# Coalesced credit returns.  Even numbered endpoints send on network
+# VN 0 and odd ones on VN 1, so every endpoint receives on both VNs
+# and has to return each VN's credits separately.
+class AlternatingVNLinkControl(LinkControl):
+    def build(self,comp,slot,slot_num,job_id,job_size,logical_nid,use_nid_remap = False, link=None):
+        sub,port_name = LinkControl.build(self,comp,slot,slot_num,job_id,job_size,logical_nid,use_nid_remap)
+        sub.addParam("vn_remap",[logical_nid % 2])
+        if link:
+            sub.addLink(link,port_name)
+            return True
+        return sub,port_name
+
+if __name__ == "__main__":
+
+
+    ### Setup the topology
+    topo = topoDragonFly()
+    topo.hosts_per_router = 4
+    topo.routers_per_group = 8
+    topo.intergroup_links = 4
+    topo.num_groups = 5
+    topo.algorithm = ["minimal","ugal"]
+
+    # Set up the routers
+    router = hr_router()
+    router.link_bw = "4GB/s"
+    router.flit_size = "8B"
+    router.xbar_bw = "6GB/s"
+    router.input_latency = "20ns"
+    router.output_latency = "20ns"
+    router.input_buf_size = "4kB"
+    router.output_buf_size = "4kB"
+    router.num_vns = 2
+    router.xbar_arb = "merlin.xbar_arb_lru"
+    router.credit_return_threshold = 8
+
+    topo.router = router
+    topo.link_latency = "20ns"
+
+    ### set up the endpoint
+    networkif = AlternatingVNLinkControl()
+    networkif.link_bw = "4GB/s"
+    networkif.input_buf_size = "1kB"
+    networkif.output_buf_size = "1kB"
+    networkif.credit_return_threshold = 8
+
+    ep = TestJob(0,topo.getNumNodes())
+    ep.network_interface = networkif
+
+    system = System()
+    system.setTopology(topo)
+    system.allocateNodes(ep,"linear")
+
+    system.build()
@@ -0,0 +1,45 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2024 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2024, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+# Runs one of the System based merlin tests with its topology replaced
+# by the flow-level model, so the same traffic can be compared against
+# the detailed reference output:
+#
+#   sst flow_compare.py --model-options="<path to test>.py"
+
+import sys
+import runpy
+
+import sst
+from sst.merlin.base import *
+from sst.merlin.topology import *
+
+if __name__ == "__main__":
+
+    if len(sys.argv) != 2:
+        print("Usage: flow_compare.py <merlin test script>")
+        sst.exit()
+
+    detailed_setTopology = System.setTopology
+
+    # The detailed tests use 20ns links and 20ns router input and
+    # output latencies: two host links and one router at the edges,
+    # then one link and one router per hop
+    def setFlowTopology(self, topology, *args):
+        flow = topoFlow(topology)
+        flow.latency = "80ns"
+        flow.hop_latency = "60ns"
+        detailed_setTopology(self, flow, *args)
+
+    System.setTopology = setFlowTopology
+    runpy.run_path(sys.argv[1], run_name="__main__")
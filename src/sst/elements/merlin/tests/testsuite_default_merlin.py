@@ -62,6 +62,8 @@ class testcase_merlin_Component(SSTTestCase):
     def test_merlin_dragon_128_deferred(self):
         self.merlin_test_template("dragon_128_test_deferred")
 
+    def test_merlin_dragon_128_credits(self):
+        self.merlin_completion_template("dragon_128_test_credits", 160)
 
     @unittest.skipIf(not(('sympy.polys.galoistools' in sys.modules) and ('sympy.polys.domains' in sys.modules)), "Polarfly construction requires sympy")
     def test_merlin_polarfly_455(self):
@@ -108,3 +110,41 @@ class testcase_merlin_Component(SSTTestCase):
             diffdata = testing_get_diff_data(testcase)
             log_failure(diffdata)
         self.assertTrue(cmp_result, "Sorted Output file {0} does not match sorted Reference File {1}".format(outfile, reffile))
+
+    # Coalesced credits change timing, so rather than matching a
+    # reference file, check that all num_nodes endpoints sent and
+    # received all of their packets.  Credits returned on the wrong VN
+    # leave a VN without credits and the endpoints never finish.
+    def merlin_completion_template(self, testcase, num_nodes):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        testDataFileName="test_merlin_{0}".format(testcase)
+
+        sdlfile = "{0}/{1}.py".format(test_path, testcase)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+
+        self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles)
+
+        if os_test_file(errfile, "-s"):
+            log_testing_note("merlin test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
+
+        lines = self._read_merlin_output(outfile)
+        for key in ["Finished sending", "received all packets"]:
+            count = len([line for line in lines if key in line])
+            self.assertEqual(count, num_nodes, "Output has {0} '{1}' lines, expected one per endpoint ({2})".format(count, key, num_nodes))
+        self.assertTrue(self._get_simulated_time(lines) is not None, "Could not find simulated time in {0}".format(outfile))
+
+    def _read_merlin_output(self, filename):
+        with open(filename, 'r') as f:
+            return f.read().splitlines()
+
+    def _get_simulated_time(self, lines):
+        units = { "s" : 1e6, "ms" : 1e3, "us" : 1.0, "ns" : 1e-3, "ps" : 1e-6 }
+        for line in lines:
+            if "simulated time:" in line:
+                fields = line.split("simulated time:")[1].split()
+                return float(fields[0]) * units.get(fields[1], 1.0)
+        return None
@@ -327,6 +327,8 @@ topo_dragonfly::topo_dragonfly(ComponentId_t cid, Params &p, int num_ports, int
 
     rng = new RNG::XORShiftRNG(rtr_id+1);
 
+    route_tables_built = false;
+
     output.verbose(CALL_INFO, 1, 1, "%u:%u:  ID: %u   Params:  p = %u  a = %u  k = %u  h = %u  g = %u\n",
             group_id, router_id, rtr_id, params.p, params.a, params.k, params.h, params.g);
 }
@@ -465,7 +467,7 @@ void topo_dragonfly::route_ugal(int port, int vc, internal_router_event* ev)
             // Need to find the lowest weighted route.  Loop over all
             // the slices.
             int min_weight = std::numeric_limits<int>::max();
-            std::vector<std::pair<int,int> > min_ports;
+            min_ports.clear();
             for ( int i = 0; i < params.n; ++i ) {
                 // Direct routes
                 for ( int j = 0; j < params.m; ++j ) {
@@ -604,7 +606,7 @@ void topo_dragonfly::route_ugal(int port, int vc, internal_router_event* ev)
         // Just routing through.  Need to look at all possible routes
         // to the dest group and pick the lowest weighted route
         int min_weight = std::numeric_limits<int>::max();
-        std::vector<std::pair<int,int> > min_ports;
+        min_ports.clear();
 
         // Look through all routes.  If the port is in current router,
         // weight with 1, other weight with 2
@@ -667,7 +669,7 @@ void topo_dragonfly::route_mina(int port, int vc, internal_router_event* ev)
             // the slices, looking only at minimal routes.  For now,
             // just weight all paths equally.
             int min_weight = std::numeric_limits<int>::max();
-            std::vector<std::pair<int,int> > min_ports;
+            min_ports.clear();
             for ( int i = 0; i < params.n; ++i ) {
                 for ( int j = 0; j < params.m; ++j ) {
                     // Direct routes
@@ -862,6 +864,7 @@ void topo_dragonfly::route_adaptive_local(int port, int vc, internal_router_even
 }
 
 void topo_dragonfly::route_packet(int port, int vc, internal_router_event* ev) {
+    if ( !route_tables_built ) build_route_tables();
     int vn = ev->getVN();
     if ( vns[vn].algorithm == UGAL ) return route_ugal(port,vc,ev);
     if ( vns[vn].algorithm == MIN_A ) return route_mina(port,vc,ev);
@@ -959,7 +962,7 @@ topo_dragonfly::routeControlPacket(CtrlRtrEvent* ev)
     // Just get next port on minimal route
     int next_port;
     if ( addr.group != group_id ) {
-        next_port = port_for_group(addr.group, 0 /* global slice */, 0 /* local slice */ );
+        next_port = compute_port_for_group(addr.group, 0 /* global slice */, 0 /* local slice */ );
     }
     else if ( addr.router != router_id ) {
         next_port = port_for_router(addr.router, 0);
@@ -1124,18 +1127,28 @@ int32_t topo_dragonfly::router_to_group(uint32_t group)
 }
 
 
-int32_t topo_dragonfly::hops_to_router(uint32_t group, uint32_t router, uint32_t slice)
+void topo_dragonfly::build_route_tables()
 {
-    int hops = 1;
-    const RouterPortPair& pair = group_to_global_port.getRouterPortPair(group,slice);
-    if ( pair.router != router_id ) hops++;
-    const RouterPortPair& pair2 = group_to_global_port.getRouterPortPairForGroup(group, group_id, slice);
-    if ( pair2.router != router ) hops++;
-    return hops;
+    group_ports.assign(params.g * params.n * params.m, -1);
+    group_landing_router.assign(params.g * params.n, 0);
+    group_exit_router.assign(params.g * params.n, 0);
+
+    for ( uint32_t group = 0; group < params.g; ++group ) {
+        if ( group == group_id ) continue;
+        for ( uint32_t gs = 0; gs < params.n; ++gs ) {
+            uint32_t index = group * params.n + gs;
+            group_exit_router[index] = group_to_global_port.getRouterPortPair(group,gs).router;
+            group_landing_router[index] = group_to_global_port.getRouterPortPairForGroup(group, group_id, gs).router;
+            for ( uint32_t ls = 0; ls < params.m; ++ls ) {
+                group_ports[index * params.m + ls] = compute_port_for_group(group, gs, ls);
+            }
+        }
+    }
+    route_tables_built = true;
 }
 
 /* returns local router port if group can't be reached from this router */
-int32_t topo_dragonfly::port_for_group(uint32_t group, uint32_t global_slice, uint32_t local_slice)
+int32_t topo_dragonfly::compute_port_for_group(uint32_t group, uint32_t global_slice, uint32_t local_slice)
 {
     const RouterPortPair& pair = group_to_global_port.getRouterPortPair(group,global_slice);
     if ( group_to_global_port.isFailedPort(pair) ) {
@@ -20,6 +20,7 @@
 #define COMPONENTS_MERLIN_TOPOLOGY_DRAGONFLY_H
 
 #include <algorithm>
+#include <vector>
 
 #include <sst/core/event.h>
 #include <sst/core/link.h>
@@ -283,9 +284,35 @@ private:
     void idToLocation(int id, dgnflyAddr *location);
     int32_t router_to_group(uint32_t group);
     int32_t port_for_router(uint32_t router, int local_slice);
-    int32_t port_for_group(uint32_t group, uint32_t global_slice, uint32_t local_slice);
+    int32_t compute_port_for_group(uint32_t group, uint32_t global_slice, uint32_t local_slice);
     int32_t port_for_group_init(uint32_t group, uint32_t global_slice);
-    int32_t hops_to_router(uint32_t group, uint32_t router, uint32_t slice);
+
+    // Forwarding tables compiled from the global link map the first
+    // time a packet is routed (the shared arrays are not complete
+    // during construction).  group_ports holds the output port for
+    // each [dest group][global slice][local slice], -1 if the global
+    // link is failed.  group_landing_router holds the router in the
+    // destination group each [dest group][global slice] link lands on,
+    // and group_exit_router the router in this group it leaves from.
+    std::vector<int16_t> group_ports;
+    std::vector<uint16_t> group_landing_router;
+    std::vector<uint16_t> group_exit_router;
+    bool route_tables_built;
+
+    // Scratch space for adaptive routing decisions
+    std::vector<std::pair<int,int> > min_ports;
+
+    void build_route_tables();
+
+    /* returns -1 if the global link is failed */
+    inline int32_t port_for_group(uint32_t group, uint32_t global_slice, uint32_t local_slice) const {
+        return group_ports[(group * params.n + global_slice) * params.m + local_slice];
+    }
+
+    inline int32_t hops_to_router(uint32_t group, uint32_t router, uint32_t slice) const {
+        uint32_t index = group * params.n + slice;
+        return 1 + (group_exit_router[index] != router_id) + (group_landing_router[index] != router);
+    }
 
     inline bool is_port_endpoint(uint32_t port) const { return ( port < params.p ); }
     inline bool is_port_local_group(uint32_t port) const { return (port >= params.p && port < (params.p + params.a -1 )); }
@@ -88,7 +88,7 @@ class topoDragonFly(Topology):
         #####################
         def getLink(name):
             if name not in links:
-                links[name] = sst.Link(name)
+                links[name] = self._createLink(name)
             return links[name]
         #####################
 
@@ -175,7 +175,7 @@ class topoDragonFly(Topology):
 
                 port = 0
                 for p in range(self.hosts_per_router):
-                    link = sst.Link("link_g%dr%dh%d"%(g, r, p), self.host_link_latency)
+                    link = self._createLink("link_g%dr%dh%d"%(g, r, p), self.host_link_latency)
 
                     Buildable._instanceBuildableBackCompat(endpoint, rtr, "port%d"%port, nic_num, {}, link)
                     #link.setNoCut()
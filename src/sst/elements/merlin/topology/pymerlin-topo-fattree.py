@@ -131,7 +131,7 @@ class topoFatTree(Topology):
                     #print("group: %d, id: %d, node_id: %d"%(group, id, node_id))
                     (ep, port_name) = endpoint.build(node_id, {})
                     if ep:
-                        hlink = sst.Link("hostlink_%d"%node_id)
+                        hlink = self._createLink("hostlink_%d"%node_id)
                         if self.bundleEndpoints:
                            hlink.setNoCut()
                         ep.addLink(hlink, port_name, self.host_link_latency)
@@ -156,7 +156,7 @@ class topoFatTree(Topology):
             rtr_links = [ [] for index in range(rtrs_in_group) ]
             for i in range(rtrs_in_group):
                 for j in range(self._downs[level]):
-                    rtr_links[i].append(sst.Link("link_l%d_g%d_r%d_p%d"%(level,group,i,j)));
+                    rtr_links[i].append(self._createLink("link_l%d_g%d_r%d_p%d"%(level,group,i,j)));
 
             # Now create group links to pass to lower level groups from router down links
             group_links = [ [] for index in range(self._downs[level]) ]
@@ -193,7 +193,7 @@ class topoFatTree(Topology):
             rtr_links = [ [] for index in range(rtrs_in_group) ]
             for i in range(rtrs_in_group):
                 for j in range(self._downs[level]):
-                    rtr_links[i].append(sst.Link("link_l%d_g0_r%d_p%d"%(level,i,j)));
+                    rtr_links[i].append(self._createLink("link_l%d_g0_r%d_p%d"%(level,i,j)));
 
             # Now create group links to pass to lower level groups from router down links
             group_links = [ [] for index in range(self._downs[level]) ]
@@ -0,0 +1,180 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2024 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2024, NTESS
+# All rights reserved.
+#
+# Portions are copyright of other developers:
+# See the file CONTRIBUTORS.TXT in the top level directory
+# of the distribution for more information.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import sst
+from sst.merlin.base import *
+
+# Replaces the routers and links of a network with a single flow-level
+# model (merlin.flownet).  Endpoints are connected exactly as they
+# would be to a router, so any topology can be swapped for its
+# flow-level approximation by wrapping it:
+#
+#   topo = topoFlow(topoDragonFly())
+#
+# The wrapped topology is never instanced.  Its build is observed
+# (Topology.observeBuild) with stand-ins for routers and links so
+# that flownet gets the router graph and routes each flow along a
+# minimal path.  Link failures of the wrapped topology are not
+# modeled.  Parameters that are not set on the flow model are taken
+# from the wrapped topology and its router.
+class topoFlow(Topology):
+
+    def __init__(self, base_topology = None):
+        Topology.__init__(self)
+        self._declareClassVariables(["link_latency","bundleEndpoints","_base_topology"])
+        self._declareParams("main",["num_ports","link_bw","flit_size","input_buf_size","fabric_bw","latency","hop_latency","num_vns"])
+        self._subscribeToPlatformParamSet("topology")
+        self._base_topology = base_topology
+
+    def getName(self):
+        return "Flow"
+
+    def getNumNodes(self):
+        if self._base_topology:
+            return self._base_topology.getNumNodes()
+        return self.num_ports
+
+    def getRouterNameForId(self,rtr_id):
+        return "flownet"
+
+    def _inheritParams(self):
+        base = self._base_topology
+        router = base.router
+        for param in ["link_bw","flit_size","input_buf_size","num_vns"]:
+            if getattr(self,param) is None and router is not None:
+                try:
+                    value = getattr(router,param)
+                except KeyError:
+                    value = None
+                if value is not None:
+                    setattr(self,param,value)
+        if self.link_latency is None:
+            for param in ["host_link_latency","link_latency"]:
+                try:
+                    value = getattr(base,param)
+                except KeyError:
+                    value = None
+                if value is not None:
+                    self.link_latency = value
+                    break
+
+    def _build_impl(self, endpoint):
+        num_ports = self.getNumNodes()
+
+        net = sst.Component(self.getRouterNameForId(0),"merlin.flownet")
+        self._applyStatisticsSettings(net)
+        if self._base_topology:
+            self._inheritParams()
+        net.addParams(self._getGroupParams("main"))
+        net.addParam("num_ports",num_ports)
+
+        if self._base_topology:
+            (num_routers, endpoint_router, router_links) = _FlowWiring(num_ports).record(self._base_topology)
+            net.addParam("num_routers",num_routers)
+            net.addParam("endpoint_router",endpoint_router)
+            net.addParam("router_links",router_links)
+
+        for l in range(num_ports):
+            (ep, portname) = endpoint.build(l, {})
+            if ep:
+                link = sst.Link("link%d"%l)
+                if self.bundleEndpoints:
+                    link.setNoCut()
+                link.connect( (ep, portname, self.link_latency), (net, "port%d"%l, self.link_latency) )
+
+
+# Stand-ins used to record which routers and endpoints each link of a
+# topology connects, without adding anything to the simulation
+class _FlowWiringObject(object):
+
+    def __init__(self, wiring, owner):
+        self._wiring = wiring
+        self._owner = owner
+
+    def addLink(self, link, port, latency=None):
+        link._attach(self._owner)
+
+    def setSubComponent(self, *args, **kwargs):
+        return _FlowWiringObject(self._wiring, self._owner)
+
+    def __getattr__(self, name):
+        # Parameter and statistic setup is irrelevant to the wiring
+        return lambda *args, **kwargs: None
+
+
+class _FlowWiringLink(object):
+
+    def __init__(self, wiring):
+        self._ends = []
+        wiring._links.append(self)
+
+    def _attach(self, owner):
+        self._ends.append(owner)
+
+    def connect(self, end0, end1):
+        self._attach(end0[0]._owner)
+        self._attach(end1[0]._owner)
+
+    def __getattr__(self, name):
+        return lambda *args, **kwargs: None
+
+
+class _FlowWiring(object):
+
+    def __init__(self, num_ports):
+        self._num_ports = num_ports
+        self._num_routers = 0
+        self._links = []
+
+    # Endpoint interface used by the wrapped topology
+    def build(self, nID, extraKeys, link=None):
+        if link:
+            link._attach(("endpoint",nID))
+            return True
+        return (_FlowWiringObject(self, ("endpoint",nID)), "port")
+
+    # Build observer interface used by Topology.observeBuild()
+    def router(self, rtr_id):
+        self._num_routers = max(self._num_routers, rtr_id + 1)
+        return _FlowWiringObject(self, ("router",rtr_id))
+
+    def link(self, name):
+        return _FlowWiringLink(self)
+
+    def record(self, topology):
+        topology.observeBuild(self, self)
+
+        endpoint_router = [-1] * self._num_ports
+        router_links = []
+        for link in self._links:
+            if len(link._ends) != 2:
+                # Unused port
+                continue
+            (kind0, id0) = link._ends[0]
+            (kind1, id1) = link._ends[1]
+            if kind0 == "router" and kind1 == "router":
+                router_links.extend([id0, id1])
+            elif kind0 == "router" and kind1 == "endpoint":
+                endpoint_router[id1] = id0
+            elif kind0 == "endpoint" and kind1 == "router":
+                endpoint_router[id0] = id1
+
+        if -1 in endpoint_router:
+            print("topoFlow: endpoint %d is not attached to a router in topology %s"%(endpoint_router.index(-1),topology.getName()))
+            sst.exit()
+
+        return (self._num_routers, endpoint_router, router_links)
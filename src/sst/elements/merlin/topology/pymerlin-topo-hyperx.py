@@ -135,7 +135,7 @@ class topoHyperX(Topology):
             else:
                 name = "link_%s_%s_%d"%(name2, name1, num)
             if name not in links:
-                links[name] = sst.Link(name)
+                links[name] = self._createLink(name)
             #print("Getting link with name: %s"%name)
             return links[name]
 
@@ -174,7 +174,7 @@ class topoHyperX(Topology):
                 nodeID = local_ports * i + n
                 (ep, port_name) = endpoint.build(nodeID, {})
                 if ep:
-                    nicLink = sst.Link("nic_%d_%d"%(i, n))
+                    nicLink = self._createLink("nic_%d_%d"%(i, n))
                     if self.bundleEndpoints:
                        nicLink.setNoCut()
                     nicLink.connect( (ep, port_name, self.host_link_latency), (rtr, "port%d"%port, self.host_link_latency) )
@@ -132,7 +132,7 @@ class _topoMeshBase(Topology):
         def getLink(leftName, rightName, num):
             name = "link_%s_%s_%d"%(leftName, rightName, num)
             if name not in links:
-                links[name] = sst.Link(name)
+                links[name] = self._createLink(name)
             return links[name]
 
         
@@ -175,7 +175,7 @@ class _topoMeshBase(Topology):
                 nodeID = local_ports * i + n
                 (ep, port_name) = endpoint.build(nodeID, {})
                 if ep:
-                    nicLink = sst.Link("nic.%d:%d"%(i, n))
+                    nicLink = self._createLink("nic.%d:%d"%(i, n))
                     if self.bundleEndpoints:
                        nicLink.setNoCut()
                     nicLink.connect( (ep, port_name, self.host_link_latency), (rtr, "port%d"%port, self.host_link_latency) )
@@ -240,7 +240,7 @@ class topoSingle(Topology):
         for l in range(self.num_ports):
             (ep, portname) = endpoint.build(l, {})
             if ep:
-                link = sst.Link("link%d"%l)
+                link = self._createLink("link%d"%l)
                 if self.bundleEndpoints:
                     link.setNoCut()
                 link.connect( (ep, portname, self.link_latency), (rtr, "port%d"%l, self.link_latency) )
@@ -626,7 +626,7 @@ class topoPolarStar(Topology):
             else:
                 name = "link_%s_%s"%(name2, name1)
             if name not in links:
-                links[name] = sst.Link(name)
+                links[name] = self._createLink(name)
             return links[name]
             
         #1. Generate the adjacency list for the polarstar topology
@@ -656,7 +656,7 @@ class topoPolarStar(Topology):
 
                 node_num = node_num+1
                 if ep:
-                    nicLink = sst.Link("nic_%d_%d"%(router, localnodeID))
+                    nicLink = self._createLink("nic_%d_%d"%(router, localnodeID))
                     if self.bundleEndpoints:
                        nicLink.setNoCut()
                     nicLink.connect( (ep, port_name, self.host_link_latency), (rtr, "port%d"%port, self.host_link_latency) )
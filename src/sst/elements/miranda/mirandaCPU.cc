@@ -241,10 +241,8 @@ void RequestGenCPU::handleEvent( Interfaces::StandardMem::Request* ev) {
 			out->verbose(CALL_INFO, 4, 0, "-> Entry has all parts satisfied, removing ID=%" PRIu64 ", total processing time: %" PRIu64 "ns\n",
 				cpuReq->getOriginalReqID(), (getCurrentSimTimeNano() - cpuReq->getIssueTime()));
 
-			// Notify every pending request that there may be a satisfied dependency
-			for(uint32_t i = 0; i < pendingRequests.size(); ++i) {
-				pendingRequests.at(i)->satisfyDependency(cpuReq->getOriginalReqID());
-			}
+			// Notify the pending requests which are waiting on this one
+			pendingDependencies.satisfy(cpuReq->getOriginalReqID());
 
 			delete cpuReq;
 		}
@@ -441,6 +439,7 @@ bool RequestGenCPU::clockTick(SST::Cycle_t cycle) {
 
     // We need to generate at least as many requests as can be looked up in the OoO window
     // otherwise the issue will have starvation.
+    const uint32_t firstGenerated = pendingRequests.size();
     for(int i = pendingRequests.size(); i < maxOpLookup; ++i) {
         if( reqGen->isFinished()) {
             break;
@@ -449,6 +448,10 @@ bool RequestGenCPU::clockTick(SST::Cycle_t cycle) {
     	}
     }
 
+    for(uint32_t i = firstGenerated; i < pendingRequests.size(); ++i) {
+        pendingDependencies.track(pendingRequests.at(i));
+    }
+
     for(uint32_t i = 0; i < pendingRequests.size(); ++i) {
         if(reqsIssuedThisCycle == reqMaxPerCycle) {
             statMaxIssuePerCycle->addData(1);
@@ -474,6 +477,7 @@ bool RequestGenCPU::clockTick(SST::Cycle_t cycle) {
     		delReqs.push_back(i);
 
                 // Delete the fence
+                pendingDependencies.untrack(nxtRq);
     		delete nxtRq;
             } else {
                 out->verbose(CALL_INFO, 4, 0, "Fence operation in flight (>0 pending requests), stall.\n");
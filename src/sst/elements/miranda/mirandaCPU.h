@@ -24,6 +24,9 @@
 #include "mirandaEvent.h"
 #include "mirandaMemMgr.h"
 
+#include <unordered_map>
+#include <vector>
+
 using namespace SST;
 using namespace SST::Interfaces;
 using namespace SST::Statistics;
@@ -48,6 +51,50 @@ protected:
     uint32_t outstandingParts;
 };
 
+/*
+ * Reverse dependency edges for the pending window: maps a request ID to
+ * the requests waiting on it, so a completion only touches its waiters.
+ */
+class RequestDependencies {
+public:
+    void track(GeneratorRequest* req) {
+        const std::vector<uint64_t>& deps = req->getDependencies();
+        for(auto dep = deps.begin(); dep != deps.end(); dep++) {
+            waiters[*dep].push_back(req);
+        }
+    }
+
+    void untrack(GeneratorRequest* req) {
+        const std::vector<uint64_t>& deps = req->getDependencies();
+        for(auto dep = deps.begin(); dep != deps.end(); dep++) {
+            auto w = waiters.find(*dep);
+            if(w == waiters.end()) continue;
+
+            std::vector<GeneratorRequest*>& list = w->second;
+            for(auto it = list.begin(); it != list.end(); it++) {
+                if(*it == req) {
+                    list.erase(it);
+                    break;
+                }
+            }
+            if(list.empty()) waiters.erase(w);
+        }
+    }
+
+    void satisfy(const uint64_t reqID) {
+        auto w = waiters.find(reqID);
+        if(w == waiters.end()) return;
+
+        for(auto it = w->second.begin(); it != w->second.end(); it++) {
+            (*it)->satisfyDependency(reqID);
+        }
+        waiters.erase(w);
+    }
+
+private:
+    std::unordered_map<uint64_t, std::vector<GeneratorRequest*> > waiters;
+};
+
 class RequestGenCPU : public SST::Component {
 public:
 
@@ -148,6 +195,7 @@ private:
     StdMemHandler* stdMemHandlers;
 
     MirandaRequestQueue<GeneratorRequest*> pendingRequests;
+    RequestDependencies pendingDependencies;
     MirandaMemoryManager* memMgr;
 
     uint32_t maxRequestsPending[OPCOUNT];
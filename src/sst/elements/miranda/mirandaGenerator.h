@@ -24,6 +24,7 @@
 #include <sst/core/interfaces/stdMem.h>
 
 #include <queue>
+#include <vector>
 
 namespace SST {
 namespace Miranda {
@@ -70,6 +71,10 @@ public:
 		return dependsOn.empty();
 	}
 
+	const std::vector<uint64_t>& getDependencies() const {
+		return dependsOn;
+	}
+
 	uint64_t getIssueTime() const {
 		return issueTime;
 	}
@@ -85,36 +90,41 @@ private:
 	static std::atomic<uint64_t> nextGeneratorRequestID;
 };
 
+/*
+ * Window of requests waiting to issue, stored as a ring.  Requests retire
+ * close to the head so erase compacts the entries in front of the last
+ * erased index towards the tail and advances the head; the cost depends
+ * on how far into the window requests retired, not on the queue length.
+ */
 template<typename QueueType>
 class MirandaRequestQueue {
 public:
-       	MirandaRequestQueue() {
-                        theQ = (QueueType*) malloc(sizeof(QueueType) * 16);
-                        maxCapacity = 16;
-                        curSize = 0;
-                }
-        ~MirandaRequestQueue() {
-               	free(theQ);
-        }
-
-        bool empty() const {
-               	return 0 == curSize;
-        }
-
-        void resize(const uint32_t newSize) {
-//		printf("Resizing MirandaQueue from: %" PRIu32 " to %" PRIu32 "\n",
-//			curSize, newSize);
-
-               	QueueType * newQ = (QueueType *) malloc(sizeof(QueueType) * newSize);
-               	for(uint32_t i = 0; i < curSize; ++i) {
-                       	newQ[i] = theQ[i];
-                }
-
-                free(theQ);
-               	theQ = newQ;
-               	maxCapacity = newSize;
-               	curSize = std::min(curSize, newSize);
-        }
+	MirandaRequestQueue() {
+		theQ = (QueueType*) malloc(sizeof(QueueType) * 16);
+		maxCapacity = 16;
+		head = 0;
+		curSize = 0;
+	}
+	~MirandaRequestQueue() {
+		free(theQ);
+	}
+
+	bool empty() const {
+		return 0 == curSize;
+	}
+
+	void resize(const uint32_t newSize) {
+		QueueType * newQ = (QueueType *) malloc(sizeof(QueueType) * newSize);
+		curSize = std::min(curSize, newSize);
+		for(uint32_t i = 0; i < curSize; ++i) {
+			newQ[i] = at(i);
+		}
+
+		free(theQ);
+		theQ = newQ;
+		maxCapacity = newSize;
+		head = 0;
+	}
 
 	uint32_t size() const {
 		return curSize;
@@ -124,54 +134,51 @@ public:
 		return maxCapacity;
 	}
 
-       	QueueType at(const uint32_t index) {
-               	return theQ[index];
-       	}
+	QueueType at(const uint32_t index) {
+		return theQ[slot(index)];
+	}
 
-       	void erase(const std::vector<uint32_t> eraseList) {
+	// eraseList must be in increasing index order
+	void erase(const std::vector<uint32_t>& eraseList) {
 		if(0 == eraseList.size()) {
 			return;
 		}
 
-               	QueueType* newQ = (QueueType*) malloc(sizeof(QueueType) * maxCapacity);
+		// Walk back from the last erased entry, sliding survivors towards it
+		uint32_t nextSkipIndex = eraseList.size();
+		uint32_t dest = eraseList.back();
 
-               	uint32_t nextSkipIndex = 0;
-               	uint32_t nextSkip = eraseList.at(nextSkipIndex);
-                uint32_t nextNewQIndex = 0;
-
-               	for(uint32_t i = 0; i < curSize; ++i) {
-                       	if(nextSkip == i) {
-                                nextSkipIndex++;
-
-                                if(nextSkipIndex >= eraseList.size()) {
-                                       	nextSkip = curSize;
-                               	} else {
-                                       	nextSkip = eraseList.at(nextSkipIndex);
-                                }
-                       	} else {
-                               	newQ[nextNewQIndex] = theQ[i];
-                                nextNewQIndex++;
-                       	}
-               	}
-
-                free(theQ);
+		for(uint32_t i = eraseList.back() + 1; i-- > 0; ) {
+			if(nextSkipIndex > 0 && eraseList[nextSkipIndex - 1] == i) {
+				nextSkipIndex--;
+			} else {
+				theQ[slot(dest)] = theQ[slot(i)];
+				dest--;
+			}
+		}
 
-               	theQ = newQ;
-		curSize = nextNewQIndex;
-        }
+		head = slot(eraseList.size());
+		curSize -= eraseList.size();
+	}
 
 	void push_back(QueueType t) {
-                if(curSize == maxCapacity) {
-                        resize(maxCapacity + 16);
-                }
+		if(curSize == maxCapacity) {
+			resize(maxCapacity * 2);
+		}
 
-                theQ[curSize] = t;
-                curSize++;
-        }
+		theQ[slot(curSize)] = t;
+		curSize++;
+	}
 private:
-        QueueType* theQ;
-        uint32_t maxCapacity;
-        uint32_t curSize;
+	uint32_t slot(const uint32_t index) const {
+		const uint32_t s = head + index;
+		return s >= maxCapacity ? s - maxCapacity : s;
+	}
+
+	QueueType* theQ;
+	uint32_t maxCapacity;
+	uint32_t head;
+	uint32_t curSize;
 };
 
 class MemoryOpRequest : public GeneratorRequest {
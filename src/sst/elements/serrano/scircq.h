@@ -78,6 +78,7 @@ public:
 	void clear() {
 		front = 0;
 		back  = 0;
+		count = 0;
 	}
 
 private:
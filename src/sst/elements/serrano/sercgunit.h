@@ -36,6 +36,8 @@ enum SerranoStandardType {
         TYPE_CUSTOM
 };
 
+typedef SerranoCircularQueue<SerranoMessage> SerranoMessageQueue;
+
 class SerranoCoarseUnit : public SST::SubComponent {
 
 public:
@@ -58,12 +60,29 @@ public:
 	virtual bool stillProcessing() = 0;
 	virtual void execute( const uint64_t current_cycle ) = 0;
 
-	void addInputQueue( SerranoCircularQueue<SerranoMessage*>* new_q ) {
+	// Would calling execute() this cycle make progress? Units are only
+	// stepped while this is true, and are re-checked whenever a unit
+	// they share a queue with executes.
+	virtual bool hasWork() {
+		if( stillProcessing() ) {
+			return true;
+		}
+
+		for( SerranoMessageQueue* in_q : input_qs ) {
+			if( ! in_q->empty() ) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void addInputQueue( SerranoMessageQueue* new_q ) {
 		output->verbose(CALL_INFO, 4, 0, "Added input queue.\n");
 		input_qs.push_back( new_q );
 	}
 
-	void addOutputQueue( SerranoCircularQueue<SerranoMessage*>* new_q ) {
+	void addOutputQueue( SerranoMessageQueue* new_q ) {
 		output->verbose(CALL_INFO, 4, 0, "Added output queue.\n");
 		output_qs.push_back( new_q );
 	}
@@ -77,8 +96,8 @@ public:
 
 protected:
 	SST::Output* output;
-	std::vector< SerranoCircularQueue<SerranoMessage*>* > input_qs;
-	std::vector< SerranoCircularQueue<SerranoMessage*>* > output_qs;
+	std::vector< SerranoMessageQueue* > input_qs;
+	std::vector< SerranoMessageQueue* > output_qs;
 
 };
 
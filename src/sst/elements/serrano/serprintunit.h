@@ -74,7 +74,7 @@ protected:
 
 	void print() {
 		if(! input_qs[0]->empty() ) {
-			SerranoMessage* msg = input_qs[0]->pop();
+			SerranoMessage msg = input_qs[0]->pop();
 
 			switch(d_type) {
 			case TYPE_INT32:
@@ -89,8 +89,6 @@ protected:
 				output->fatal(CALL_INFO, -1, "Unknown data type.\n");
 				break;
 			}
-
-			delete msg;
 		}
 	}
 
@@ -70,38 +70,62 @@ bool SerranoComponent::tick( SST::Cycle_t currentCycle ) {
 
 	output->verbose(CALL_INFO, 4, 0, "Clocking Serrano cycle %" PRIu64 "...\n", currentCycle );
 
-	// Tick all units
-	for( auto next_unit : units ) {
-		next_unit.second->execute( currentCycle );
-	}
+	// Step active units in index order. A unit woken by a lower-indexed unit this
+	// cycle still runs this cycle, exactly as when every unit was stepped in order.
+	bool units_continue = false;
+
+	for( size_t w = 0; w < active_units.size(); ++w ) {
+		uint64_t pending = active_units[w];
+
+		while( 0 != pending ) {
+			const uint32_t bit  = __builtin_ctzll( pending );
+			const uint32_t next = ( w << 6 ) + bit;
+
+			active_units[w] &= ~( UINT64_C(1) << bit );
+
+			SerranoCoarseUnit* next_unit = units[next];
+			next_unit->execute( currentCycle );
 
-	bool units_continue  = false;
-	bool queues_continue = false;
+			output->verbose(CALL_INFO, 16, 0, "Unit-ID: %" PRIu64 " status: %s\n", unit_ids[next],
+				( next_unit->stillProcessing() ? "keep-processing" : "completed" ) );
+
+			if( next_unit->hasWork() ) {
+				activateUnit( next );
+			}
+
+			// Executing may have filled a consumer's input or freed a producer's output
+			for( const uint32_t neighbour : unit_neighbours[next] ) {
+				if( units[neighbour]->hasWork() ) {
+					activateUnit( neighbour );
+				}
+			}
 
-	// Do we have any units which want to continue processing
-	for( auto next_unit : units ) {
-		output->verbose(CALL_INFO, 16, 0, "Unit-ID: %" PRIu64 " status: %s\n", next_unit.first,
-			( next_unit.second->stillProcessing() ? "keep-processing" : "completed" ) );
-		units_continue |= next_unit.second->stillProcessing();
+			pending = ( 63 == bit ) ? 0 : ( active_units[w] & ( ~UINT64_C(0) << ( bit + 1 ) ) );
+		}
 	}
 
-	// Check that any queue is not empty
-	for( auto next_q : msg_queues ) {
-		queues_continue |= ( ! next_q.second->empty() );
+	for( const uint64_t next_word : active_units ) {
+		units_continue |= ( 0 != next_word );
 	}
 
 	if( units_continue ) {
 		output->verbose(CALL_INFO, 4, 0, "Work units are still processing, continue for another cycle\n");
 		return false;
 	} else {
+		// No unit can make progress, so nothing will ever change again.
+		bool queues_continue = false;
+
+		for( SerranoMessageQueue* next_q : msg_queues ) {
+			queues_continue |= ( ! next_q->empty() );
+		}
+
 		if( queues_continue ) {
-			output->verbose(CALL_INFO, 4, 0, "Queues contain entries that may need processing, continue for another cycle.\n");
-			return false;
-		} else {
-			output->verbose(CALL_INFO, 4, 0, "Neither queues or units have no work, no need to continue processing.\n");
-			primaryComponentOKToEndSim();
-			return true;
+			output->verbose(CALL_INFO, 1, 0, "Warning: no unit can make progress but queues still contain entries.\n");
 		}
+
+		output->verbose(CALL_INFO, 4, 0, "Neither queues or units have no work, no need to continue processing.\n");
+		primaryComponentOKToEndSim();
+		return true;
 	}
 
 }
@@ -120,6 +144,9 @@ void SerranoComponent::constructGraph( SST::Output* output, const char* kernel_f
 
 	Params empty_params;
 
+	std::map< uint64_t, SerranoCoarseUnit* > graph_units;
+	std::vector< std::pair< uint64_t, uint64_t > > graph_links;
+
 	while( ! feof( graph_file ) ) {
 		read_line( graph_file, line, buff_max);
 		printf("Line[%s]\n", line);
@@ -193,7 +220,7 @@ void SerranoComponent::constructGraph( SST::Output* output, const char* kernel_f
 				output->fatal(CALL_INFO, -1, "Error: unable to parse node type (%s)\n", token );
 			}
 
-			units.insert( std::pair< uint64_t, SerranoCoarseUnit* >( id, new_unit ) );
+			graph_units.insert( std::pair< uint64_t, SerranoCoarseUnit* >( id, new_unit ) );
 		} else if( 0 == strcmp( token, "LINK" ) ) {
 			char* in_unit      = strtok( nullptr, " " );
 			char* out_unit     = strtok( nullptr, " " );
@@ -201,14 +228,10 @@ void SerranoComponent::constructGraph( SST::Output* output, const char* kernel_f
 			const uint64_t u64_in_unit  = std::atoll( in_unit );
 			const uint64_t u64_out_unit = std::atoll( out_unit );
 
-			SerranoCircularQueue<SerranoMessage*>* new_q = new SerranoCircularQueue<SerranoMessage*>(2);
-	
-			if( ( units.find( u64_in_unit ) != units.end() ) && ( units.find( u64_out_unit ) != units.end() ) ) {
+			if( ( graph_units.find( u64_in_unit ) != graph_units.end() ) && ( graph_units.find( u64_out_unit ) != graph_units.end() ) ) {
 				output->verbose(CALL_INFO, 4, 0, "Connecting %" PRIu64 " -> %" PRIu64 " (link-id: %" PRIu64 ")\n",
 					u64_in_unit, u64_out_unit, id);
-				// These are swapped, input to the link is the output of a unit and vice versa
-				units[ u64_in_unit  ]->addOutputQueue( new_q );
-				units[ u64_out_unit ]->addInputQueue( new_q );
+				graph_links.push_back( std::pair< uint64_t, uint64_t >( u64_in_unit, u64_out_unit ) );
 			} else {
 				output->fatal(CALL_INFO, -1, "Error: link does not connect an existing input or output component.\n");
 			}
@@ -220,10 +243,56 @@ void SerranoComponent::constructGraph( SST::Output* output, const char* kernel_f
 	delete[] line;
 	fclose( graph_file );
 
+	compileGraph( graph_units, graph_links );
+
 	/* cycle over and check queues are good, these will fatal */
-	for( auto next_unit : units ) {
-		next_unit.second->checkRequiredQueues( output );
-	}	
+	for( SerranoCoarseUnit* next_unit : units ) {
+		next_unit->checkRequiredQueues( output );
+	}
+
+	/* sources (and anything else able to run) start active */
+	for( uint32_t i = 0; i < units.size(); ++i ) {
+		if( units[i]->hasWork() ) {
+			activateUnit( i );
+		}
+	}
+}
+
+/*
+ * Flatten the parsed graph: number units densely in node-ID order and
+ * allocate one preallocated message ring per link.
+ */
+void SerranoComponent::compileGraph( std::map< uint64_t, SerranoCoarseUnit* >& graph_units,
+	std::vector< std::pair< uint64_t, uint64_t > >& graph_links ) {
+
+	std::map< uint64_t, uint32_t > dense_index;
+
+	for( auto next_unit : graph_units ) {
+		dense_index[ next_unit.first ] = (uint32_t) units.size();
+		unit_ids.push_back( next_unit.first );
+		units.push_back( next_unit.second );
+	}
+
+	unit_neighbours.resize( units.size() );
+	active_units.assign( ( units.size() + 63 ) / 64, 0 );
+
+	for( auto next_link : graph_links ) {
+		const uint32_t producer = dense_index[ next_link.first  ];
+		const uint32_t consumer = dense_index[ next_link.second ];
+
+		SerranoMessageQueue* new_q = new SerranoMessageQueue(2);
+		msg_queues.push_back( new_q );
+
+		// These are swapped, input to the link is the output of a unit and vice versa
+		units[ producer ]->addOutputQueue( new_q );
+		units[ consumer ]->addInputQueue( new_q );
+
+		unit_neighbours[ producer ].push_back( consumer );
+		unit_neighbours[ consumer ].push_back( producer );
+	}
+
+	output->verbose(CALL_INFO, 2, 0, "Compiled kernel with %" PRIu64 " units and %" PRIu64 " queues\n",
+		(uint64_t) units.size(), (uint64_t) msg_queues.size() );
 }
 
 int SerranoComponent::read_line( FILE* file_h, char* buffer, const size_t buffer_max ) {
@@ -254,17 +323,20 @@ int SerranoComponent::read_line( FILE* file_h, char* buffer, const size_t buffer
 void SerranoComponent::clearGraph() {
 	output->verbose(CALL_INFO, 2, 0, "Clearing current graph...\n");
 
-	for( auto next_q : msg_queues ) {
-		delete next_q.second;;
+	for( SerranoMessageQueue* next_q : msg_queues ) {
+		delete next_q;
 	}
 
 	msg_queues.clear();
 
-	for( auto next_unit : units ) {
-		delete next_unit.second;
+	for( SerranoCoarseUnit* next_unit : units ) {
+		delete next_unit;
 	}
 
 	units.clear();
+	unit_ids.clear();
+	unit_neighbours.clear();
+	active_units.clear();
 
 	output->verbose(CALL_INFO, 2, 0, "Graph clear done. Reset is complete\n");
 }
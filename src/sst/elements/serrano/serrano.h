@@ -21,6 +21,8 @@
 #include <sst/core/output.h>
 
 #include <cstdio>
+#include <map>
+#include <vector>
 
 #include "smsg.h"
 #include "scircq.h"
@@ -60,12 +62,24 @@ public:
 
 private:
 	int read_line( FILE* file_h, char* buffer, const size_t buffer_max );
+	void compileGraph( std::map< uint64_t, SerranoCoarseUnit* >& graph_units,
+		std::vector< std::pair< uint64_t, uint64_t > >& graph_links );
+
+	void activateUnit( const uint32_t unit ) {
+		active_units[ unit >> 6 ] |= ( UINT64_C(1) << ( unit & 63 ) );
+	}
 
 	SST::Output* output;
 	std::list< std::string > kernel_queue;
-	std::map< uint64_t, SerranoCoarseUnit* > units;
-	std::map< uint64_t, SerranoCircularQueue<SerranoMessage*>* > msg_queues;
-	
+
+	// Compiled kernel: units are numbered densely in ascending node-ID order and
+	// stepped in that order. Only units flagged in active_units are executed.
+	std::vector< SerranoCoarseUnit* > units;
+	std::vector< uint64_t > unit_ids;                       // dense index -> node ID in the graph file
+	std::vector< std::vector< uint32_t > > unit_neighbours; // units sharing a queue with this unit
+	std::vector< uint64_t > active_units;                   // bitmap, one bit per unit
+	std::vector< SerranoMessageQueue* > msg_queues;
+
 
 };
 
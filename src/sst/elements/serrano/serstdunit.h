@@ -100,6 +100,21 @@ public:
 
 	virtual bool stillProcessing() { return false; }
 
+	// Only worth stepping once every input has a message and the output has space
+	virtual bool hasWork() {
+		if( input_qs.empty() || output_qs.empty() || output_qs[0]->full() ) {
+			return false;
+		}
+
+		for( SerranoMessageQueue* in_q : input_qs ) {
+			if( in_q->empty() ) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
 	virtual void execute( const uint64_t current_cycle ) {
 		if( nullptr == unit_func ) {
 			output->fatal(CALL_INFO, -1, "Error: function to execute has not been defined or was not decoded correctly.\n");
@@ -108,24 +123,19 @@ public:
 		bool all_ins_ready = true;
 		bool out_ready     = (! output_qs[0]->full());
 
-		for( SerranoCircularQueue<SerranoMessage*>* in_q : input_qs ) {
+		for( SerranoMessageQueue* in_q : input_qs ) {
 			all_ins_ready &= (!in_q->empty());
 		}
 
 		if( all_ins_ready & out_ready ) {
 			// We are good to go, all inputs have a message, output has a slot
-			for( SerranoCircularQueue<SerranoMessage*>* in_q : input_qs ) {
+			for( SerranoMessageQueue* in_q : input_qs ) {
 				msgs_in.push_back( in_q->pop() );
 			}
 
 			// Execute the function
 			unit_func( output, msgs_in );
 
-			// Delete the messages from the incoming queues to free memory
-			for( SerranoMessage* in_msg : msgs_in ) {
-				delete in_msg;
-			}
-
 			// Clear the vector this cycle
 			msgs_in.clear();
 		} else {
@@ -135,52 +145,52 @@ public:
 	}
 
 protected:
-	template<class T> void execute_add( std::vector<SerranoMessage*>& msg_in, const T init_value ) {
+	template<class T> void execute_add( std::vector<SerranoMessage>& msg_in, const T init_value ) {
 		T result = init_value;
 
-		for( SerranoMessage* msg : msg_in ) {
+		for( const SerranoMessage& msg : msg_in ) {
                         result += extractValue<T>( output, msg );
                 }
 
 		output_qs[0]->push( constructMessage<T>( result ) );
 	}
 
-	template<class T> void execute_sub( std::vector<SerranoMessage*>& msg_in, const T init_value ) {
+	template<class T> void execute_sub( std::vector<SerranoMessage>& msg_in, const T init_value ) {
 		T result = init_value;
 
-		for( SerranoMessage* msg : msg_in ) {
+		for( const SerranoMessage& msg : msg_in ) {
                         result -= extractValue<T>( output, msg );
                 }
 
 		output_qs[0]->push( constructMessage<T>( result ) );
 	}
 
-	void execute_i32_add( SST::Output* output, std::vector<SerranoMessage*>& msg_in ) {
+	void execute_i32_add( SST::Output* output, std::vector<SerranoMessage>& msg_in ) {
 		execute_add<int32_t>(msg_in, 0);
 	}
 
-	void execute_u32_add( SST::Output* output, std::vector<SerranoMessage*>& msg_in ) {
+	void execute_u32_add( SST::Output* output, std::vector<SerranoMessage>& msg_in ) {
 		execute_add<uint32_t>(msg_in, 0);
 	}
 
-	void execute_i64_add( SST::Output* output, std::vector<SerranoMessage*>& msg_in ) {
+	void execute_i64_add( SST::Output* output, std::vector<SerranoMessage>& msg_in ) {
 		execute_add<int64_t>(msg_in, 0);
 	}
 	
-	void execute_u64_add( SST::Output* output, std::vector<SerranoMessage*>& msg_in ) {
+	void execute_u64_add( SST::Output* output, std::vector<SerranoMessage>& msg_in ) {
 		execute_add<uint64_t>(msg_in, 0);
 	}
 
-	void execute_f32_add( SST::Output* output, std::vector<SerranoMessage*>& msg_in ) {
+	void execute_f32_add( SST::Output* output, std::vector<SerranoMessage>& msg_in ) {
 		execute_add<float>(msg_in, 0.0);
 	}
 
-	void execute_f64_add( SST::Output* output, std::vector<SerranoMessage*>& msg_in ) {
+	void execute_f64_add( SST::Output* output, std::vector<SerranoMessage>& msg_in ) {
 		execute_add<double>(msg_in, 0.0);
 	}
 	
-	std::vector<SerranoMessage*> msgs_in;
-	std::function< void( SST::Output*, std::vector<SerranoMessage*>& )> unit_func;
+	std::vector<SerranoMessage> msgs_in;
+	std::function< void( SST::Output*, std::vector<SerranoMessage>& )> unit_func;
 
 	size_t required_in_qs;
 	size_t required_out_qs;
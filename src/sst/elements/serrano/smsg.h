@@ -16,67 +16,63 @@
 #ifndef _H_SERRANO_MESSAGE
 #define _H_SERRANO_MESSAGE
 
+#include <algorithm>
+#include <cassert>
 #include <cstdint>
 #include <cinttypes>
+#include <cstring>
 
 namespace SST {
 namespace Serrano {
 
+// Largest payload carried by a message, big enough for every standard type.
+// Messages are plain values so queues can hold them in preallocated rings.
+#define SERRANO_MAX_MSG_BYTES 16
+
 class SerranoMessage {
 
 public:
-	SerranoMessage( const size_t size ) : msg_size(size) {
-		payload = new uint8_t[ msg_size ];
-	}
-
-	SerranoMessage( const size_t size, void* ptr ) : msg_size(size) {
-		payload = new uint8_t[ msg_size ];
+	SerranoMessage() : msg_size(0) {}
 
-		uint8_t* ptr_u = (uint8_t*) ptr;
-
-		for( size_t i = 0; i < msg_size; ++i ) {
-			payload[i] = ptr_u[i];
-		}
+	SerranoMessage( const size_t size ) : msg_size(size) {
+		assert( msg_size <= SERRANO_MAX_MSG_BYTES );
 	}
 
-	~SerranoMessage() {
-		delete[] payload;
+	SerranoMessage( const size_t size, const void* ptr ) : msg_size(size) {
+		assert( msg_size <= SERRANO_MAX_MSG_BYTES );
+		std::memcpy( payload, ptr, msg_size );
 	}
 
 	size_t getSize() const { return msg_size; }
 	uint8_t* getPayload() { return payload; }
+	const uint8_t* getPayload() const { return payload; }
 
 	void setPayload( const uint8_t* new_data ) {
-		for( size_t i = 0; i < msg_size; ++i ) {
-			payload[i] = new_data[i];
-		}
+		std::memcpy( payload, new_data, msg_size );
 	}
 
 	void setPayload( const uint8_t* new_data, const size_t new_size ) {
-		for( size_t i = 0; i < std::min( new_size, msg_size); ++i ) {
-			payload[i] = new_data[i];
-		}
+		std::memcpy( payload, new_data, std::min( new_size, msg_size ) );
 	}
 
 protected:
-	const size_t msg_size;
-	uint8_t* payload;
+	size_t msg_size;
+	uint8_t payload[SERRANO_MAX_MSG_BYTES];
 
 };
 
-template<class T> SerranoMessage* constructMessage( T value ) {
-	SerranoMessage* new_msg = new SerranoMessage( sizeof(T) );
-	new_msg->setPayload( (uint8_t*) &value );
-
-	return new_msg;
+template<class T> SerranoMessage constructMessage( T value ) {
+	return SerranoMessage( sizeof(T), &value );
 };
 
-template<class T> T extractValue( SST::Output* output, SerranoMessage* msg ) {
-	if( sizeof(T) == msg->getSize() ) {
-		return *( (T*) msg->getPayload() );
+template<class T> T extractValue( SST::Output* output, const SerranoMessage& msg ) {
+	if( sizeof(T) == msg.getSize() ) {
+		T value;
+		std::memcpy( &value, msg.getPayload(), sizeof(T) );
+		return value;
 	} else {
 		output->fatal(CALL_INFO, -1, "Error: tried to construct a value needing %d bytes from a message with %d bytes in payload.\n",
-			(int) sizeof(T), (int) msg->getSize());
+			(int) sizeof(T), (int) msg.getSize());
 
 		return T();
 	}
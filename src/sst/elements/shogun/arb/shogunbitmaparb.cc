@@ -0,0 +1,91 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+
+#include "shogun_event.h"
+#include "shogunbitmaparb.h"
+#include "shogun_stat_bundle.h"
+
+using namespace SST::Shogun;
+
+ShogunBitmapArbitrator::ShogunBitmapArbitrator(ShogunPortMasks* m)
+    : masks(m), lastStart(0)
+{
+}
+
+ShogunBitmapArbitrator::~ShogunBitmapArbitrator() {}
+
+void ShogunBitmapArbitrator::moveEvents(const int num_events,
+                                        const int port_count,
+                                        ShogunQueue<ShogunEvent*>** inputQueues,
+                                        int32_t output_slots,
+                                        ShogunEvent*** outputEvents,
+                                        uint64_t cycle ) {
+
+    output->verbose(CALL_INFO, 4, 0, "BEGIN: Arbitration (bitmap) -----------------------------------------\n");
+    output->verbose(CALL_INFO, 4, 0, "-> start: %" PRIi32 "\n", lastStart);
+
+    int32_t moved_count = 0;
+
+    // Same visiting order as the round-robin scan: lastStart up to the
+    // last port, then wrap around to the ports before lastStart
+    for (int port = masks->inputBusy.nextSet(lastStart); port != -1; port = masks->inputBusy.nextSet(port + 1)) {
+        moved_count += movePort(port, num_events, inputQueues[port], outputEvents);
+    }
+
+    for (int port = masks->inputBusy.nextSet(0); port != -1 && port < lastStart; port = masks->inputBusy.nextSet(port + 1)) {
+        moved_count += movePort(port, num_events, inputQueues[port], outputEvents);
+    }
+
+    lastStart = (lastStart + 1) % port_count;
+
+    bundle->getPacketsMoved()->addData(moved_count);
+    output->verbose(CALL_INFO, 4, 0, "-> next-start: %" PRIi32 "\n", lastStart);
+    output->verbose(CALL_INFO, 4, 0, "END: Arbitration ----------------------------------------------------\n");
+}
+
+int ShogunBitmapArbitrator::movePort(const int port, const int num_events, ShogunQueue<ShogunEvent*>* inputQ,
+                                     ShogunEvent*** outputEvents) {
+    int moved = 0;
+
+    output->verbose(CALL_INFO, 4, 0, "-> processing port: %" PRIi32 ", event-count: %" PRIi32 " out of %" PRIi32 "\n", port,
+                    inputQ->count(), num_events);
+
+    while (moved < num_events || num_events == -1) {
+        const int dest = inputQ->peek()->getDestination();
+        const int slot = masks->slotsUsed[dest].nextClear(0);
+
+        if (-1 == slot) {
+            output->verbose(CALL_INFO, 4, 0, "  (%" PRIi32 ")-> output queue full...\n", moved);
+            break;
+        }
+
+        output->verbose(CALL_INFO, 4, 0, "  (%" PRIi32 ")-> moving event from: %" PRIi32 " to: %" PRIi32 " slot %" PRIi32 "\n",
+                        moved, port, dest, slot);
+
+        outputEvents[dest][slot] = inputQ->pop();
+        masks->slotsUsed[dest].set(slot);
+        masks->outputBusy.set(dest);
+        moved++;
+
+        if (inputQ->empty()) {
+            masks->inputBusy.clear(port);
+            break;
+        }
+    }
+
+    return moved;
+}
@@ -0,0 +1,53 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_SHOGUN_BITMAP_ARB_H
+#define _H_SHOGUN_BITMAP_ARB_H
+
+#include "shogun_bitmap.h"
+#include "shogun_event.h"
+#include "shogunarb.h"
+
+namespace SST {
+namespace Shogun {
+
+    // Round-robin arbitration over the ports whose input bit is set.  Grants
+    // are identical to ShogunRoundRobinArbitrator but idle ports and full
+    // output slots are skipped with bit operations.
+    class ShogunBitmapArbitrator : public ShogunArbitrator {
+
+    public:
+        ShogunBitmapArbitrator(ShogunPortMasks* masks);
+        ~ShogunBitmapArbitrator();
+
+        void moveEvents(const int num_events,
+                        const int port_count,
+                        ShogunQueue<ShogunEvent*>** inputQueues,
+                        int32_t output_slots,
+                        ShogunEvent*** outputEvents,
+                        uint64_t cycle ) override;
+
+    private:
+        ShogunPortMasks* masks;
+        int lastStart;
+
+        int movePort(const int port, const int num_events, ShogunQueue<ShogunEvent*>* inputQ,
+                     ShogunEvent*** outputEvents);
+    };
+
+}
+}
+
+#endif
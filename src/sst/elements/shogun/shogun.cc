@@ -19,6 +19,7 @@
 #include <sst/core/output.h>
 #include <sst/core/unitAlgebra.h>
 
+#include "arb/shogunbitmaparb.h"
 #include "arb/shogunrrarb.h"
 #include "shogun.h"
 #include "shogun_credit_event.h"
@@ -43,14 +44,11 @@ ShogunComponent::ShogunComponent(ComponentId_t id, Params& params)
     previousCycle = 0;
     pending_events = 0;
 
-    arb = new ShogunRoundRobinArbitrator();
-
     const int32_t verbosity = params.find<uint32_t>("verbose", 0);
 
     char prefix[256];
     snprintf(prefix, 256, "[t=@t][%s]: ", getName().c_str());
     output = new SST::Output(prefix, verbosity, 0, Output::STDOUT);
-    arb->setOutput(output);
 
     port_count = params.find<int32_t>("port_count", -1);
 
@@ -65,6 +63,19 @@ ShogunComponent::ShogunComponent(ComponentId_t id, Params& params)
         output->fatal(CALL_INFO, -1, "Error: you specified a port count of less than or equal to zero.\n");
     }
 
+    const std::string arbitration = params.find<std::string>("arbitration", "roundrobin");
+    if ("roundrobin" == arbitration) {
+        useMasks = false;
+        arb = new ShogunRoundRobinArbitrator();
+    } else if ("bitmap" == arbitration) {
+        useMasks = true;
+        masks.configure(port_count, output_message_slots);
+        arb = new ShogunBitmapArbitrator(&masks);
+    } else {
+        output->fatal(CALL_INFO, -1, "Error: unknown arbitration scheme \"%s\", use roundrobin or bitmap.\n", arbitration.c_str());
+    }
+    arb->setOutput(output);
+
     output->verbose(CALL_INFO, 1, 0, "Connecting %" PRIi32 " links...\n", port_count);
     links = (SST::Link**)malloc(sizeof(SST::Link*) * (port_count));
     char* linkName = new char[256];
@@ -150,7 +161,11 @@ bool ShogunComponent::tick(SST::Cycle_t currentCycle)
     printStatus();
 
     // Send any events which can be sent this cycle
-    emitOutputs();
+    if (useMasks) {
+        emitMaskedOutputs();
+    } else {
+        emitOutputs();
+    }
 
     printStatus();
 
@@ -241,6 +256,34 @@ void ShogunComponent::emitOutputs()
     output->verbose(CALL_INFO, 4, 0, "END: emitOutputs -------------------------------------------------\n");
 }
 
+void ShogunComponent::emitMaskedOutputs()
+{
+    output->verbose(CALL_INFO, 4, 0, "BEGIN: emitOutputs (bitmap) --------------------------------------\n");
+
+    for (int32_t i = masks.outputBusy.nextSet(0); i != -1; i = masks.outputBusy.nextSet(i + 1)) {
+        ShogunBitmap& used = masks.slotsUsed[i];
+
+        for (int32_t j = used.nextSet(0); j != -1 && remote_output_slots[i] > 0; j = used.nextSet(j + 1)) {
+            output->verbose(CALL_INFO, 4, 0, "-> port %" PRIi32 " sending event from slot %" PRIi32 " (free %" PRIi32 " slots), src=%5" PRIi32 "\n",
+                i, j, remote_output_slots[i], pendingOutputs[i][j]->getSource());
+            stats->getOutputPacketCount(i)->addData(1);
+
+            links[i]->send( pendingOutputs[i][j] );
+            links[ pendingOutputs[i][j]->getSource() ]->send( new ShogunCreditEvent() );
+            pendingOutputs[i][j] = nullptr;
+            used.clear(j);
+            remote_output_slots[i]--;
+            pending_events--;
+        }
+
+        if (!used.any()) {
+            masks.outputBusy.clear(i);
+        }
+    }
+
+    output->verbose(CALL_INFO, 4, 0, "END: emitOutputs -------------------------------------------------\n");
+}
+
 void ShogunComponent::clearOutputs()
 {
     for (int32_t i = 0; i < port_count; ++i) {
@@ -261,6 +304,10 @@ void ShogunComponent::clearInputs()
 
 void ShogunComponent::printStatus()
 {
+    if (output->getVerboseLevel() < 4) {
+        return;
+    }
+
     output->verbose(CALL_INFO, 4, 0, "BEGIN: processing x-bar inputs -----------------------------------------------\n");
     output->verbose(CALL_INFO, 4, 0, "BEGIN X-BAR STATUS REPORT ====================================================\n");
 
@@ -297,6 +344,10 @@ void ShogunComponent::handleIncoming(SST::Event* event)
 
         inputQueues[src_port]->push(incomingShogunEv);
         pending_events++;
+
+        if (useMasks) {
+            masks.inputBusy.set(src_port);
+        }
         stats->getInputPacketCount(src_port)->addData(1);
 
         // Reregister clock handler in the event that it has not been done
@@ -22,6 +22,7 @@
 #include <sst/core/params.h>
 
 #include "arb/shogunarb.h"
+#include "shogun_bitmap.h"
 #include "shogun_event.h"
 #include "shogun_q.h"
 
@@ -45,7 +46,7 @@ public:
     SST_ELI_DOCUMENT_PARAMS(
         { "verbose",                "Level of output verbosity, higher is more output, 0 is no output", 0 },
         { "port_count",             "Number of ports on the Crossbar", "0" },
-        { "arbitration",            "Select the arbitration scheme", "roundrobin" },
+        { "arbitration",            "Select the arbitration scheme: roundrobin scans every port each cycle, bitmap only visits ports with queued or outgoing events (same grants)", "roundrobin" },
         { "clock",                  "Clock Frequency for the crossbar", "1.0GHz" },
         { "queue_slots",            "Depth of input queue", "64" },
         { "in_msg_per_cycle",       "Number of messages injested per cycle; -1 is unlimited", "1" },
@@ -91,6 +92,7 @@ private:
     void clearOutputs();
     void populateInputs();
     void emitOutputs();
+    void emitMaskedOutputs();
 
     uint64_t previousCycle;
 
@@ -110,6 +112,9 @@ private:
     int32_t* remote_output_slots;
     ShogunArbitrator* arb;
 
+    bool useMasks;
+    ShogunPortMasks masks;
+
     SST::Output* output;
     Statistic<uint64_t>* zeroEventCycles;
     Statistic<uint64_t>* eventCycles;
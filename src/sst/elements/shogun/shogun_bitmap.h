@@ -0,0 +1,124 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_SHOGUN_BITMAP
+#define _H_SHOGUN_BITMAP
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace SST {
+namespace Shogun {
+
+    class ShogunBitmap {
+
+    public:
+        ShogunBitmap(const int bitCount = 0)
+        {
+            resize(bitCount);
+        }
+
+        void resize(const int bitCount)
+        {
+            bits = bitCount;
+            words.assign((bitCount + 63) / 64, 0);
+        }
+
+        void set(const int i)
+        {
+            words[i >> 6] |= (UINT64_C(1) << (i & 63));
+        }
+
+        void clear(const int i)
+        {
+            words[i >> 6] &= ~(UINT64_C(1) << (i & 63));
+        }
+
+        bool test(const int i) const
+        {
+            return (words[i >> 6] >> (i & 63)) & 1;
+        }
+
+        bool any() const
+        {
+            for (uint64_t w : words) {
+                if (0 != w) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Index of the first set bit at or after from, -1 if there is none
+        int nextSet(const int from) const
+        {
+            return scan(from, 0);
+        }
+
+        // Index of the first clear bit at or after from, -1 if there is none
+        int nextClear(const int from) const
+        {
+            return scan(from, ~UINT64_C(0));
+        }
+
+    private:
+        int bits;
+        std::vector<uint64_t> words;
+
+        int scan(const int from, const uint64_t invert) const
+        {
+            if (from >= bits) {
+                return -1;
+            }
+
+            size_t w = from >> 6;
+            uint64_t word = (words[w] ^ invert) & (~UINT64_C(0) << (from & 63));
+
+            while (true) {
+                if (0 != word) {
+                    const int i = (int)(w * 64) + __builtin_ctzll(word);
+                    return i < bits ? i : -1;
+                }
+
+                if (++w == words.size()) {
+                    return -1;
+                }
+
+                word = words[w] ^ invert;
+            }
+        }
+    };
+
+    // Occupancy of the crossbar kept as bitmaps: which ports have queued
+    // input, which have events waiting to leave, and per port which
+    // output slots are in use.
+    struct ShogunPortMasks {
+        ShogunBitmap inputBusy;
+        ShogunBitmap outputBusy;
+        std::vector<ShogunBitmap> slotsUsed;
+
+        void configure(const int port_count, const int output_slots)
+        {
+            inputBusy.resize(port_count);
+            outputBusy.resize(port_count);
+            slotsUsed.assign(port_count, ShogunBitmap(output_slots));
+        }
+    };
+
+}
+}
+
+#endif
@@ -6,6 +6,10 @@ try:
 except ImportError:
     import configparser as ConfigParser
 
+parser = argparse.ArgumentParser()
+parser.add_argument("--arbitration", default="roundrobin", help="Crossbar arbitration scheme (roundrobin or bitmap)")
+args, unknown = parser.parse_known_args()
+
 # Define SST core options
 sst.setProgramOption("timebase", "1ps")
 
@@ -52,6 +56,7 @@ router.addParams({
    "in_msg_per_cycle" : "1",
    "out_msg_per_cycle" : "1",
    "port_count" : router_ports,
+   "arbitration" : args.arbitration,
 })
 
 for cpu_id in range(num_cpu):
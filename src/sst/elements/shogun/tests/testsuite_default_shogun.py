@@ -22,24 +22,33 @@ class testcase_shogun(SSTTestCase):
     def test_shogun_hierarchy_test(self):
         self.shogun_test_template("hierarchy_test")
 
+    # Bitmap arbitration grants the same events as the round-robin scan, so
+    # it is checked against the round-robin reference output
+    def test_shogun_hierarchy_test_bitmap(self):
+        self.shogun_test_template("hierarchy_test", testname="hierarchy_test_bitmap",
+                                  otherargs='--model-options="--arbitration=bitmap"')
+
 #####
 
-    def shogun_test_template(self, testcase):
+    def shogun_test_template(self, testcase, testname=None, otherargs=""):
         # Get the path to the test files
         test_path = self.get_testsuite_dir()
         outdir = self.get_test_output_run_dir()
         tmpdir = self.get_test_output_tmp_dir()
 
         # Set the various file paths
-        testDataFileName="test_shogun_{0}".format(testcase)
+        if testname is None:
+            testname = testcase
+        testDataFileName="test_shogun_{0}".format(testname)
+        refDataFileName="test_shogun_{0}".format(testcase)
 
         sdlfile = "{0}/{1}.py".format(test_path, testcase)
-        reffile = "{0}/refFiles/{1}.out".format(test_path, testDataFileName)
+        reffile = "{0}/refFiles/{1}.out".format(test_path, refDataFileName)
         outfile = "{0}/{1}.out".format(outdir, testDataFileName)
         errfile = "{0}/{1}.err".format(outdir, testDataFileName)
         mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
 
-        self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles)
+        self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, mpi_out_files=mpioutfiles)
 
         testing_remove_component_warning_from_file(outfile)
 
@@ -52,9 +61,9 @@ class testcase_shogun(SSTTestCase):
         if os_test_file(errfile, "-s"):
             log_testing_note("shogun test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
 
-        cmp_result = testing_compare_sorted_diff(testcase, outfile, reffile)
+        cmp_result = testing_compare_sorted_diff(testname, outfile, reffile)
         if (cmp_result == False):
-            diffdata = testing_get_diff_data(testcase)
+            diffdata = testing_get_diff_data(testname)
             log_failure(diffdata)
         self.assertTrue(cmp_result, "Sorted Output file {0} does not match sorted Reference File {1}".format(outfile, reffile))
 
@@ -30,6 +30,8 @@
 #include <cstdint>
 #include <vector>
 #include <queue>
+#include <unordered_map>
+#include <algorithm>
 
 using namespace SST::Interfaces;
 
@@ -54,7 +56,8 @@ public:
             { "max_loads", "Set the maximum number of loads permitted in the queue", "16" },
             { "address_mask", "Can mask off address bits if needed during construction of a operation", "0xFFFFFFFFFFFFFFFF"},
             { "issues_per_cycle", "Maximum number of issues the LSQ can attempt per cycle.", "2"},
-            { "cache_line_width", "Number of bytes in a (L1) cache line", "64"}
+            { "cache_line_width", "Number of bytes in a (L1) cache line", "64"},
+            { "store_forwarding", "Forward data from pending stores to loads which are fully covered by them instead of stalling the load", "false"}
         )
 
     SST_ELI_DOCUMENT_STATISTICS({ "bytes_read", "Count all the bytes read for data operations", "bytes", 1 },
@@ -70,7 +73,9 @@ public:
                                 { "stores_in_flight", "Count the number of stores which are in-flight", "operations", 1},
                                 { "store_buffer_entries", "Count the number of stores held in the store buffer", "operations", 1},
                                 { "split_stores", "Count the number of stores which are fractured due to cache boundaries", "operations", 1},
-                                { "split_loads", "Count the number of loads which are fractured due to cache boundaries", "operations", 1})
+                                { "split_loads", "Count the number of loads which are fractured due to cache boundaries", "operations", 1},
+                                { "loads_forwarded", "Count the number of loads satisfied by forwarding from a pending store (only with store_forwarding)", "operations", 1},
+                                { "load_store_conflicts", "Count the number of load issue attempts stalled by an overlapping store which could not forward (only with store_forwarding)", "operations", 1})
 
     VanadisBasicLoadStoreQueue(ComponentId_t id, Params& params, int coreid, int hwthreads) : VanadisLoadStoreQueue(id, params, coreid, hwthreads),
         max_stores(params.find<size_t>("max_stores", 8)),
@@ -87,6 +92,7 @@ public:
         address_mask = params.find<uint64_t>("address_mask", 0xFFFFFFFFFFFFFFFFULL);
 
         cache_line_width = params.find<uint64_t>("cache_line_width", 64);
+        store_forwarding = params.find<bool>("store_forwarding", false);
 
         op_q.resize(hw_threads);
         op_q_index = 0;
@@ -96,6 +102,9 @@ public:
         stores_pending_index = 0;
         stores_pending_size = 0;
 
+        store_line_index.resize(hw_threads);
+        store_sequence = 0;
+
         stat_loads_issued = registerStatistic<uint64_t>("loads_issued", "1");
         stat_stores_issued = registerStatistic<uint64_t>("stores_issued", "1");
         stat_fences_issued = registerStatistic<uint64_t>("fences_issued", "1");
@@ -111,6 +120,14 @@ public:
         stat_stores_pending = registerStatistic<uint64_t>("stores_in_flight", "1");
         stat_loads_pending = registerStatistic<uint64_t>("loads_in_flight", "1");
         stat_op_q_size = registerStatistic<uint64_t>("operations_pending");
+
+        stat_loads_forwarded = nullptr;
+        stat_load_store_conflicts = nullptr;
+
+        if(store_forwarding) {
+            stat_loads_forwarded = registerStatistic<uint64_t>("loads_forwarded", "1");
+            stat_load_store_conflicts = registerStatistic<uint64_t>("load_store_conflicts", "1");
+        }
     }
 
     virtual ~VanadisBasicLoadStoreQueue() {
@@ -171,6 +188,7 @@ public:
         }
 
         stores_pending_size -= stores_pending[thread].size();
+        store_line_index[thread].clear();
         for(auto store_itr = stores_pending[thread].begin(); store_itr != stores_pending[thread].end(); ) {
             delete (*store_itr);
             store_itr = stores_pending[thread].erase(store_itr);
@@ -319,7 +337,6 @@ protected:
             uint16_t target_isa_reg = 0;
             uint64_t reg_offset  = load_ins->getRegisterOffset();
             uint64_t addr_offset = ev->vAddr - load_address;
-            uint32_t reg_width = 0;
 
             if(out->getVerboseLevel() >= 8) {
                 std::ostringstream str;
@@ -337,83 +354,7 @@ protected:
             }
 
 
-            switch(load_ins->getValueRegisterType()) {
-            case LOAD_INT_REGISTER: {
-
-                if ( ! load_ins->trapsError() ) {;
-
-                target_isa_reg = load_ins->getISAIntRegOut(0);
-                target_reg = load_ins->getPhysIntRegOut(0);
-
-                assert(target_isa_reg < load_ins->getISAOptions()->countISAIntRegisters());
-
-                if(target_reg != load_ins->getISAOptions()->getRegisterIgnoreWrites()) {
-                    reg_width = lsq->registerFiles->at(hw_thr)->getIntRegWidth();
-                    std::vector<uint8_t> register_value(reg_width);
-                    // copy entire register here
-                    lsq->registerFiles->at(hw_thr)->copyFromIntRegister(target_reg, 0, &register_value[0], reg_width);
-
-                    assert((reg_offset + addr_offset + ev->size) <= reg_width);
-
-                    for(auto i = 0; i < ev->size; ++i) {
-                        register_value.at(reg_offset + addr_offset + i) = ev->data[i];
-                    }
-
-                    // if we are the last request to be processed for this load (if any were split)
-                    // and we promised to do sign extension, then perform it now
-                    if(load_entry->countRequests() == 1) {
-                        if(load_ins->performSignExtension()) {
-                            if((register_value.at(reg_offset + addr_offset + load_width - 1) & 0x80) != 0) {
-                                for(auto i = reg_offset + addr_offset + load_width; i < reg_width; ++i) {
-                                    register_value.at(i) = 0xFF;
-                                }
-                            } else {
-                                for(auto i = reg_offset + addr_offset + load_width; i < reg_width; ++i) {
-                                    register_value.at(i) = 0x00;
-                                }
-                            }
-                        } else {
-                            for(auto i = reg_offset + addr_offset + load_width; i < reg_width; ++i) {
-                                register_value.at(i) = 0x00;
-                            }
-                        }
-                    }
-
-                    lsq->registerFiles->at(hw_thr)->copyToIntRegister(target_reg, 0, &register_value[0], register_value.size());
-                }
-                }
-            } break;
-            case LOAD_FP_REGISTER: {
-
-                if ( ! load_ins->trapsError() ) {
-
-                target_isa_reg = load_ins->getISAFPRegOut(0);
-                target_reg = load_ins->getPhysFPRegOut(0);
-
-                reg_width = lsq->registerFiles->at(hw_thr)->getFPRegWidth();
-                std::vector<uint8_t> register_value(reg_width);
-
-                // copy entire register here
-                lsq->registerFiles->at(hw_thr)->copyFromFPRegister(target_reg, 0, &register_value[0], reg_width);
-
-                assert((reg_offset + addr_offset + ev->size) <= reg_width);
-
-                for(auto i = reg_offset + addr_offset; i < ev->size; ++i) {
-                    register_value.at(reg_offset + addr_offset + i) = ev->data[i];
-                }
-
-                if(load_entry->countRequests() == 1) {
-                    for(auto i = reg_offset + addr_offset + load_width; i < reg_width; ++i) {
-                        register_value.at(i) = 0xff;
-                    }
-                }
-
-                lsq->registerFiles->at(hw_thr)->copyToFPRegister(target_reg, 0, &register_value[0], reg_width);
-                }
-            } break;
-            default:
-                out->fatal(CALL_INFO, -1, "Unknown register type.\n");
-            }
+            lsq->copyLoadDataToRegister(load_ins, addr_offset, &ev->data[0], ev->size, load_entry->countRequests() == 1);
 
             ///////////////////////////////////////////////////////////////////////////////////
 
@@ -504,6 +445,7 @@ protected:
                     }
 
                     store_entry->getInstruction()->markExecuted();
+                    lsq->unindexStore(thr, store_entry);
                     lsq->stores_pending[thr].erase(lsq->stores_pending[thr].begin());
                     lsq->stores_pending_size--;
                     delete store_entry;
@@ -512,6 +454,7 @@ protected:
                 case MEM_TRANSACTION_LOCK:
                 {
                     store_entry->getInstruction()->markExecuted();
+                    lsq->unindexStore(thr, store_entry);
                     lsq->stores_pending[thr].erase(lsq->stores_pending[thr].begin());
                     lsq->stores_pending_size--;
                     delete store_entry;
@@ -576,6 +519,7 @@ protected:
 
                 // this was a standard store (not LLSC/LOCK) and we issued into system successfully
                 if(LIKELY(issue_result)) {
+                    unindexStore(thr, current_store);
                     stores_pending[thr].pop_front();
                     stores_pending_size--;
                     delete current_store;
@@ -758,6 +702,126 @@ protected:
         return false;
     }
 
+    // write data returned for a load (from memory or forwarded from a store) into the load's
+    // target register, if this is the last piece of the load then extend to the full register width
+    void copyLoadDataToRegister(VanadisLoadInstruction* load_ins, uint64_t addr_offset, const uint8_t* data,
+            uint64_t data_size, bool last_request) {
+        const uint16_t load_width = data_size;
+        const uint32_t hw_thr     = load_ins->getHWThread();
+
+        uint16_t target_reg = 0;
+        uint16_t target_isa_reg = 0;
+        uint64_t reg_offset  = load_ins->getRegisterOffset();
+        uint32_t reg_width = 0;
+
+        switch(load_ins->getValueRegisterType()) {
+        case LOAD_INT_REGISTER: {
+
+            if ( ! load_ins->trapsError() ) {;
+
+            target_isa_reg = load_ins->getISAIntRegOut(0);
+            target_reg = load_ins->getPhysIntRegOut(0);
+
+            assert(target_isa_reg < load_ins->getISAOptions()->countISAIntRegisters());
+
+            if(target_reg != load_ins->getISAOptions()->getRegisterIgnoreWrites()) {
+                reg_width = registerFiles->at(hw_thr)->getIntRegWidth();
+                std::vector<uint8_t> register_value(reg_width);
+                // copy entire register here
+                registerFiles->at(hw_thr)->copyFromIntRegister(target_reg, 0, &register_value[0], reg_width);
+
+                assert((reg_offset + addr_offset + data_size) <= reg_width);
+
+                for(auto i = 0; i < data_size; ++i) {
+                    register_value.at(reg_offset + addr_offset + i) = data[i];
+                }
+
+                // if we are the last request to be processed for this load (if any were split)
+                // and we promised to do sign extension, then perform it now
+                if(last_request) {
+                    if(load_ins->performSignExtension()) {
+                        if((register_value.at(reg_offset + addr_offset + load_width - 1) & 0x80) != 0) {
+                            for(auto i = reg_offset + addr_offset + load_width; i < reg_width; ++i) {
+                                register_value.at(i) = 0xFF;
+                            }
+                        } else {
+                            for(auto i = reg_offset + addr_offset + load_width; i < reg_width; ++i) {
+                                register_value.at(i) = 0x00;
+                            }
+                        }
+                    } else {
+                        for(auto i = reg_offset + addr_offset + load_width; i < reg_width; ++i) {
+                            register_value.at(i) = 0x00;
+                        }
+                    }
+                }
+
+                registerFiles->at(hw_thr)->copyToIntRegister(target_reg, 0, &register_value[0], register_value.size());
+            }
+            }
+        } break;
+        case LOAD_FP_REGISTER: {
+
+            if ( ! load_ins->trapsError() ) {
+
+            target_isa_reg = load_ins->getISAFPRegOut(0);
+            target_reg = load_ins->getPhysFPRegOut(0);
+
+            reg_width = registerFiles->at(hw_thr)->getFPRegWidth();
+            std::vector<uint8_t> register_value(reg_width);
+
+            // copy entire register here
+            registerFiles->at(hw_thr)->copyFromFPRegister(target_reg, 0, &register_value[0], reg_width);
+
+            assert((reg_offset + addr_offset + data_size) <= reg_width);
+
+            for(auto i = reg_offset + addr_offset; i < data_size; ++i) {
+                register_value.at(reg_offset + addr_offset + i) = data[i];
+            }
+
+            if(last_request) {
+                for(auto i = reg_offset + addr_offset + load_width; i < reg_width; ++i) {
+                    register_value.at(i) = 0xff;
+                }
+            }
+
+            registerFiles->at(hw_thr)->copyToFPRegister(target_reg, 0, &register_value[0], reg_width);
+            }
+        } break;
+        default:
+            output->fatal(CALL_INFO, -1, "Unknown register type.\n");
+        }
+    }
+
+    // satisfy a load directly from the value held by a pending (older) store which covers it
+    void forwardStoreToLoad(VanadisBasicStorePendingEntry* store_entry, VanadisLoadInstruction* load_ins,
+            uint64_t load_address, uint64_t load_width) {
+        VanadisStoreInstruction* store_ins = store_entry->getStoreInstruction();
+        const uint64_t store_width = store_entry->getStoreWidth();
+        std::vector<uint8_t> store_value(store_width);
+
+        registerFiles->at(store_entry->getHWThread())->copyFromRegister(store_ins->getValueRegisterType() == STORE_FP_REGISTER ?
+            store_ins->getPhysFPRegIn(0) : store_ins->getPhysIntRegIn(1), store_ins->getRegisterOffset(), &store_value[0], store_width,
+            store_ins->getValueRegisterType() == STORE_FP_REGISTER);
+
+        if(output->getVerboseLevel() >= 9) {
+            output->verbose(CALL_INFO, 9, VANADIS_DBG_LSQ_LOAD_FLG, "---> [memory-transaction]: load ins: 0x%" PRI_ADDR " / thr: %" PRIu32 " forwarded from store ins: 0x%" PRI_ADDR " (load-addr: 0x%" PRI_ADDR " / width: %" PRIu64 " / store-addr: 0x%" PRI_ADDR " / width: %" PRIu64 ")\n",
+                load_ins->getInstructionAddress(), load_ins->getHWThread(), store_ins->getInstructionAddress(),
+                load_address, load_width, store_entry->getStoreAddress(), store_width);
+        }
+
+        if(load_address < 64) {
+            load_ins->flagError();
+        }
+
+        copyLoadDataToRegister(load_ins, 0, &store_value[load_address - store_entry->getStoreAddress()], load_width, true);
+
+        load_ins->markExecuted();
+        stat_loads_executed->addData(1);
+        stat_loads_forwarded->addData(1);
+        stat_loaded_bytes->addData(load_width);
+    }
+
     void issueLoad(VanadisLoadInstruction* load_ins, uint64_t load_address, uint64_t load_width) {
         StandardMem::Request* load_req = nullptr;
 
@@ -934,8 +998,24 @@ protected:
                     }
 
                     // check to see if loading from this address would conflict with a store which
-                    // we have pending, if yes, wait for conflict to clear and then we can proceed
-                    if(UNLIKELY(checkStoreConflict(load_ins->getHWThread(), load_address, load_width))) {
+                    // we have pending, if yes, forward the store data when the youngest overlapping
+                    // store covers the whole load, otherwise wait for conflict to clear
+                    VanadisBasicStorePendingEntry* forward_store = nullptr;
+
+                    if(UNLIKELY(checkStoreConflict(load_ins->getHWThread(), load_address, load_width, &forward_store))) {
+                        if((nullptr != forward_store) && (load_ins->getTransactionType() == MEM_TRANSACTION_NONE)) {
+                            forwardStoreToLoad(forward_store, load_ins, load_address, load_width);
+
+                            delete op_q[thr].front();
+                            op_q[thr].pop_front();
+                            op_q_size--;
+                            return true;
+                        }
+
+                        if(store_forwarding) {
+                            stat_load_store_conflicts->addData(1);
+                        }
+
                         if(output->getVerboseLevel() >= 16) {
                             output->verbose(CALL_INFO, 16, 0, "---> load ins: 0x%" PRI_ADDR " / thr: %" PRIu32 " conflicts with store entry, will not issue until conflict is resolved (load-addr: 0x%" PRI_ADDR " / width: %" PRIu32 ")\n",
                                 load_ins->getInstructionAddress(), load_ins->getHWThread(), load_address, load_width);
@@ -1010,8 +1090,10 @@ protected:
                         store_ins, store_address, store_width, store_ins->getValueRegisterType(),
                         store_ins->getValueRegister());
 
+                    new_pending_store->setSequence(store_sequence++);
                     stores_pending[store_ins->getHWThread()].push_back(new_pending_store);
                     stores_pending_size++;
+                    indexStore(store_ins->getHWThread(), new_pending_store);
                 }
 
                 // clear the front entry as we have just processed it
@@ -1105,24 +1187,81 @@ protected:
         return matchID;
     }
 
-    bool checkStoreConflict(const uint32_t thread, const uint64_t address, const uint64_t width) {
-        bool conflicts = false;
+    // checks only the stores which touch the cache line(s) of the load. If the youngest overlapping
+    // store can supply every byte of the load it is returned in forward_from (if forwarding is enabled)
+    bool checkStoreConflict(const uint32_t thread, const uint64_t address, const uint64_t width,
+            VanadisBasicStorePendingEntry** forward_from) {
+        VanadisBasicStorePendingEntry* youngest = nullptr;
+        const uint64_t line_left  = address / cache_line_width;
+        const uint64_t line_right = (address + width - 1) / cache_line_width;
 
-        for(auto store_itr = stores_pending[thread].begin(); store_itr != stores_pending[thread].end(); store_itr++) {
-            VanadisBasicStorePendingEntry* current_entry = (*store_itr);
+        for(uint64_t line = line_left; line <= line_right; ++line) {
+            auto line_itr = store_line_index[thread].find(line);
 
-            if(UNLIKELY(current_entry->storeAddressOverlaps(address, width))) {
-                conflicts = true;
-                break;
+            if(line_itr == store_line_index[thread].end()) {
+                continue;
             }
+
+            for(auto store_itr = line_itr->second.begin(); store_itr != line_itr->second.end(); store_itr++) {
+                VanadisBasicStorePendingEntry* current_entry = (*store_itr);
+
+                if(UNLIKELY(current_entry->storeAddressOverlaps(address, width))) {
+                    if((nullptr == youngest) || (current_entry->getSequence() > youngest->getSequence())) {
+                        youngest = current_entry;
+                    }
+                }
+            }
+        }
+
+        if(nullptr == youngest) {
+            return false;
+        }
+
+        if(store_forwarding && (!youngest->isDispatched()) && youngest->storeAddressCovers(address, width) &&
+            (youngest->getStoreInstruction()->getTransactionType() == MEM_TRANSACTION_NONE)) {
+            (*forward_from) = youngest;
         }
 
-        return conflicts;
+        return true;
+    }
+
+    void indexStore(const uint32_t thread, VanadisBasicStorePendingEntry* store_entry) {
+        const uint64_t line_left  = store_entry->getStoreAddress() / cache_line_width;
+        const uint64_t line_right = (store_entry->getStoreAddress() + store_entry->getStoreWidth() - 1) / cache_line_width;
+
+        for(uint64_t line = line_left; line <= line_right; ++line) {
+            store_line_index[thread][line].push_back(store_entry);
+        }
+    }
+
+    void unindexStore(const uint32_t thread, VanadisBasicStorePendingEntry* store_entry) {
+        const uint64_t line_left  = store_entry->getStoreAddress() / cache_line_width;
+        const uint64_t line_right = (store_entry->getStoreAddress() + store_entry->getStoreWidth() - 1) / cache_line_width;
+
+        for(uint64_t line = line_left; line <= line_right; ++line) {
+            auto line_itr = store_line_index[thread].find(line);
+
+            if(line_itr == store_line_index[thread].end()) {
+                continue;
+            }
+
+            auto store_itr = std::find(line_itr->second.begin(), line_itr->second.end(), store_entry);
+            if(store_itr != line_itr->second.end()) {
+                line_itr->second.erase(store_itr);
+            }
+
+            if(line_itr->second.empty()) {
+                store_line_index[thread].erase(line_itr);
+            }
+        }
     }
 
     // Per-hardware-thread queues
     std::vector< std::deque<VanadisBasicLoadStoreEntry*> > op_q;
     std::vector< std::deque<VanadisBasicStorePendingEntry*> > stores_pending;
+    // per-thread index of stores_pending by cache line number (a store straddling lines appears in both)
+    std::vector< std::unordered_map<uint64_t, std::vector<VanadisBasicStorePendingEntry*>> > store_line_index;
+    uint64_t store_sequence;
     std::deque<VanadisBasicLoadPendingEntry*> loads_pending;
     std::set<StandardMem::Request::id_t> std_stores_in_flight;
     int op_q_index; // Next hw_thread to check in op_q queues
@@ -1140,6 +1279,7 @@ protected:
 
     uint64_t cache_line_width;
     uint64_t address_mask;
+    bool store_forwarding;
 
     Statistic<uint64_t>* stat_store_buffer_entries;
     Statistic<uint64_t>* stat_op_q_size;
@@ -1155,6 +1295,8 @@ protected:
     Statistic<uint64_t>* stat_split_loads;
     Statistic<uint64_t>* stat_stored_bytes;
     Statistic<uint64_t>* stat_loaded_bytes;
+    Statistic<uint64_t>* stat_loads_forwarded;
+    Statistic<uint64_t>* stat_load_store_conflicts;
 };
 
 } // namespace Vanadis
@@ -78,7 +78,7 @@ public:
     VanadisBasicStorePendingEntry(VanadisStoreInstruction* store_ins, uint64_t addr, uint64_t width, 
         VanadisStoreRegisterType valRegType, uint16_t valReg) : 
         VanadisBasicStoreEntry(store_ins), storeAddress(addr), storeWidth(width),
-        valueRegister(valReg), valueRegisterType(valRegType), dispatched(false) {}
+        valueRegister(valReg), valueRegisterType(valRegType), dispatched(false), sequence(0) {}
 
     ~VanadisBasicStorePendingEntry() {
         requests.clear();
@@ -91,6 +91,10 @@ public:
     uint64_t getStoreWidth() const { return storeWidth; }
     uint16_t getValueRegister() const { return valueRegister; }
 
+    // program-order position of the store within its hardware thread
+    uint64_t getSequence() const { return sequence; }
+    void     setSequence(uint64_t seq) { sequence = seq; }
+
     size_t   countRequests() const { return requests.size(); }
     void     addRequest(StandardMem::Request::id_t req) { requests.push_back(req); }
     void     removeRequest(StandardMem::Request::id_t req) {
@@ -164,6 +168,11 @@ public:
         return overlaps;
     }
 
+    // the load is entirely satisfied by the bytes this store will write
+    bool    storeAddressCovers(const uint64_t loadAddress, const uint64_t loadWidth) const {
+        return (loadAddress >= storeAddress) && ((loadAddress + loadWidth) <= (storeAddress + storeWidth));
+    }
+
     VanadisStoreRegisterType getValueRegisterType() const {
         return valueRegisterType;
     }
@@ -176,6 +185,7 @@ protected:
 
     bool dispatched;
     const VanadisStoreRegisterType valueRegisterType;
+    uint64_t sequence;
 };
 
 class VanadisBasicLoadEntry : public VanadisBasicLoadStoreEntry {
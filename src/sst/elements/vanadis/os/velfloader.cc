@@ -117,12 +117,8 @@ void loadElfFile( Output* output, Interfaces::StandardMem* mem_if, MMU_Lib::MMU*
 uint8_t* readElfPage( Output* output, VanadisELFInfo* elf_info, int vpn, int page_size ) {
     uint64_t virtAddr = vpn<<12;  
     auto path = elf_info->getBinaryPath();
-    output->verbose( CALL_INFO, 2, VANADIS_OS_DBG_READ_ELF, "-> Loading %s, to locate program sections ...\n", path);
     output->verbose( CALL_INFO, 2, VANADIS_OS_DBG_READ_ELF,"%s vpn=%d addr=%#" PRIx64 " page_size=%d\n",path,vpn,virtAddr,page_size);
-    FILE* exec_file = fopen(elf_info->getBinaryPath(), "rb");
-    if ( nullptr == exec_file ) {
-        output->fatal(CALL_INFO, -1, "Error: unable to open %s\n", path);
-    }
+
     uint8_t* data = new uint8_t[page_size];
     bzero(data, page_size); 
     const VanadisELFProgramHeaderEntry* secHdr = elf_info->findProgramHeader( virtAddr );
@@ -158,12 +154,11 @@ uint8_t* readElfPage( Output* output, VanadisELFInfo* elf_info, int vpn, int pag
         numBytes = secImageLen - imageOffset < numBytes ? secImageLen - imageOffset : numBytes;
     
         output->verbose( CALL_INFO, 2, VANADIS_OS_DBG_READ_ELF,"imageOffset=%zu dataOffset=%zu numBytes=%zu toEnd=%zu\n", imageOffset, dataOffset, numBytes, secImageLen - imageOffset );
-        fseek(exec_file, secImageOffset + imageOffset, SEEK_SET); 
 
-        fread( data + dataOffset, numBytes, 1, exec_file);
+        // the executable is mapped when its ELF info is read, copy straight from the mapping
+        elf_info->getImage()->copy( secImageOffset + imageOffset, data + dataOffset, numBytes );
     }
 
-    fclose(exec_file);
     return data; 
 }
 
@@ -29,6 +29,7 @@ void loadPages( SST::Output* output, SST::Interfaces::StandardMem* mem_if, MMU_L
     assert( 0 == buffer.size() % page_size );
 
     uint64_t pageVirtAddr = virtAddr; 
+    uint64_t offset = 0;
     int numPages = buffer.size() / page_size;
     for ( int i = 0; i < numPages ; i++ ) {
         uint64_t physAddr;
@@ -46,28 +47,14 @@ void loadPages( SST::Output* output, SST::Interfaces::StandardMem* mem_if, MMU_L
             physPageNum = pageVirtAddr >> shift;
         }
 
-#if 0 
-        // given sendUntimedData() only accepts a vector<uint8_t> we need to copy data into a properly sized vector 
-        std::vector< uint8_t > pageBuffer( buffer.begin() + offset, buffer.begin() + offset + page_size );
-#endif
+        output->verbose( CALL_INFO, 16, 0, "pageVirtAddr=%#" PRIx64 " physPageNum=%d physAddr=%#" PRIx64 "\n", pageVirtAddr, physPageNum, physAddr );
 
-        printf( "pageVirtAddr=%#" PRIx64 " physPageNum=%d physAddr=%#" PRIx64 "\n", pageVirtAddr, physPageNum, physAddr );
-        output->verbose( CALL_INFO, 2, 0, "pageVirtAddr=%#" PRIx64 " physPageNum=%d physAddr=%#" PRIx64 "\n", pageVirtAddr, physPageNum, physAddr );
-
-#if 1
-        uint64_t offset = 0;
-        for ( int num = 0; num < page_size/64; num++ ) {
-            std::vector< uint8_t > tmp( buffer.begin() + offset, buffer.begin() + offset + 64  );
-            Interfaces::StandardMem::Request* req = new SST::Interfaces::StandardMem::Write( physAddr + offset, tmp.size(), tmp );
-            printf("%s() %s\n",__func__,req->getString().c_str());
-            offset += 64;
-            mem_if->send(req);
+        // timed writes must not span cache lines so the page goes out as line-sized writes
+        for ( uint64_t lineOffset = 0; lineOffset < page_size; lineOffset += 64 ) {
+            auto start = buffer.begin() + offset + lineOffset;
+            mem_if->send( new SST::Interfaces::StandardMem::Write( physAddr + lineOffset, 64, std::vector<uint8_t>( start, start + 64 ) ) );
         }
 
-#else
-// This won't work for applications started after init
-        mem_if->sendUntimedData(new SST::Interfaces::StandardMem::Write( physAddr, page_size, pageBuffer ) );
-#endif
         pageVirtAddr += page_size;
         offset += page_size; 
     }
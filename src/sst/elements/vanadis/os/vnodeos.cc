@@ -97,6 +97,19 @@ VanadisNodeOSComponent::VanadisNodeOSComponent(SST::ComponentId_t id, SST::Param
     m_pageSize = params.find<uint64_t>("page_size", 4096);
     m_pageShift = log2( m_pageSize );
 
+    m_preloadElf = params.find<bool>("preload_elf", false);
+    m_preloadWriteSize = params.find<uint64_t>("preload_write_size", m_pageSize);
+    UnitAlgebra preloadLatency = UnitAlgebra(params.find<std::string>("preload_latency", "0ns"));
+
+    if ( m_preloadWriteSize == 0 || 0 != ( m_pageSize % m_preloadWriteSize ) ) {
+        output->fatal(CALL_INFO, -1, "preload_write_size (%" PRIu64 ") must evenly divide page_size (%d)\n", m_preloadWriteSize, m_pageSize);
+    }
+
+    if ( ! preloadLatency.hasUnits("s") ) {
+        output->fatal(CALL_INFO, -1, "preload_latency must be specified in units of time, e.g. 100ns\n");
+    }
+    m_preloadLatencyPs = (preloadLatency / UnitAlgebra("1ps")).getRoundedValue();
+
     if ( params.find<bool>("useMMU",false) ) { ;
         m_mmu = loadUserSubComponent<SST::MMU_Lib::MMU>("mmu");
         if ( nullptr == m_mmu ) {
@@ -212,6 +225,10 @@ VanadisNodeOSComponent::init(unsigned int phase) {
         m_mmu->init(phase);
     }
 
+    if ( 0 == phase && m_preloadElf && CHECKPOINT_LOAD != m_checkpoint ) {
+        preloadElfImages();
+    }
+
     // do we need to check for this, really?
     for (Link* next_link : core_links) {
         while (SST::Event* ev = next_link->recvUntimedData()) {
@@ -220,6 +237,69 @@ VanadisNodeOSComponent::init(unsigned int phase) {
     }
 }
 
+/*
+ * Push the text segment of every executable straight into memory with untimed writes and seed the
+ * ELF page cache with it, page faults on those pages then only need to map the cached physical page
+ */
+void
+VanadisNodeOSComponent::preloadElfImages() {
+    if ( nullptr == m_mmu ) {
+        output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_INIT, "preload_elf requires an MMU, pages will be faulted in\n");
+        return;
+    }
+
+    for ( auto& elf : m_elfMap ) {
+        VanadisELFInfo* elfInfo = elf.second;
+
+        for ( size_t i = 0; i < elfInfo->countProgramHeaders(); ++i ) {
+            const VanadisELFProgramHeaderEntry* hdr = elfInfo->getProgramHeader(i);
+
+            if ( PROG_HEADER_LOAD != hdr->getHeaderType() ) {
+                continue;
+            }
+
+            uint64_t virtAddrPage = hdr->getVirtualMemoryStart() & ~((uint64_t)m_pageSize - 1);
+            uint64_t virtAddrEnd = ( hdr->getVirtualMemoryStart() + hdr->getHeaderMemoryLength() + m_pageSize - 1 ) & ~((uint64_t)m_pageSize - 1);
+
+            // only the text region is shared through the page cache, the same test ProcessInfo uses to name it
+            if ( elfInfo->getEntryPoint() < virtAddrPage || elfInfo->getEntryPoint() >= virtAddrEnd ) {
+                continue;
+            }
+
+            for ( uint64_t virtAddr = virtAddrPage; virtAddr < virtAddrEnd; virtAddr += m_pageSize ) {
+                int vpn = virtAddr >> m_pageShift;
+
+                if ( nullptr != checkPageCache( elfInfo, vpn ) ) {
+                    continue;
+                }
+
+                OS::Page* page;
+                try {
+                    page = allocPage( );
+                } catch ( int err ) {
+                    output->fatal(CALL_INFO, -1, "Error: ran out of physical memory\n");
+                }
+
+                uint8_t* data = readElfPage( output, elfInfo, vpn, m_pageSize );
+                uint64_t physAddr = (uint64_t) page->getPPN() << m_pageShift;
+
+                for ( uint64_t offset = 0; offset < m_pageSize; offset += m_preloadWriteSize ) {
+                    std::vector<uint8_t> buffer( data + offset, data + offset + m_preloadWriteSize );
+                    mem_if->sendUntimedData( new StandardMem::Write( physAddr + offset, buffer.size(), buffer ) );
+                }
+                delete [] data;
+
+                updatePageCache( elfInfo, vpn, page );
+                ++m_preloadedPages[elfInfo];
+            }
+        }
+    }
+
+    for ( auto& pages : m_preloadedPages ) {
+        output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_INIT, "preloaded %" PRIu64 " text pages of %s\n", pages.second, pages.first->getBinaryPath());
+    }
+}
+
 void
 VanadisNodeOSComponent::setup() {
 
@@ -560,7 +640,14 @@ VanadisNodeOSComponent::startProcess( OS::HwThreadID& threadID, OS::ProcessInfo*
     output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_APP_INIT,
         "stack_pointer=%#" PRIx64 " entry=%#" PRIx64 "\n",stack_pointer, entry );
     
-    core_links.at(threadID.core)->send( new VanadisStartThreadFirstReq( threadID.hwThread, entry, stack_pointer ) );
+    // charge the modelled cost of this process's preloaded image before the first instruction can be fetched
+    uint64_t preloadedPages = 0;
+    auto preloaded = m_preloadedPages.find( process->getElfInfo() );
+    if ( preloaded != m_preloadedPages.end() ) {
+        preloadedPages = preloaded->second;
+    }
+    core_links.at(threadID.core)->send( m_preloadLatencyPs * preloadedPages, getTimeConverter("1ps"),
+        new VanadisStartThreadFirstReq( threadID.hwThread, entry, stack_pointer ) );
 }
 
 void VanadisNodeOSComponent::writeMem( OS::ProcessInfo* process, uint64_t virtAddr, std::vector<uint8_t>* data, int perms, unsigned pageSize, Callback* callback )
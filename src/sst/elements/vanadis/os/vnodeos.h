@@ -57,6 +57,9 @@ public:
                             { "physMemSize", "Size of available physical memory in bytes, with units. Ex: 2GiB", NULL },
                             { "page_size", "Size of a page, in bytes", "4096" },
                             { "useMMU", "Whether an MMU subcomponent is being used.", "False" },
+                            { "preload_elf", "Write the text segment of each executable into memory during init with untimed writes instead of faulting it in with timed writes. Requires useMMU.", "False" },
+                            { "preload_write_size", "Size of each untimed preload write in bytes. Use the memory interleave size if memory is interleaved at less than a page.", "page_size" },
+                            { "preload_latency", "Modelled latency charged per preloaded page. Each process starts after the pages of its own executable. Ex: 100ns", "0ns" },
                             { "process%(processnum)d.env_count", "Number of environment variables to pass to the process", "0"},
                             { "process%(processnum)d.env%(argnum)d", "Environment variable to pass to the process. Example: 'OMPNUMTHREADS=64'. 'argnum' should be contiguous starting at 0 and ending at env_count-1", ""},
                             { "proccess%(processnum)d.exe", "Name of executable, including path", NULL},
@@ -215,7 +218,7 @@ private:
     OS::Page* checkPageCache( VanadisELFInfo* elf_info , int vpn ) {
         auto iter = m_elfPageCache.find( elf_info ); 
         if ( iter != m_elfPageCache.end() ) {
-            auto tmp = iter->second; 
+            auto& tmp = iter->second; 
             auto iter2 = tmp.find(vpn);
             if ( iter2 != tmp.end() ) {
                 return iter2->second;
@@ -230,6 +233,8 @@ private:
 
     void writeMem( OS::ProcessInfo*, uint64_t virtAddr, std::vector<uint8_t>* data, int perms, unsigned pageSize, Callback* callback );
 
+    void preloadElfImages();
+
     template<typename T>
     T convertEvent( std::string name, VanadisSyscallEvent* sys_ev ) {
         output->verbose(CALL_INFO, 16, VANADIS_OS_DBG_SYSCALL, "-> call is %s()\n",name.c_str());
@@ -375,6 +380,11 @@ private:
     int                         m_nodeNum;
     uint64_t                    m_osStartTimeNano;
 
+    bool                        m_preloadElf;
+    uint64_t                    m_preloadWriteSize;
+    uint64_t                    m_preloadLatencyPs;
+    std::map<VanadisELFInfo*, uint64_t> m_preloadedPages; // text pages preloaded per executable
+
     std::queue<PageFault*>                          m_pendingFault;
     std::map<std::string, VanadisELFInfo* >         m_elfMap; 
     std::unordered_map<uint32_t,OS::ProcessInfo*>   m_threadMap;
@@ -91,6 +91,9 @@ branch_arith_cycles = int(os.getenv("VANADIS_BRANCH_ARITH_CYCLES", 2))
 
 cpu_clock = os.getenv("VANADIS_CPU_CLOCK", "2.3GHz")
 
+fast_forward_instructions = os.getenv("VANADIS_FAST_FORWARD_INSTRUCTIONS", "")
+fast_forward_until_address = os.getenv("VANADIS_FAST_FORWARD_UNTIL_ADDRESS", "")
+
 numCpus = int(os.getenv("VANADIS_NUM_CORES", 1))
 numThreads = int(os.getenv("VANADIS_NUM_HW_THREADS", 1))
 
@@ -270,6 +273,12 @@ cpuParams = {
     "checkpoint" : checkpoint
 }
 
+# fast-forward is only configured when asked for, the default runs must match the golds
+if fast_forward_instructions != "":
+    cpuParams["fast_forward_instructions"] = fast_forward_instructions
+if fast_forward_until_address != "":
+    cpuParams["fast_forward_until_address"] = fast_forward_until_address
+
 lsqParams = {
     "verbose" : verbosity,
     "address_mask" : 0xFFFFFFFF,
@@ -4,6 +4,8 @@ from sst_unittest import *
 from sst_unittest_support import *
 from sst_unittest_parameterized import parameterized
 import subprocess
+import re
+import struct
 
 module_init = 0
 module_sema = threading.Semaphore()
@@ -147,6 +149,126 @@ class testcase_vanadis(SSTTestCase):
         log_debug("Running Vanadis test #{0} ({1}): elffile={4} in dir {3}, isa {5}; using sdl={2}".format(testnum, testname, sdlfile, elftestdir, elffile, isa, timeout_sec))
         self.vanadis_test_template(testnum, testname, sdlfile, elftestdir, elffile, isa, numCores, numHwThreads, goldfiledir, timeout_sec )
 
+#####
+
+    # Fast-forward the first 500 of hello-world's ~1300 instructions, then simulate the rest in detail
+    def test_vanadis_fast_forward_count(self):
+        self._checkSkipConditions("riscv64")
+        ff_instructions = 500
+        stats = self.vanadis_fast_forward_template("fast_forward_count", {"VANADIS_FAST_FORWARD_INSTRUCTIONS" : str(ff_instructions)})
+
+        # the switch happens at the end of the cycle in which the 500th instruction retires
+        ff_retired = self._cpu_stat(stats, "fast_forward_instructions")
+        self.assertEqual(self._cpu_stat(stats, "fast_forward_instructions", 2), 1, "Expected one fast-forward phase")
+        self.assertTrue(ff_instructions <= ff_retired < ff_instructions + 16,
+            "Fast-forward retired {0} instructions, expected {1} plus at most one cycle at the fast-forward width".format(ff_retired, ff_instructions))
+        self._check_fast_forward_phases(stats)
+
+    # Fast-forward until main's first instruction retires
+    def test_vanadis_fast_forward_address(self):
+        self._checkSkipConditions("riscv64")
+        elf = "{0}/small/basic-io/hello-world/riscv64/hello-world".format(self.get_testsuite_dir())
+        main_address = self._elf_symbol(elf, "main")
+        self.assertTrue(main_address is not None, "{0} has no symbol 'main'".format(elf))
+        stats = self.vanadis_fast_forward_template("fast_forward_address", {"VANADIS_FAST_FORWARD_UNTIL_ADDRESS" : str(main_address)})
+
+        self.assertEqual(self._cpu_stat(stats, "fast_forward_instructions", 2), 1, "Expected one fast-forward phase")
+        self.assertTrue(self._cpu_stat(stats, "fast_forward_instructions") > 0, "Fast-forward retired no instructions before main")
+        self._check_fast_forward_phases(stats)
+
+    # Run hello-world on one riscv64 core with the fast-forward settings in 'ff_env'. The program output must
+    # match the gold, the statistics differ from the gold by design and are returned for the caller to check
+    def vanadis_fast_forward_template(self, testname, ff_env, testtimeout=300):
+        test_path = self.get_testsuite_dir()
+        elftestdir = "small/basic-io"
+        elffile = "hello-world"
+        isa = "riscv64"
+        outdir = "{0}/vanadis_tests/{1}".format(self.get_test_output_run_dir(), testname)
+        os.makedirs(outdir)
+
+        testDataFileName="test_vanadis_{0}".format(testname)
+        sdlfile = "{0}/basic_vanadis.py".format(test_path)
+        sst_outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        sst_errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+        ref_os_outfile = "{0}/{1}/{2}/{3}/vanadis.stdout.gold".format(test_path, elftestdir, elffile, isa)
+        os_outfile = "{0}/stdout-100".format(outdir)
+
+        os.environ['VANADIS_EXE'] = "{0}/{1}/{2}/{3}/{2}".format(test_path, elftestdir, elffile, isa)
+        os.environ['VANADIS_ISA'] = "RISCV64"
+        os.environ['VANADIS_NUM_CORES'] = "1"
+        os.environ['VANADIS_NUM_HW_THREADS'] = "1"
+        os.environ.update(ff_env)
+        try:
+            oscmd = self.run_sst(sdlfile, sst_outfile, sst_errfile, mpi_out_files=mpioutfiles, set_cwd=outdir, timeout_sec=testtimeout)
+        finally:
+            for name in ff_env:
+                del os.environ[name]
+
+        cmp_result = testing_compare_diff(testDataFileName, os_outfile, ref_os_outfile)
+        if (cmp_result == False):
+            log_failure(oscmd)
+            log_failure(testing_get_diff_data(testDataFileName))
+        self.assertTrue(cmp_result, "Vanadis os output file {0} does not match reference output file {1}".format(os_outfile, ref_os_outfile))
+
+        stat_re = re.compile(r' node0\.cpu0\.(\w+)\.1 : Accumulator : Sum\.u64 = (\d+); SumSQ\.u64 = (\d+); Count\.u64 = (\d+);')
+        stats = {}
+        with open(sst_outfile, 'r') as fp:
+            for line in fp:
+                m = stat_re.match(line)
+                if m:
+                    stats[m.group(1)] = [int(m.group(2)), int(m.group(3)), int(m.group(4))]
+        return stats
+
+    # Statistic of the core as [sum, sumSQ, count], failing the test if it was not reported
+    def _cpu_stat(self, stats, name, field=0):
+        self.assertTrue(name in stats, "Statistic {0} is missing from the output".format(name))
+        return stats[name][field]
+
+    # One fast-forward phase followed by one detailed phase that together retire every instruction
+    def _check_fast_forward_phases(self, stats):
+        retired = self._cpu_stat(stats, "instructions_retired")
+        ff_retired = self._cpu_stat(stats, "fast_forward_instructions")
+        detailed_retired = self._cpu_stat(stats, "detailed_instructions")
+        self.assertEqual(self._cpu_stat(stats, "detailed_instructions", 2), 1, "Expected one detailed phase")
+        self.assertTrue(detailed_retired > 0, "No instructions were retired in detailed mode")
+        self.assertEqual(ff_retired + detailed_retired, retired,
+            "Fast-forward ({0}) and detailed ({1}) instructions do not add up to the {2} retired".format(ff_retired, detailed_retired, retired))
+        self.assertTrue(self._cpu_stat(stats, "fast_forward_cycles") > 0)
+        self.assertTrue(self._cpu_stat(stats, "detailed_cycles") > 0)
+        self.assertTrue(self._cpu_stat(stats, "extrapolated_cycles") > 0)
+
+    # Address of symbol 'name' in the ELF file 'path', None if it has no such symbol
+    def _elf_symbol(self, path, name):
+        with open(path, "rb") as fp:
+            data = fp.read()
+        is64 = data[4] == 2
+        end = "<" if data[5] == 1 else ">"
+        if is64:
+            shoff, = struct.unpack_from(end + "Q", data, 0x28)
+            shentsize, shnum = struct.unpack_from(end + "HH", data, 0x3A)
+        else:
+            shoff, = struct.unpack_from(end + "I", data, 0x20)
+            shentsize, shnum = struct.unpack_from(end + "HH", data, 0x2E)
+
+        # section header fields: type, file offset, size, linked section, entry size
+        def section(i):
+            fields = struct.unpack_from(end + ("IIQQQQIIQQ" if is64 else "IIIIIIIIII"), data, shoff + i * shentsize)
+            return fields[1], fields[4], fields[5], fields[6], fields[9]
+
+        for i in range(shnum):
+            stype, soff, ssize, link, entsize = section(i)
+            if stype != 2: # SHT_SYMTAB
+                continue
+            stroff = section(link)[1]
+            for j in range(ssize // entsize):
+                entry = soff + j * entsize
+                st_name, = struct.unpack_from(end + "I", data, entry)
+                st_value, = struct.unpack_from(end + ("Q" if is64 else "I"), data, entry + (8 if is64 else 4))
+                if data[stroff + st_name:data.index(b"\0", stroff + st_name)].decode() == name:
+                    return st_value
+        return None
+
 #####
 
     def vanadis_test_template(self, testnum, testname, sdlfile, elftestdir, elffile, isa, numCores, numHwThreads, goldfiledir, testtimeout=120):
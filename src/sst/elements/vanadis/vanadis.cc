@@ -360,6 +360,38 @@ VANADIS_COMPONENT::VANADIS_COMPONENT(SST::ComponentId_t id, SST::Params& params)
 
     setVerboseWhenIssueAddress( params.find<std::string>("start_verbose_when_issue_address", "") );
 
+    ff_instructions              = params.find<uint64_t>("fast_forward_instructions", 0);
+    ff_until_address             = params.find<uint64_t>("fast_forward_until_address", 0);
+    sample_period                = params.find<uint64_t>("sample_period", 0);
+    sample_detailed_instructions = params.find<uint64_t>("sample_detailed_instructions", 0);
+    ff_width                     = params.find<uint32_t>("fast_forward_width", 16);
+
+    if ( 0 == ff_width ) {
+        output->fatal(CALL_INFO, -1, "Error (%s): 'fast_forward_width' must be greater than 0.\n", getName().c_str());
+    }
+
+    if ( sample_period > 0 && ((0 == sample_detailed_instructions) || (sample_detailed_instructions > sample_period)) ) {
+        output->fatal(CALL_INFO, -1, "Error (%s): 'sample_detailed_instructions' (%" PRIu64 ") must be between 1 and 'sample_period' (%" PRIu64 ").\n",
+            getName().c_str(), sample_detailed_instructions, sample_period);
+    }
+
+    sampling             = (ff_instructions > 0) || (ff_until_address > 0) || (sample_period > 0);
+    initial_ff_done      = (0 == ff_instructions) && (0 == ff_until_address);
+    fast_forward         = ! initial_ff_done;
+    ff_marker_seen       = false;
+    phase_retired        = 0;
+    phase_cycles         = 0;
+    phase_limit          = nextPhaseLimit();
+    ff_ins_count         = 0;
+    ff_cycle_count       = 0;
+    detailed_ins_count   = 0;
+    detailed_cycle_count = 0;
+
+    if ( fast_forward ) {
+        output->verbose(CALL_INFO, 1, 0, "Starting in fast-forward mode (instructions: %" PRIu64 ", until address: 0x%" PRI_ADDR ", width: %" PRIu32 ")\n",
+            ff_instructions, ff_until_address, ff_width);
+    }
+
     // Register statistics ///////////////////////////////////////////////////////
     stat_ins_retired          = registerStatistic<uint64_t>("instructions_retired", "1");
     stat_ins_decoded          = registerStatistic<uint64_t>("instructions_decoded", "1");
@@ -374,6 +406,22 @@ VANADIS_COMPONENT::VANADIS_COMPONENT(SST::ComponentId_t id, SST::Params& params)
     stat_syscall_cycles       = registerStatistic<uint64_t>("syscall-cycles", "1");
     stat_int_phys_regs_in_use = registerStatistic<uint64_t>("phys_int_reg_in_use", "1");
     stat_fp_phys_regs_in_use  = registerStatistic<uint64_t>("phys_fp_reg_in_use", "1");
+    stat_time_to_first_ins    = registerStatistic<uint64_t>("time_to_first_instruction", "1");
+    stat_ff_ins               = nullptr;
+    stat_ff_cycles            = nullptr;
+    stat_detailed_ins         = nullptr;
+    stat_detailed_cycles      = nullptr;
+    stat_extrapolated_cycles  = nullptr;
+
+    // Only cores that switch modes report per-phase statistics
+    if ( sampling ) {
+        stat_ff_ins               = registerStatistic<uint64_t>("fast_forward_instructions", "1");
+        stat_ff_cycles            = registerStatistic<uint64_t>("fast_forward_cycles", "1");
+        stat_detailed_ins         = registerStatistic<uint64_t>("detailed_instructions", "1");
+        stat_detailed_cycles      = registerStatistic<uint64_t>("detailed_cycles", "1");
+        stat_extrapolated_cycles  = registerStatistic<uint64_t>("extrapolated_cycles", "1");
+    }
+    first_ins_retired         = false;
 
     //registerAsPrimaryComponent();
     //primaryComponentDoNotEndSim();
@@ -554,10 +602,17 @@ VANADIS_COMPONENT::performIssue(const uint64_t cycle, int hwThr, uint32_t& rob_s
 #endif
                     const auto ins_type = ins->getInstFuncType();
 
+                    // in fast-forward, arithmetic and branches are executed as soon as they issue
+                    const bool functional_exec = fast_forward &&
+                        (ins_type == INST_INT_ARITH || ins_type == INST_INT_DIV || ins_type == INST_FP_ARITH ||
+                         ins_type == INST_FP_DIV || ins_type == INST_BRANCH);
+
                     if ( 0 == resource_check ) {
                         int allocate_fu = 1;
 
-                        if( (ins_type == INST_LOAD || ins_type == INST_STORE || ins_type == INST_FENCE) ) {
+                        if ( functional_exec ) {
+                            allocate_fu = 0;
+                        } else if( (ins_type == INST_LOAD || ins_type == INST_STORE || ins_type == INST_FENCE) ) {
                             if(unallocated_memory_op_seen) {
                                 // the instruction should not be allocated because memory operations
                                 // must be issued to the LSQ in order to maintain memory ordering
@@ -601,6 +656,10 @@ VANADIS_COMPONENT::performIssue(const uint64_t cycle, int hwThr, uint32_t& rob_s
                             ins->markIssued();
                             ins_issued_this_cycle++;
                             issued_an_ins = true;
+
+                            if ( functional_exec && ! executeFunctional(ins) ) {
+                                functional_pending.push_back(ins);
+                            }
                         } else {
                             if(ins_type == INST_LOAD || ins_type == INST_STORE || ins_type == INST_FENCE) {
                                 // we have seen a memory operation which is not issued, downstream operations
@@ -678,6 +737,17 @@ VANADIS_COMPONENT::performExecute(const uint64_t cycle)
     const uint32_t verbose_level = output->getVerboseLevel();
 #endif
 
+    // retry fast-forward instructions which could not complete when they issued
+    if ( UNLIKELY(! functional_pending.empty()) ) {
+        for ( auto ins_itr = functional_pending.begin(); ins_itr != functional_pending.end(); ) {
+            if ( executeFunctional(*ins_itr) ) {
+                ins_itr = functional_pending.erase(ins_itr);
+            } else {
+                ins_itr++;
+            }
+        }
+    }
+
     for ( VanadisFunctionalUnit* next_fu : fu_int_arith ) {
         next_fu->tick(cycle, output, register_files);
 
@@ -729,6 +799,86 @@ VANADIS_COMPONENT::performExecute(const uint64_t cycle)
     return 0;
 }
 
+bool
+VANADIS_COMPONENT::executeFunctional(VanadisInstruction* ins)
+{
+    ins->execute(output, register_files[ins->getHWThread()]);
+    return ins->completedExecution();
+}
+
+void
+VANADIS_COMPONENT::clearFunctionalPending(const uint32_t hw_thr)
+{
+    for ( auto ins_itr = functional_pending.begin(); ins_itr != functional_pending.end(); ) {
+        if ( (*ins_itr)->getHWThread() == hw_thr ) {
+            ins_itr = functional_pending.erase(ins_itr);
+        } else {
+            ins_itr++;
+        }
+    }
+}
+
+void
+VANADIS_COMPONENT::recordPhase()
+{
+    if ( ! sampling ) { return; }
+
+    if ( fast_forward ) {
+        stat_ff_ins->addData(phase_retired);
+        stat_ff_cycles->addData(phase_cycles);
+        ff_ins_count   += phase_retired;
+        ff_cycle_count += phase_cycles;
+    } else {
+        stat_detailed_ins->addData(phase_retired);
+        stat_detailed_cycles->addData(phase_cycles);
+        detailed_ins_count   += phase_retired;
+        detailed_cycle_count += phase_cycles;
+    }
+    phase_retired = 0;
+    phase_cycles  = 0;
+}
+
+uint64_t
+VANADIS_COMPONENT::nextPhaseLimit() const
+{
+    if ( ! initial_ff_done ) { return (ff_instructions > 0) ? ff_instructions : UINT64_MAX; }
+    if ( 0 == sample_period ) { return UINT64_MAX; }
+    return fast_forward ? (sample_period - sample_detailed_instructions) : sample_detailed_instructions;
+}
+
+void
+VANADIS_COMPONENT::setFastForward(bool enable)
+{
+    recordPhase();
+    fast_forward = enable;
+    output->verbose(CALL_INFO, 1, 0, "Switching to %s mode at cycle %" PRIu64 " (fast-forward: %" PRIu64 " ins, detailed: %" PRIu64 " ins)\n",
+        enable ? "fast-forward" : "detailed", current_cycle, ff_ins_count, detailed_ins_count);
+}
+
+void
+VANADIS_COMPONENT::updateSampleMode()
+{
+    if ( ! initial_ff_done ) {
+        if ( ff_marker_seen || ((ff_instructions > 0) && (phase_retired >= ff_instructions)) ) {
+            initial_ff_done = true;
+            setFastForward(false);
+        }
+    } else if ( sample_period > 0 ) {
+        if ( fast_forward ) {
+            if ( phase_retired >= (sample_period - sample_detailed_instructions) ) { setFastForward(false); }
+        } else if ( phase_retired >= sample_detailed_instructions ) {
+            if ( sample_period > sample_detailed_instructions ) {
+                setFastForward(true);
+            } else {
+                recordPhase();
+            }
+        }
+    }
+
+    ff_marker_seen = false;
+    phase_limit    = nextPhaseLimit();
+}
+
 void VANADIS_COMPONENT::printRob(int rob_num, VanadisCircularQueue<VanadisInstruction*>* rob)
 {
     output->verbose(
@@ -1004,6 +1154,9 @@ VANADIS_COMPONENT::performRetire(int rob_num, VanadisCircularQueue<VanadisInstru
                     output->setVerboseLevel(0);
                     output->setVerboseMask(-1);
                 }
+            if ( UNLIKELY(fast_forward && (ff_until_address > 0) && (rob_front->getInstructionAddress() == ff_until_address)) ) {
+                ff_marker_seen = true;
+            }
             if ( UNLIKELY(
                      (pause_on_retire_address > 0) &&
                      (rob_front->getInstructionAddress() == pause_on_retire_address)) ) {
@@ -1286,7 +1439,8 @@ VANADIS_COMPONENT::tick(SST::Cycle_t cycle)
 {
     std::vector<int>  rc(hw_threads,0);
     auto cnt = hw_threads;
-    for ( uint32_t i = 0; i < retires_per_cycle; ++i ) {
+    const uint32_t retire_width = fast_forward ? ff_width : retires_per_cycle;
+    for ( uint32_t i = 0; i < retire_width; ++i ) {
 
         // find an unblocked hardware thread
         while ( 1 == rc[m_curRetireHwThread] && cnt ) {
@@ -1312,6 +1466,17 @@ VANADIS_COMPONENT::tick(SST::Cycle_t cycle)
     // Record how many instructions we retired this cycle
     stat_ins_retired->addData(ins_retired_this_cycle);
 
+    if(UNLIKELY(!first_ins_retired) && ins_retired_this_cycle > 0) {
+        first_ins_retired = true;
+        stat_time_to_first_ins->addData(getCurrentSimTimeNano());
+        output->verbose(CALL_INFO, 2, 0, "first instruction retired at %" PRIu64 " ns\n", getCurrentSimTimeNano());
+    }
+
+    // per-phase counts are only recorded into statistics when the phase ends
+    phase_retired += ins_retired_this_cycle;
+    phase_cycles++;
+    if ( UNLIKELY(phase_retired >= phase_limit || ff_marker_seen) ) { updateSampleMode(); }
+
     // Execute
     // //////////////////////////////////////////////////////////////////////////
 #ifdef VANADIS_BUILD_DEBUG
@@ -1347,7 +1512,8 @@ VANADIS_COMPONENT::tick(SST::Cycle_t cycle)
     // reach the max issues this cycle
     std::vector<int> rc(hw_threads,0);
     auto cnt = hw_threads;
-    for ( uint32_t i = 0; i < issues_per_cycle; ++i ) {
+    const uint32_t issue_width = fast_forward ? ff_width : issues_per_cycle;
+    for ( uint32_t i = 0; i < issue_width; ++i ) {
         // find an unblocked hardware thread
         while ( 0 != rc[m_curIssueHwThread] && cnt ) {
             ++m_curIssueHwThread;
@@ -1381,7 +1547,8 @@ VANADIS_COMPONENT::tick(SST::Cycle_t cycle)
             "<==========================================================\n");
     }
 #endif
-    for ( uint32_t i = 0; i < decodes_per_cycle; ++i ) {
+    const uint32_t decode_width = fast_forward ? ff_width : decodes_per_cycle;
+    for ( uint32_t i = 0; i < decode_width; ++i ) {
         if ( performDecode(cycle) != 0 ) { break; }
     }
 
@@ -1809,6 +1976,13 @@ VANADIS_COMPONENT::setup()
 void
 VANADIS_COMPONENT::finish()
 {
+    recordPhase();
+
+    // Scale the detailed CPI over everything that retired
+    if ( detailed_ins_count > 0 ) {
+        const double detailed_cpi = (double)detailed_cycle_count / (double)detailed_ins_count;
+        stat_extrapolated_cycles->addData((uint64_t)(detailed_cpi * (double)(detailed_ins_count + ff_ins_count)));
+    }
 
     if ( LIKELY( nullptr == m_checkpointing ) ) return;
 
@@ -1926,6 +2100,7 @@ VANADIS_COMPONENT::handleMisspeculate(const uint32_t hw_thr, const uint64_t new_
     clearFuncUnit(hw_thr, fu_fp_arith);
     clearFuncUnit(hw_thr, fu_fp_div);
     clearFuncUnit(hw_thr, fu_branch);
+    clearFunctionalPending(hw_thr);
 
     lsq->clearLSQByThreadID(hw_thr);
     //resetRegisterStacks(hw_thr);
@@ -2317,6 +2492,7 @@ VANADIS_COMPONENT::resetHwThread(uint32_t thr)
     auto reg_file = register_files[thr];
     auto thr_rob = rob[thr];
 
+    clearFunctionalPending(thr);
     thr_rob->clear();
 
 #if 0
@@ -148,7 +148,12 @@ public:
         { "print_int_reg", "Print integer registers true/false, auto set to true if verbose > 16", "false" },
         { "print_fp_reg", "Print floating-point registers true/false, auto set to "
                           "true if verbose > 16", "false" },
-        { "print_rob", "Print reorder buffer state during issue and retire", "true"} )
+        { "print_rob", "Print reorder buffer state during issue and retire", "true"},
+        { "fast_forward_instructions", "Retire this many instructions in fast-forward mode before switching to detailed simulation, 0 disables. Fast-forward is an accelerated timing mode, not a functional one: the pipeline is widened and arithmetic/branch latencies are skipped, but instructions still retire through the ROB and memory still goes through the LSQ and caches", "0" },
+        { "fast_forward_until_address", "Run in fast-forward mode until the instruction at this address retires, then switch to detailed simulation, 0 disables", "0" },
+        { "sample_period", "After fast-forward ends, repeat sample periods of this many retired instructions. Each period starts with a detailed window followed by fast-forward. 0 stays detailed", "0" },
+        { "sample_detailed_instructions", "Number of instructions simulated in detail at the start of each sample period", "0" },
+        { "fast_forward_width", "Decode, issue and retire width used while in fast-forward mode", "16" } )
 
     SST_ELI_DOCUMENT_STATISTICS(
         { "cycles", "Number of cycles the core executed", "cycles", 1 },
@@ -167,7 +172,13 @@ public:
         { "stores_issued", "Number of store instructions issued to the LSQ", "instructions", 1 },
         { "phys_int_reg_in_use", "Number of physical integer registers that are in use each cycle", "registers", 1 },
         { "phys_fp_reg_in_use", "Number of physical floating point registers than are in use each cycle", "registers",
-          1 })
+          1 },
+        { "time_to_first_instruction", "Simulated time at which the core retired its first instruction (includes image load)", "ns", 5 },
+        { "fast_forward_instructions", "Number of instructions retired in fast-forward mode, one sample per phase. Only with fast-forward or sampling", "instructions", 1 },
+        { "fast_forward_cycles", "Number of cycles spent in fast-forward mode, one sample per phase. Only with fast-forward or sampling", "cycles", 1 },
+        { "detailed_instructions", "Number of instructions retired in detailed mode, one sample per phase. Only with fast-forward or sampling", "instructions", 1 },
+        { "detailed_cycles", "Number of cycles spent in detailed mode, one sample per phase. Only with fast-forward or sampling", "cycles", 1 },
+        { "extrapolated_cycles", "Cycles for all retired instructions, estimated from the CPI of the detailed windows. Only with fast-forward or sampling", "cycles", 1 })
 
     SST_ELI_DOCUMENT_PORTS({ "icache_link", "Connects the CPU to the instruction cache", {} },
                            { "dcache_link", "Connects the CPU to the data cache", {} },
@@ -246,6 +257,13 @@ private:
     bool mapInstructiontoFunctionalUnit(VanadisInstruction* ins, std::vector<VanadisFunctionalUnit*>& functional_units);
     void printRob(int rob_num, VanadisCircularQueue<VanadisInstruction*>* rob);
 
+    bool     executeFunctional(VanadisInstruction* ins);
+    void     clearFunctionalPending(const uint32_t hw_thr);
+    void     updateSampleMode();
+    void     setFastForward(bool enable);
+    void     recordPhase();
+    uint64_t nextPhaseLimit() const;
+
     bool checkVerboseAddr( uint64_t addr ) {
         for ( auto& it : start_verbose_when_issue_address ) {
             if ( it == addr ) return true;
@@ -342,6 +360,42 @@ private:
     Statistic<uint64_t>* stat_syscall_cycles;
     Statistic<uint64_t>* stat_int_phys_regs_in_use;
     Statistic<uint64_t>* stat_fp_phys_regs_in_use;
+    Statistic<uint64_t>* stat_time_to_first_ins;
+
+    Statistic<uint64_t>* stat_ff_ins;
+    Statistic<uint64_t>* stat_ff_cycles;
+    Statistic<uint64_t>* stat_detailed_ins;
+    Statistic<uint64_t>* stat_detailed_cycles;
+    Statistic<uint64_t>* stat_extrapolated_cycles;
+
+    bool first_ins_retired;
+
+    // Fast-forward is an accelerated timing mode, not a functional simulator. There is no separate
+    // executor that bypasses the ROB: instructions are still fetched, decoded, renamed and retired
+    // through the ROB, and memory operations and system calls still go through the LSQ, caches and
+    // OS with their normal timing, because StandardMem offers no untimed accesses once simulation
+    // has started. The mode only executes arithmetic and branch instructions at issue, bypassing
+    // the functional unit latencies, and widens the pipeline to fast_forward_width.
+    bool     sampling;      // any of fast_forward_instructions, fast_forward_until_address or sample_period is set
+    bool     fast_forward;
+    bool     ff_marker_seen;
+    uint64_t ff_instructions;
+    uint64_t ff_until_address;
+    uint64_t sample_period;
+    uint64_t sample_detailed_instructions;
+    uint32_t ff_width;
+    bool     initial_ff_done;
+    uint64_t phase_retired;
+    uint64_t phase_cycles;
+    uint64_t phase_limit;   // phase_retired at which updateSampleMode() next needs to run
+
+    uint64_t ff_ins_count;
+    uint64_t ff_cycle_count;
+    uint64_t detailed_ins_count;
+    uint64_t detailed_cycle_count;
+
+    // instructions that were issued in fast-forward but could not complete yet (e.g. wait for ROB front)
+    std::vector<VanadisInstruction*> functional_pending;
 
     uint32_t ins_issued_this_cycle;
     uint32_t ins_retired_this_cycle;
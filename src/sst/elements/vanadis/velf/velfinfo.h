@@ -18,6 +18,12 @@
 
 #include <cinttypes>
 #include <cstdio>
+#include <cstring>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "os/vosDbgFlags.h"
 
 namespace SST {
@@ -427,6 +433,89 @@ private:
     uint64_t alignment;
 };
 
+/*
+ * Read-only memory mapping of an executable. Header fields and page contents
+ * are still copied out of the mapping, but without a read/seek system call
+ * per field, and large static binaries are not re-opened and re-read for
+ * every page that gets faulted in.
+ */
+class VanadisELFImage {
+public:
+    VanadisELFImage() : base(nullptr), length(0) {}
+
+    ~VanadisELFImage() {
+        if (nullptr != base) {
+            munmap(const_cast<uint8_t*>(base), length);
+        }
+    }
+
+    bool map(const char* path) {
+        int fd = open(path, O_RDONLY);
+
+        if (fd < 0) {
+            return false;
+        }
+
+        struct stat file_stat;
+
+        if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+            close(fd);
+            return false;
+        }
+
+        void* addr = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+
+        if (MAP_FAILED == addr) {
+            return false;
+        }
+
+        base   = (const uint8_t*)addr;
+        length = file_stat.st_size;
+        return true;
+    }
+
+    const uint8_t* data() const { return base; }
+    size_t size() const { return length; }
+
+    // copy up to len bytes starting at offset, returns the number of bytes copied
+    size_t copy(uint64_t offset, void* dst, size_t len) const {
+        if (offset >= length) {
+            return 0;
+        }
+
+        if (len > length - offset) {
+            len = length - offset;
+        }
+
+        memcpy(dst, base + offset, len);
+        return len;
+    }
+
+private:
+    const uint8_t* base;
+    size_t length;
+};
+
+/* Sequential reader over a VanadisELFImage, mirrors the fread/fseek usage of the header parsers */
+class VanadisELFImageReader {
+public:
+    VanadisELFImageReader(const VanadisELFImage* image) : image(image), pos(0) {}
+
+    void seek(uint64_t offset) { pos = offset; }
+    uint64_t tell() const { return pos; }
+
+    void read(void* dst, size_t len) {
+        pos += image->copy(pos, dst, len);
+    }
+
+    const VanadisELFImage* getImage() const { return image; }
+
+private:
+    const VanadisELFImage* image;
+    uint64_t pos;
+};
+
 class VanadisELFInfo {
 public:
     VanadisELFInfo() {
@@ -570,6 +659,9 @@ public:
     const char* getBinaryPath() const { return bin_path; }
     const char* getBinaryPathShort() const { return bin_path_short; }
 
+    bool mapImage() { return image.map(bin_path); }
+    const VanadisELFImage* getImage() const { return &image; }
+
     uint64_t getEntryPoint() const { return elf_entry_point; }
     VanadisELFEndianness getEndian() const { return elf_endian; }
     uint64_t getProgramHeaderOffset() const { return elf_prog_header_start; }
@@ -674,32 +766,23 @@ protected:
     std::vector<VanadisELFProgramSectionEntry*> progSections;
     std::vector<VanadisSymbolTableEntry*> progSymbols;
     std::vector<VanadisELFRelocationEntry*> progRelDyn;
+
+    VanadisELFImage image;
 };
 
 static void
-readString(FILE* bin_file, uint64_t stringTableStart, uint64_t stringTableOffset, std::vector<char>& nameBuffer) {
-    uint64_t current_file_pos = (uint64_t)ftell(bin_file);
-
+readString(const VanadisELFImage* image, uint64_t stringTableStart, uint64_t stringTableOffset, std::vector<char>& nameBuffer) {
     nameBuffer.clear();
-    fseek(bin_file, stringTableStart + stringTableOffset, SEEK_SET);
 
-    while (!feof(bin_file)) {
-        int next_c = fgetc(bin_file);
+    const uint64_t start = stringTableStart + stringTableOffset;
 
-        if ('\0' == next_c) {
-            break;
-        } else if (EOF == next_c) {
-            break;
-        }
-
-        nameBuffer.push_back((char)next_c);
+    if (start < image->size()) {
+        const char* str = (const char*)(image->data() + start);
+        nameBuffer.assign(str, str + strnlen(str, image->size() - start));
     }
 
     // Push back a null character as we are turning this into a string later
     nameBuffer.push_back('\0');
-
-    // Restore file position
-    fseek(bin_file, current_file_pos, SEEK_SET);
 }
 
 static void
@@ -707,11 +790,7 @@ readBinarySymbolTable(SST::Output* output, const char* path, VanadisELFInfo* elf
                       const VanadisELFProgramSectionEntry* symbolSection,
                       const VanadisELFProgramSectionEntry* stringTableEntry) {
 
-    FILE* bin_file = fopen(path, "rb");
-
-    if (nullptr == bin_file) {
-        output->fatal(CALL_INFO, -1, "Error: unable to open %s for reading symbol table.\n", path);
-    }
+    VanadisELFImageReader bin_file(elf_info->getImage());
 
     const bool binary_is_32 = elf_info->isELF32();
 
@@ -719,7 +798,7 @@ readBinarySymbolTable(SST::Output* output, const char* path, VanadisELFInfo* elf
                     symbolSection->getImageOffset(), symbolSection->getImageOffset(), binary_is_32 ? "yes" : "no");
 
     // Wind forward to the symbol table entries
-    fseek(bin_file, symbolSection->getImageOffset(), SEEK_SET);
+    bin_file.seek(symbolSection->getImageOffset());
     uint64_t symbol_size = binary_is_32 ? (4 + 4 + 4 + 2 + 2) : (4 + 2 + 2 + 8 + 8);
 
     output->verbose(
@@ -748,16 +827,16 @@ readBinarySymbolTable(SST::Output* output, const char* path, VanadisELFInfo* elf
         VanadisSymbolTableEntry* new_symbol = new VanadisSymbolTableEntry();
 
         if (elf_info->isELF32()) {
-            fread(&tmp_u32, 4, 1, bin_file);
+            bin_file.read(&tmp_u32, 4);
             new_symbol->setNameOffset(tmp_u32);
 
-            fread(&tmp_u32, 4, 1, bin_file);
+            bin_file.read(&tmp_u32, 4);
             new_symbol->setAddress(tmp_u32);
 
-            fread(&tmp_u32, 4, 1, bin_file);
+            bin_file.read(&tmp_u32, 4);
             new_symbol->setSize(tmp_u32);
 
-            fread(&tmp_u8, 1, 1, bin_file);
+            bin_file.read(&tmp_u8, 1);
             // output->verbose(CALL_INFO, 16, VANADIS_OS_DBG_READ_ELF, "Symbol info >> 4 = %" PRIu64 "\n", (tmp_u8 >> 4));
 
             switch ((tmp_u8 >> 4)) {
@@ -795,14 +874,14 @@ readBinarySymbolTable(SST::Output* output, const char* path, VanadisELFInfo* elf
                 break;
             }
 
-            fread(&tmp_u8, 1, 1, bin_file);
-            fread(&tmp_u16, 2, 1, bin_file);
+            bin_file.read(&tmp_u8, 1);
+            bin_file.read(&tmp_u16, 2);
 
             new_symbol->setSymbolSection(tmp_u16);
 
             if (nullptr != stringTableEntry) {
                 if (new_symbol->getNameOffset() > 0) {
-                    readString(bin_file, stringTableEntry->getImageOffset(), new_symbol->getNameOffset(), name_buffer);
+                    readString(bin_file.getImage(), stringTableEntry->getImageOffset(), new_symbol->getNameOffset(), name_buffer);
                     new_symbol->setName(&name_buffer[0]);
                 } else {
                     const char* no_symbol_name = "";
@@ -812,10 +891,10 @@ readBinarySymbolTable(SST::Output* output, const char* path, VanadisELFInfo* elf
 
             elf_info->addSymbolTableEntry(new_symbol);
         } else if(elf_info->isELF64()) {
-            fread(&tmp_u64, 8, 1, bin_file);
+            bin_file.read(&tmp_u64, 8);
             new_symbol->setNameOffset(tmp_u32);
 
-            fread(&tmp_u8, 1, 1, bin_file);
+            bin_file.read(&tmp_u8, 1);
             // output->verbose(CALL_INFO, 16, VANADIS_OS_DBG_READ_ELF, "Symbol info >> 4 = %" PRIu64 "\n", (tmp_u8 >> 4));
 
             switch ((tmp_u8 >> 4)) {
@@ -853,20 +932,20 @@ readBinarySymbolTable(SST::Output* output, const char* path, VanadisELFInfo* elf
                 break;
             }
 
-            fread(&tmp_u8, 1, 1, bin_file);
-            fread(&tmp_u16, 2, 1, bin_file);
+            bin_file.read(&tmp_u8, 1);
+            bin_file.read(&tmp_u16, 2);
 
             new_symbol->setSymbolSection(tmp_u16);
 
-            fread(&tmp_u64, 8, 1, bin_file);
+            bin_file.read(&tmp_u64, 8);
             new_symbol->setAddress(tmp_u32);
 
-            fread(&tmp_u64, 8, 1, bin_file);
+            bin_file.read(&tmp_u64, 8);
             new_symbol->setSize(tmp_u32);
 
             if (nullptr != stringTableEntry) {
                 if (new_symbol->getNameOffset() > 0) {
-                    readString(bin_file, stringTableEntry->getImageOffset(), new_symbol->getNameOffset(), name_buffer);
+                    readString(bin_file.getImage(), stringTableEntry->getImageOffset(), new_symbol->getNameOffset(), name_buffer);
                     new_symbol->setName(&name_buffer[0]);
                 } else {
                     const char* no_symbol_name = "";
@@ -880,20 +959,15 @@ readBinarySymbolTable(SST::Output* output, const char* path, VanadisELFInfo* elf
 			}
     }
 
-    fclose(bin_file);
 }
 
 static void
 readELFRelocationInformation(SST::Output* output, const char* path, VanadisELFInfo* elf_info,
                              const VanadisELFProgramSectionEntry* relocationEntry) {
 
-    FILE* bin_file = fopen(path, "rb");
+    VanadisELFImageReader bin_file(elf_info->getImage());
 
-    if (nullptr == bin_file) {
-        output->fatal(CALL_INFO, -1, "Error - unable to open %s\n", path);
-    }
-
-    fseek(bin_file, relocationEntry->getImageOffset(), SEEK_SET);
+    bin_file.seek(relocationEntry->getImageOffset());
 
     if (elf_info->isELF32()) {
         uint32_t u32_tmp = 0;
@@ -903,10 +977,10 @@ readELFRelocationInformation(SST::Output* output, const char* path, VanadisELFIn
 
             VanadisELFRelocationEntry* new_reloc = new VanadisELFRelocationEntry();
 
-            fread(&u32_tmp, 4, 1, bin_file);
+            bin_file.read(&u32_tmp, 4);
             new_reloc->setAddress(u32_tmp);
 
-            fread(&u32_tmp, 4, 1, bin_file);
+            bin_file.read(&u32_tmp, 4);
             new_reloc->setInfo(u32_tmp);
 
             elf_info->addRelocationEntry(new_reloc);
@@ -919,10 +993,10 @@ readELFRelocationInformation(SST::Output* output, const char* path, VanadisELFIn
 
             VanadisELFRelocationEntry* new_reloc = new VanadisELFRelocationEntry();
 
-            fread(&u64_tmp, 8, 1, bin_file);
+            bin_file.read(&u64_tmp, 8);
             new_reloc->setAddress(u64_tmp);
 
-            fread(&u64_tmp, 8, 1, bin_file);
+            bin_file.read(&u64_tmp, 8);
             new_reloc->setInfo(u64_tmp);
 
             elf_info->addRelocationEntry(new_reloc);
@@ -931,44 +1005,51 @@ readELFRelocationInformation(SST::Output* output, const char* path, VanadisELFIn
 		output->fatal(CALL_INFO, -1, "ELF info does not show 32b or 64b executable type.\n");
     }
 
-    fclose(bin_file);
 }
 
 static VanadisELFInfo*
 readBinaryELFInfo(SST::Output* output, const char* path) {
 
-    FILE* bin_file = fopen(path, "rb");
+    FILE* bin_file_check = fopen(path, "rb");
 
-    if (nullptr == bin_file) {
-        bin_file = fopen(path, "r");
-        if ( nullptr != bin_file) {
-            fclose(bin_file);
+    if (nullptr == bin_file_check) {
+        bin_file_check = fopen(path, "r");
+        if ( nullptr != bin_file_check) {
+            fclose(bin_file_check);
             output->fatal(CALL_INFO, -1, "Error: unable to open \'%s\', cannot read ELF table.\n", path);
         } else {
             output->fatal(CALL_INFO, -1, "Error: unable to open \'%s\', is this path correct?\n", path);
         }
     }
 
-    uint8_t* elf_magic = new uint8_t[4];
-    fread(elf_magic, 1, 4, bin_file);
-
-    if (!(elf_magic[0] == 0x7F && elf_magic[1] == 0x45 && elf_magic[2] == 0x4c && elf_magic[3] == 0x46)) {
-        output->fatal(CALL_INFO, -1, "Error: opened %s, but the ELF magic header is not correct.\n", path);
-    }
+    fclose(bin_file_check);
 
     VanadisELFInfo* elf_info = new VanadisELFInfo();
 
     elf_info->setBinaryPath(path);
 
+    if (!elf_info->mapImage()) {
+        output->fatal(CALL_INFO, -1, "Error: unable to map \'%s\' into memory, cannot read ELF table.\n", path);
+    }
+
+    VanadisELFImageReader bin_file(elf_info->getImage());
+
+    uint8_t elf_magic[4] = { 0, 0, 0, 0 };
+    bin_file.read(elf_magic, 4);
+
+    if (!(elf_magic[0] == 0x7F && elf_magic[1] == 0x45 && elf_magic[2] == 0x4c && elf_magic[3] == 0x46)) {
+        output->fatal(CALL_INFO, -1, "Error: opened %s, but the ELF magic header is not correct.\n", path);
+    }
+
     uint8_t tmp_byte = 0;
     uint16_t tmp_2byte = 0;
     uint32_t tmp_4byte = 0;
     uint64_t tmp_8byte = 0;
 
-    fread(&tmp_byte, 1, 1, bin_file);
+    bin_file.read(&tmp_byte, 1);
     elf_info->setClass(tmp_byte);
 
-    fread(&tmp_byte, 1, 1, bin_file);
+    bin_file.read(&tmp_byte, 1);
     switch( tmp_byte ) {
 	case 1:
 		elf_info->setEndian(VANADIS_LITTLE_ENDIAN);
@@ -981,90 +1062,90 @@ readBinaryELFInfo(SST::Output* output, const char* path) {
 		break;
     }
 
-    fread(&tmp_byte, 1, 1, bin_file);
+    bin_file.read(&tmp_byte, 1);
     // Discard this read, it is set to 1 for modern ELF
 
-    fread(&tmp_byte, 1, 1, bin_file);
+    bin_file.read(&tmp_byte, 1);
     elf_info->setOSABI(tmp_byte);
 
-    fread(&tmp_byte, 1, 1, bin_file);
+    bin_file.read(&tmp_byte, 1);
     elf_info->setOSABIVersion(tmp_byte);
 
     // Discard the next 7 bytes, these pad the header
-    fread(&tmp_byte, 1, 1, bin_file);
-    fread(&tmp_byte, 1, 1, bin_file);
-    fread(&tmp_byte, 1, 1, bin_file);
-    fread(&tmp_byte, 1, 1, bin_file);
-    fread(&tmp_byte, 1, 1, bin_file);
-    fread(&tmp_byte, 1, 1, bin_file);
-    fread(&tmp_byte, 1, 1, bin_file);
-
-    fread(&tmp_2byte, 2, 1, bin_file);
+    bin_file.read(&tmp_byte, 1);
+    bin_file.read(&tmp_byte, 1);
+    bin_file.read(&tmp_byte, 1);
+    bin_file.read(&tmp_byte, 1);
+    bin_file.read(&tmp_byte, 1);
+    bin_file.read(&tmp_byte, 1);
+    bin_file.read(&tmp_byte, 1);
+
+    bin_file.read(&tmp_2byte, 2);
     elf_info->setObjectType(tmp_2byte);
 
-    fread(&tmp_2byte, 2, 1, bin_file);
+    bin_file.read(&tmp_2byte, 2);
     elf_info->setISA(tmp_2byte);
 
     // Discard the next 4 bytes, these just set to 1 to pad
-    fread(&tmp_byte, 1, 1, bin_file);
-    fread(&tmp_byte, 1, 1, bin_file);
-    fread(&tmp_byte, 1, 1, bin_file);
-    fread(&tmp_byte, 1, 1, bin_file);
+    bin_file.read(&tmp_byte, 1);
+    bin_file.read(&tmp_byte, 1);
+    bin_file.read(&tmp_byte, 1);
+    bin_file.read(&tmp_byte, 1);
 
     if (elf_info->isELF64()) {
-        fread(&tmp_8byte, 8, 1, bin_file);
+        bin_file.read(&tmp_8byte, 8);
         elf_info->setEntryPoint(tmp_8byte);
 
-        fread(&tmp_8byte, 8, 1, bin_file);
+        bin_file.read(&tmp_8byte, 8);
         elf_info->setProgramHeaderOffset(tmp_8byte);
 
-        fread(&tmp_8byte, 8, 1, bin_file);
+        bin_file.read(&tmp_8byte, 8);
         elf_info->setSectionHeaderOffset(tmp_8byte);
     } else if (elf_info->isELF32()) {
-        fread(&tmp_4byte, 4, 1, bin_file);
+        bin_file.read(&tmp_4byte, 4);
         elf_info->setEntryPoint((uint64_t)tmp_4byte);
 
-        fread(&tmp_4byte, 4, 1, bin_file);
+        bin_file.read(&tmp_4byte, 4);
         elf_info->setProgramHeaderOffset((uint64_t)tmp_4byte);
 
-        fread(&tmp_4byte, 4, 1, bin_file);
+        bin_file.read(&tmp_4byte, 4);
         elf_info->setSectionHeaderOffset((uint64_t)tmp_4byte);
     } else {
         output->fatal(CALL_INFO, -1, "Error: unable to determine if binary is 32/64 bits during ELF read.\n");
     }
 
     // Discard, ISA specific, need to understand whether we need this.
-    fread(&tmp_4byte, 4, 1, bin_file);
+    bin_file.read(&tmp_4byte, 4);
 
     // Discard, is just a size read for ELF header info
-    fread(&tmp_2byte, 2, 1, bin_file);
+    bin_file.read(&tmp_2byte, 2);
 
-    fread(&tmp_2byte, 2, 1, bin_file);
+    bin_file.read(&tmp_2byte, 2);
     elf_info->setProgramHeaderEntrySize(tmp_2byte);
 
-    fread(&tmp_2byte, 2, 1, bin_file);
+    bin_file.read(&tmp_2byte, 2);
     elf_info->setProgramHeaderEntryCount(tmp_2byte);
 
     const uint32_t prog_header_count = (uint32_t)tmp_2byte;
 
-    fread(&tmp_2byte, 2, 1, bin_file);
+    bin_file.read(&tmp_2byte, 2);
     elf_info->setSectionHeaderEntrySize(tmp_2byte);
 
-    fread(&tmp_2byte, 2, 1, bin_file);
+    bin_file.read(&tmp_2byte, 2);
     elf_info->setSectionHeaderEntryCount(tmp_2byte);
 
-    fread(&tmp_2byte, 2, 1, bin_file);
+    bin_file.read(&tmp_2byte, 2);
     elf_info->setSectionEntryIndexForNames(tmp_2byte);
 
     // Wind the file pointer to the program header offset
-    fseek(bin_file, elf_info->getProgramHeaderOffset(), SEEK_SET);
+    bin_file.seek(elf_info->getProgramHeaderOffset());
 
     for (uint32_t i = 0; i < prog_header_count; ++i) {
         output->verbose(CALL_INFO, 4, VANADIS_OS_DBG_READ_ELF, "Reading Program Header %" PRIu32 "...\n", i);
         VanadisELFProgramHeaderEntry* new_prg_hdr = new VanadisELFProgramHeaderEntry();
 
         // Header type
-        fread(&tmp_4byte, 4, 1, bin_file);
+        bin_file.read(&tmp_4byte, 4);
 
         VanadisELFProgramHeaderType prg_hdr_type = PROG_HEADER_NOT_USED;
 
@@ -1100,46 +1181,46 @@ readBinaryELFInfo(SST::Output* output, const char* path) {
         new_prg_hdr->setHeaderType(prg_hdr_type);
 
         if (elf_info->isELF64()) {
-            fread(&tmp_4byte, 4, 1, bin_file);
+            bin_file.read(&tmp_4byte, 4);
             new_prg_hdr->setSegmentFlags(tmp_4byte);
 
-            fread(&tmp_8byte, 8, 1, bin_file);
+            bin_file.read(&tmp_8byte, 8);
             new_prg_hdr->setImageOffset(tmp_8byte);
 
-            fread(&tmp_8byte, 8, 1, bin_file);
+            bin_file.read(&tmp_8byte, 8);
             new_prg_hdr->setVirtualMemoryStart(tmp_8byte);
 
-            fread(&tmp_8byte, 8, 1, bin_file);
+            bin_file.read(&tmp_8byte, 8);
             new_prg_hdr->setPhysicalMemoryStart(tmp_8byte);
 
-            fread(&tmp_8byte, 8, 1, bin_file);
+            bin_file.read(&tmp_8byte, 8);
             new_prg_hdr->setHeaderImageLength(tmp_8byte);
 
-            fread(&tmp_8byte, 8, 1, bin_file);
+            bin_file.read(&tmp_8byte, 8);
             new_prg_hdr->setHeaderMemoryLength(tmp_8byte);
 
-            fread(&tmp_8byte, 8, 1, bin_file);
+            bin_file.read(&tmp_8byte, 8);
             new_prg_hdr->setAlignment(tmp_8byte);
         } else if (elf_info->isELF32()) {
-            fread(&tmp_4byte, 4, 1, bin_file);
+            bin_file.read(&tmp_4byte, 4);
             new_prg_hdr->setImageOffset(tmp_4byte);
 
-            fread(&tmp_4byte, 4, 1, bin_file);
+            bin_file.read(&tmp_4byte, 4);
             new_prg_hdr->setVirtualMemoryStart(tmp_4byte);
 
-            fread(&tmp_4byte, 4, 1, bin_file);
+            bin_file.read(&tmp_4byte, 4);
             new_prg_hdr->setPhysicalMemoryStart(tmp_4byte);
 
-            fread(&tmp_4byte, 4, 1, bin_file);
+            bin_file.read(&tmp_4byte, 4);
             new_prg_hdr->setHeaderImageLength(tmp_4byte);
 
-            fread(&tmp_4byte, 4, 1, bin_file);
+            bin_file.read(&tmp_4byte, 4);
             new_prg_hdr->setHeaderMemoryLength(tmp_4byte);
 
-            fread(&tmp_4byte, 4, 1, bin_file);
+            bin_file.read(&tmp_4byte, 4);
             new_prg_hdr->setSegmentFlags(tmp_4byte);
 
-            fread(&tmp_4byte, 4, 1, bin_file);
+            bin_file.read(&tmp_4byte, 4);
             new_prg_hdr->setAlignment(tmp_4byte);
         } else {
             output->fatal(CALL_INFO, -1, "Error: neither 32 or 64 bit test passed ELF read.\n");
@@ -1148,7 +1229,7 @@ readBinaryELFInfo(SST::Output* output, const char* path) {
         elf_info->addProgramHeader(new_prg_hdr);
     }
 
-    fseek(bin_file, elf_info->getSectionHeaderOffset(), SEEK_SET);
+    bin_file.seek(elf_info->getSectionHeaderOffset());
 
     for (uint32_t i = 0; i < elf_info->getSectionHeaderEntryCount(); ++i) {
         output->verbose(CALL_INFO, 4, VANADIS_OS_DBG_READ_ELF, "Reading Section Header %" PRIu32 "...\n", i);
@@ -1156,9 +1237,9 @@ readBinaryELFInfo(SST::Output* output, const char* path) {
         new_sec->setID(i);
 
         // Offset for section name
-        fread(&tmp_4byte, 4, 1, bin_file);
+        bin_file.read(&tmp_4byte, 4);
 
-        fread(&tmp_4byte, 4, 1, bin_file);
+        bin_file.read(&tmp_4byte, 4);
         VanadisELFSectionHeaderType sec_type = SECTION_HEADER_NOT_USED;
 
         switch (tmp_4byte) {
@@ -1221,45 +1302,45 @@ readBinaryELFInfo(SST::Output* output, const char* path) {
         new_sec->setSectionType(sec_type);
 
         if (elf_info->isELF64()) {
-            fread(&tmp_8byte, 8, 1, bin_file);
+            bin_file.read(&tmp_8byte, 8);
             new_sec->setSectionFlags(tmp_8byte);
 
-            fread(&tmp_8byte, 8, 1, bin_file);
+            bin_file.read(&tmp_8byte, 8);
             new_sec->setVirtualMemoryStart(tmp_8byte);
 
-            fread(&tmp_8byte, 8, 1, bin_file);
+            bin_file.read(&tmp_8byte, 8);
             new_sec->setImageOffset(tmp_8byte);
 
-            fread(&tmp_8byte, 8, 1, bin_file);
+            bin_file.read(&tmp_8byte, 8);
             new_sec->setImageLength(tmp_8byte);
 
-            fread(&tmp_4byte, 4, 1, bin_file);
-            fread(&tmp_4byte, 4, 1, bin_file);
+            bin_file.read(&tmp_4byte, 4);
+            bin_file.read(&tmp_4byte, 4);
 
-            fread(&tmp_8byte, 8, 1, bin_file);
+            bin_file.read(&tmp_8byte, 8);
             new_sec->setAlignment(tmp_8byte);
 
-            fread(&tmp_8byte, 8, 1, bin_file);
+            bin_file.read(&tmp_8byte, 8);
         } else if (elf_info->isELF32()) {
-            fread(&tmp_4byte, 4, 1, bin_file);
+            bin_file.read(&tmp_4byte, 4);
             new_sec->setSectionFlags(tmp_4byte);
 
-            fread(&tmp_4byte, 4, 1, bin_file);
+            bin_file.read(&tmp_4byte, 4);
             new_sec->setVirtualMemoryStart(tmp_4byte);
 
-            fread(&tmp_4byte, 4, 1, bin_file);
+            bin_file.read(&tmp_4byte, 4);
             new_sec->setImageOffset(tmp_4byte);
 
-            fread(&tmp_4byte, 4, 1, bin_file);
+            bin_file.read(&tmp_4byte, 4);
             new_sec->setImageLength(tmp_4byte);
 
-            fread(&tmp_4byte, 4, 1, bin_file);
-            fread(&tmp_4byte, 4, 1, bin_file);
+            bin_file.read(&tmp_4byte, 4);
+            bin_file.read(&tmp_4byte, 4);
 
-            fread(&tmp_4byte, 4, 1, bin_file);
+            bin_file.read(&tmp_4byte, 4);
             new_sec->setAlignment(tmp_4byte);
 
-            fread(&tmp_4byte, 4, 1, bin_file);
+            bin_file.read(&tmp_4byte, 4);
         } else {
             output->fatal(CALL_INFO, -1, "Error: not 32 or 64-bit type ELF info. Not sure what to do.\n");
         }
@@ -1267,8 +1348,6 @@ readBinaryELFInfo(SST::Output* output, const char* path) {
         elf_info->addProgramSection(new_sec);
     }
 
-    fclose(bin_file);
-
     VanadisELFProgramSectionEntry* string_table_entry = nullptr;
 
     for (size_t i = 0; i < elf_info->countProgramSections(); ++i) {